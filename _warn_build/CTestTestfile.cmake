@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_warn_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("_deps/googletest-build")
+subdirs("src/core")
+subdirs("src/graph")
+subdirs("src/solver")
+subdirs("test/core")
+subdirs("test/graph")
+subdirs("test/solver")
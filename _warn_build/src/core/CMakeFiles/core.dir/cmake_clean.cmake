@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libcore.a"
+  "../../lib/libcore.pdb"
+  "CMakeFiles/core.dir/matrix_sparse.cpp.o"
+  "CMakeFiles/core.dir/matrix_sparse.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/graph/adjacency_subgraph.cpp" "src/graph/CMakeFiles/graph.dir/adjacency_subgraph.cpp.o" "gcc" "src/graph/CMakeFiles/graph.dir/adjacency_subgraph.cpp.o.d"
+  "/root/repo/src/graph/halo_exchange.cpp" "src/graph/CMakeFiles/graph.dir/halo_exchange.cpp.o" "gcc" "src/graph/CMakeFiles/graph.dir/halo_exchange.cpp.o.d"
+  "/root/repo/src/graph/partition.cpp" "src/graph/CMakeFiles/graph.dir/partition.cpp.o" "gcc" "src/graph/CMakeFiles/graph.dir/partition.cpp.o.d"
+  "/root/repo/src/graph/reorder.cpp" "src/graph/CMakeFiles/graph.dir/reorder.cpp.o" "gcc" "src/graph/CMakeFiles/graph.dir/reorder.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
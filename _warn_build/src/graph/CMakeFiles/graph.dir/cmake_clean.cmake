@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libgraph.a"
+  "../../lib/libgraph.pdb"
+  "CMakeFiles/graph.dir/adjacency_subgraph.cpp.o"
+  "CMakeFiles/graph.dir/adjacency_subgraph.cpp.o.d"
+  "CMakeFiles/graph.dir/halo_exchange.cpp.o"
+  "CMakeFiles/graph.dir/halo_exchange.cpp.o.d"
+  "CMakeFiles/graph.dir/partition.cpp.o"
+  "CMakeFiles/graph.dir/partition.cpp.o.d"
+  "CMakeFiles/graph.dir/reorder.cpp.o"
+  "CMakeFiles/graph.dir/reorder.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/solver/direct_sparse_factorisation.cpp" "src/solver/CMakeFiles/solver.dir/direct_sparse_factorisation.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/direct_sparse_factorisation.cpp.o.d"
+  "/root/repo/src/solver/solver.cpp" "src/solver/CMakeFiles/solver.dir/solver.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver.cpp.o.d"
+  "/root/repo/src/solver/solver_distributed.cpp" "src/solver/CMakeFiles/solver.dir/solver_distributed.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver_distributed.cpp.o.d"
+  "/root/repo/src/solver/solver_fixed_point.cpp" "src/solver/CMakeFiles/solver.dir/solver_fixed_point.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver_fixed_point.cpp.o.d"
+  "/root/repo/src/solver/solver_krylov.cpp" "src/solver/CMakeFiles/solver.dir/solver_krylov.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver_krylov.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/graph/CMakeFiles/graph.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libsolver.a"
+  "../../lib/libsolver.pdb"
+  "CMakeFiles/solver.dir/direct_sparse_factorisation.cpp.o"
+  "CMakeFiles/solver.dir/direct_sparse_factorisation.cpp.o.d"
+  "CMakeFiles/solver.dir/solver.cpp.o"
+  "CMakeFiles/solver.dir/solver.cpp.o.d"
+  "CMakeFiles/solver.dir/solver_distributed.cpp.o"
+  "CMakeFiles/solver.dir/solver_distributed.cpp.o.d"
+  "CMakeFiles/solver.dir/solver_fixed_point.cpp.o"
+  "CMakeFiles/solver.dir/solver_fixed_point.cpp.o.d"
+  "CMakeFiles/solver.dir/solver_krylov.cpp.o"
+  "CMakeFiles/solver.dir/solver_krylov.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_matrix_dense"
+  "../../bin/test_matrix_dense.pdb"
+  "CMakeFiles/test_matrix_dense.dir/test_matrix_dense.cpp.o"
+  "CMakeFiles/test_matrix_dense.dir/test_matrix_dense.cpp.o.d"
+  "test_matrix_dense[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_dense.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
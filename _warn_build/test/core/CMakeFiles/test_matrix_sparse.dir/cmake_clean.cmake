@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_matrix_sparse"
+  "../../bin/test_matrix_sparse.pdb"
+  "CMakeFiles/test_matrix_sparse.dir/test_matrix_sparse.cpp.o"
+  "CMakeFiles/test_matrix_sparse.dir/test_matrix_sparse.cpp.o.d"
+  "test_matrix_sparse[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_sparse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
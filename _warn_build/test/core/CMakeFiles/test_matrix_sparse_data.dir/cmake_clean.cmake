@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_matrix_sparse_data"
+  "../../bin/test_matrix_sparse_data.pdb"
+  "CMakeFiles/test_matrix_sparse_data.dir/test_matrix_sparse_data.cpp.o"
+  "CMakeFiles/test_matrix_sparse_data.dir/test_matrix_sparse_data.cpp.o.d"
+  "test_matrix_sparse_data[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_sparse_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
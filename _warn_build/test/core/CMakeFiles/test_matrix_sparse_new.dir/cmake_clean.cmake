@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_matrix_sparse_new"
+  "../../bin/test_matrix_sparse_new.pdb"
+  "CMakeFiles/test_matrix_sparse_new.dir/test_matrix_sparse_new.cpp.o"
+  "CMakeFiles/test_matrix_sparse_new.dir/test_matrix_sparse_new.cpp.o.d"
+  "test_matrix_sparse_new[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_sparse_new.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_scalar"
+  "../../bin/test_scalar.pdb"
+  "CMakeFiles/test_scalar.dir/test_scalar.cpp.o"
+  "CMakeFiles/test_scalar.dir/test_scalar.cpp.o.d"
+  "test_scalar[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_vector_dense"
+  "../../bin/test_vector_dense.pdb"
+  "CMakeFiles/test_vector_dense.dir/test_vector_dense.cpp.o"
+  "CMakeFiles/test_vector_dense.dir/test_vector_dense.cpp.o.d"
+  "test_vector_dense[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_dense.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
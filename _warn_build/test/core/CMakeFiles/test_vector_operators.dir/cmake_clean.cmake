@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_vector_operators"
+  "../../bin/test_vector_operators.pdb"
+  "CMakeFiles/test_vector_operators.dir/test_vector_operators.cpp.o"
+  "CMakeFiles/test_vector_operators.dir/test_vector_operators.cpp.o.d"
+  "test_vector_operators[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_operators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/core
+# Build directory: /root/repo/_warn_build/test/core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_warn_build/test/core/test_matrix_dense[1]_include.cmake")
+include("/root/repo/_warn_build/test/core/test_matrix_sparse[1]_include.cmake")
+include("/root/repo/_warn_build/test/core/test_matrix_sparse_data[1]_include.cmake")
+include("/root/repo/_warn_build/test/core/test_matrix_sparse_new[1]_include.cmake")
+include("/root/repo/_warn_build/test/core/test_scalar[1]_include.cmake")
+include("/root/repo/_warn_build/test/core/test_vector_dense[1]_include.cmake")
+include("/root/repo/_warn_build/test/core/test_vector_operators[1]_include.cmake")
@@ -0,0 +1,29 @@
+add_test([=[test_matrix_dense.constructors_initialiser_lists]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.constructors_initialiser_lists]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.constructors_initialiser_lists]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.constructors_lambda]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.constructors_lambda]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.constructors_lambda]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.size_row_column_size_resize]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.size_row_column_size_resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.size_row_column_size_resize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.scalar_matrix_multiplication_assignment]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.scalar_matrix_multiplication_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.scalar_matrix_multiplication_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.scalar_matrix_division_assignment]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.scalar_matrix_division_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.scalar_matrix_division_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.matrix_matrix_addition_assignment]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.matrix_matrix_addition_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.matrix_matrix_addition_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.matrix_matrix_subtraction_assignment]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.matrix_matrix_subtraction_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.matrix_matrix_subtraction_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.matrix_matrix_multiplication_assignment]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.matrix_matrix_multiplication_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.matrix_matrix_multiplication_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.scalar_matrix_multiplication]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.scalar_matrix_multiplication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.scalar_matrix_multiplication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.scalar_matrix_division]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.scalar_matrix_division]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.scalar_matrix_division]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.matrix_vector_multiplication]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.matrix_vector_multiplication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.matrix_vector_multiplication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.matrix_matrix_addition]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.matrix_matrix_addition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.matrix_matrix_addition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.matrix_matrix_subtraction]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.matrix_matrix_subtraction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.matrix_matrix_subtraction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_dense.matrix_matrix_multiplication]=]  /root/repo/_warn_build/bin/test_matrix_dense [==[--gtest_filter=test_matrix_dense.matrix_matrix_multiplication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_dense.matrix_matrix_multiplication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_matrix_dense_TESTS test_matrix_dense.constructors_initialiser_lists test_matrix_dense.constructors_lambda test_matrix_dense.size_row_column_size_resize test_matrix_dense.scalar_matrix_multiplication_assignment test_matrix_dense.scalar_matrix_division_assignment test_matrix_dense.matrix_matrix_addition_assignment test_matrix_dense.matrix_matrix_subtraction_assignment test_matrix_dense.matrix_matrix_multiplication_assignment test_matrix_dense.scalar_matrix_multiplication test_matrix_dense.scalar_matrix_division test_matrix_dense.matrix_vector_multiplication test_matrix_dense.matrix_matrix_addition test_matrix_dense.matrix_matrix_subtraction test_matrix_dense.matrix_matrix_multiplication)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/core/test_matrix_sparse[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/core/test_matrix_sparse[1]_tests.cmake")
+else()
+  add_test(test_matrix_sparse_NOT_BUILT test_matrix_sparse_NOT_BUILT)
+endif()
@@ -0,0 +1,63 @@
+add_test([=[test_matrix_sparse.constructors_row_column]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.constructors_row_column]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.constructors_row_column]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.constructors_initialiser_lists]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.constructors_initialiser_lists]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.constructors_initialiser_lists]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.operator_assignment]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.operator_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.operator_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.at]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.at]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.at]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.operator_subscript]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.operator_subscript]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.operator_subscript]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.begin]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.begin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.begin]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.end]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.end]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.end]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.empty]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.size]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.reserve_capacity]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.reserve_capacity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.reserve_capacity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.shrink_to_fit]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.shrink_to_fit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.shrink_to_fit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.clear]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.clear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.insert_insert_or_assign]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.insert_insert_or_assign]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.insert_insert_or_assign]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.erase]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.erase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.resize]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.resize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.swap]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.swap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.find]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.find]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.find]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.contains]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.contains]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.contains]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.lower_bound]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.lower_bound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.lower_bound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.operator_scalar_multiplication_assignement]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.operator_scalar_multiplication_assignement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.operator_scalar_multiplication_assignement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.operator_scalar_division_assignement]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.operator_scalar_division_assignement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.operator_scalar_division_assignement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.operator_matrix_addition_assignement]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.operator_matrix_addition_assignement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.operator_matrix_addition_assignement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.operator_matrix_subraction_assignement]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.operator_matrix_subraction_assignement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.operator_matrix_subraction_assignement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.operator_matrix_multiplication_assignement]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.operator_matrix_multiplication_assignement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.operator_matrix_multiplication_assignement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.scalar_matrix_multiplication]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.scalar_matrix_multiplication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.scalar_matrix_multiplication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.scalar_matrix_division]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.scalar_matrix_division]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.scalar_matrix_division]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.matrix_vector_multiplication]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.matrix_vector_multiplication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.matrix_vector_multiplication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.multiply_row_range]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.multiply_row_range]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.multiply_row_range]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.matrix_matrix_addition]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.matrix_matrix_addition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.matrix_matrix_addition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.matrix_matrix_subtraction]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.matrix_matrix_subtraction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.matrix_matrix_subtraction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_matrix_sparse.matrix_matrix_multiplication]=]  /root/repo/_warn_build/bin/test_matrix_sparse [==[--gtest_filter=test_matrix_sparse.matrix_matrix_multiplication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_matrix_sparse.matrix_matrix_multiplication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_matrix_sparse_TESTS test_matrix_sparse.constructors_row_column test_matrix_sparse.constructors_initialiser_lists test_matrix_sparse.operator_assignment test_matrix_sparse.at test_matrix_sparse.operator_subscript test_matrix_sparse.begin test_matrix_sparse.end test_matrix_sparse.empty test_matrix_sparse.size test_matrix_sparse.reserve_capacity test_matrix_sparse.shrink_to_fit test_matrix_sparse.clear test_matrix_sparse.insert_insert_or_assign test_matrix_sparse.erase test_matrix_sparse.resize test_matrix_sparse.swap test_matrix_sparse.find test_matrix_sparse.contains test_matrix_sparse.lower_bound test_matrix_sparse.operator_scalar_multiplication_assignement test_matrix_sparse.operator_scalar_division_assignement test_matrix_sparse.operator_matrix_addition_assignement test_matrix_sparse.operator_matrix_subraction_assignement test_matrix_sparse.operator_matrix_multiplication_assignement test_matrix_sparse.scalar_matrix_multiplication test_matrix_sparse.scalar_matrix_division test_matrix_sparse.matrix_vector_multiplication test_matrix_sparse.multiply_row_range test_matrix_sparse.matrix_matrix_addition test_matrix_sparse.matrix_matrix_subtraction test_matrix_sparse.matrix_matrix_multiplication)
@@ -0,0 +1,11 @@
+add_test([=[test_csr_data.size]=]  /root/repo/_warn_build/bin/test_matrix_sparse_data [==[--gtest_filter=test_csr_data.size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_csr_data.size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_csr_data.resize]=]  /root/repo/_warn_build/bin/test_matrix_sparse_data [==[--gtest_filter=test_csr_data.resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_csr_data.resize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_csr_data.insert]=]  /root/repo/_warn_build/bin/test_matrix_sparse_data [==[--gtest_filter=test_csr_data.insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_csr_data.insert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_csr_data.insert_or_assign]=]  /root/repo/_warn_build/bin/test_matrix_sparse_data [==[--gtest_filter=test_csr_data.insert_or_assign]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_csr_data.insert_or_assign]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_csr_data.lower_bound]=]  /root/repo/_warn_build/bin/test_matrix_sparse_data [==[--gtest_filter=test_csr_data.lower_bound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_csr_data.lower_bound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_matrix_sparse_data_TESTS test_csr_data.size test_csr_data.resize test_csr_data.insert test_csr_data.insert_or_assign test_csr_data.lower_bound)
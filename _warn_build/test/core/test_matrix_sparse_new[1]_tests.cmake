@@ -0,0 +1,39 @@
+add_test([=[matrix_sparse_element_test.constructor_and_accessors]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_element_test.constructor_and_accessors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_element_test.constructor_and_accessors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_element_test.const_accessors]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_element_test.const_accessors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_element_test.const_accessors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_element_test.equality_comparison]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_element_test.equality_comparison]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_element_test.equality_comparison]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_element_test.inequality_comparison]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_element_test.inequality_comparison]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_element_test.inequality_comparison]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_element_test.modifiers]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_element_test.modifiers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_element_test.modifiers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[base_iterator_matrix_sparse_element_test.default_constructor]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=base_iterator_matrix_sparse_element_test.default_constructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[base_iterator_matrix_sparse_element_test.default_constructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[base_iterator_matrix_sparse_element_test.constructor_and_dereference]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=base_iterator_matrix_sparse_element_test.constructor_and_dereference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[base_iterator_matrix_sparse_element_test.constructor_and_dereference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[base_iterator_matrix_sparse_element_test.increment_and_decrement]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=base_iterator_matrix_sparse_element_test.increment_and_decrement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[base_iterator_matrix_sparse_element_test.increment_and_decrement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[base_iterator_matrix_sparse_element_test.comparison]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=base_iterator_matrix_sparse_element_test.comparison]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[base_iterator_matrix_sparse_element_test.comparison]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[base_iterator_matrix_sparse_element_test.const_iterator]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=base_iterator_matrix_sparse_element_test.const_iterator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[base_iterator_matrix_sparse_element_test.const_iterator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.constructor_and_row_indexing]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.constructor_and_row_indexing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.constructor_and_row_indexing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.iterators]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.iterators]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.iterators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.const_iterators]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.const_iterators]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.const_iterators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.at]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.at]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.at]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.const_as]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.const_as]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.const_as]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.subscript_operators]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.subscript_operators]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.subscript_operators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.const_subscript_operators]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.const_subscript_operators]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.const_subscript_operators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.sparse_accessor]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.sparse_accessor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.sparse_accessor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[matrix_sparse_row_test.empty_row]=]  /root/repo/_warn_build/bin/test_matrix_sparse_new [==[--gtest_filter=matrix_sparse_row_test.empty_row]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[matrix_sparse_row_test.empty_row]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_matrix_sparse_new_TESTS matrix_sparse_element_test.constructor_and_accessors matrix_sparse_element_test.const_accessors matrix_sparse_element_test.equality_comparison matrix_sparse_element_test.inequality_comparison matrix_sparse_element_test.modifiers base_iterator_matrix_sparse_element_test.default_constructor base_iterator_matrix_sparse_element_test.constructor_and_dereference base_iterator_matrix_sparse_element_test.increment_and_decrement base_iterator_matrix_sparse_element_test.comparison base_iterator_matrix_sparse_element_test.const_iterator matrix_sparse_row_test.constructor_and_row_indexing matrix_sparse_row_test.iterators matrix_sparse_row_test.const_iterators matrix_sparse_row_test.at matrix_sparse_row_test.const_as matrix_sparse_row_test.subscript_operators matrix_sparse_row_test.const_subscript_operators matrix_sparse_row_test.sparse_accessor matrix_sparse_row_test.empty_row)
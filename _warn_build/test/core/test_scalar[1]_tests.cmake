@@ -0,0 +1,7 @@
+add_test([=[test_scalar.is_nearly_equal]=]  /root/repo/_warn_build/bin/test_scalar [==[--gtest_filter=test_scalar.is_nearly_equal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_scalar.is_nearly_equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_scalar.is_nearly_greater_equal]=]  /root/repo/_warn_build/bin/test_scalar [==[--gtest_filter=test_scalar.is_nearly_greater_equal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_scalar.is_nearly_greater_equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_scalar.is_nearly_less_equal]=]  /root/repo/_warn_build/bin/test_scalar [==[--gtest_filter=test_scalar.is_nearly_less_equal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_scalar.is_nearly_less_equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_scalar_TESTS test_scalar.is_nearly_equal test_scalar.is_nearly_greater_equal test_scalar.is_nearly_less_equal)
@@ -0,0 +1,21 @@
+add_test([=[test_vector_dense.constructors_initialiser_lists]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.constructors_initialiser_lists]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.constructors_initialiser_lists]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.constructors_lambda]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.constructors_lambda]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.constructors_lambda]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.scalar_multiplication_assignment]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.scalar_multiplication_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.scalar_multiplication_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.scalar_division_assignment]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.scalar_division_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.scalar_division_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.vector_addition_assignment]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.vector_addition_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.vector_addition_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.vector_subtraction_assignment]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.vector_subtraction_assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.vector_subtraction_assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.scalar_multiplication]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.scalar_multiplication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.scalar_multiplication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.scalar_division]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.scalar_division]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.scalar_division]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.vector_addition]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.vector_addition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.vector_addition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_dense.vector_subtraction]=]  /root/repo/_warn_build/bin/test_vector_dense [==[--gtest_filter=test_vector_dense.vector_subtraction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_dense.vector_subtraction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_vector_dense_TESTS test_vector_dense.constructors_initialiser_lists test_vector_dense.constructors_lambda test_vector_dense.scalar_multiplication_assignment test_vector_dense.scalar_division_assignment test_vector_dense.vector_addition_assignment test_vector_dense.vector_subtraction_assignment test_vector_dense.scalar_multiplication test_vector_dense.scalar_division test_vector_dense.vector_addition test_vector_dense.vector_subtraction)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/core/test_vector_operators[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/core/test_vector_operators[1]_tests.cmake")
+else()
+  add_test(test_vector_operators_NOT_BUILT test_vector_operators_NOT_BUILT)
+endif()
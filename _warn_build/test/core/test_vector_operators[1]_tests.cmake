@@ -0,0 +1,17 @@
+add_test([=[test_vector_operators.lp_norm]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.lp_norm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.lp_norm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_operators.mean]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.mean]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.mean]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_operators.dot_product]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.dot_product]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.dot_product]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_operators.unit]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.unit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.unit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_operators.angle]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.angle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.angle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_operators.cross_product]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.cross_product]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.cross_product]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_operators.tangent_projection]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.tangent_projection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.tangent_projection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_vector_operators.orthogonal_projection]=]  /root/repo/_warn_build/bin/test_vector_operators [==[--gtest_filter=test_vector_operators.orthogonal_projection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_vector_operators.orthogonal_projection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/core SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_vector_operators_TESTS test_vector_operators.lp_norm test_vector_operators.mean test_vector_operators.dot_product test_vector_operators.unit test_vector_operators.angle test_vector_operators.cross_product test_vector_operators.tangent_projection test_vector_operators.orthogonal_projection)
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_adjacency_graph"
+  "../../bin/test_adjacency_graph.pdb"
+  "CMakeFiles/test_adjacency_graph.dir/test_adjacency_graph.cpp.o"
+  "CMakeFiles/test_adjacency_graph.dir/test_adjacency_graph.cpp.o.d"
+  "test_adjacency_graph[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_adjacency_graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_adjacency_graph_compressed"
+  "../../bin/test_adjacency_graph_compressed.pdb"
+  "CMakeFiles/test_adjacency_graph_compressed.dir/test_adjacency_graph_compressed.cpp.o"
+  "CMakeFiles/test_adjacency_graph_compressed.dir/test_adjacency_graph_compressed.cpp.o.d"
+  "test_adjacency_graph_compressed[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_adjacency_graph_compressed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
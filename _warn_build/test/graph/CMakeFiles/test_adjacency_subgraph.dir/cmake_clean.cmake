@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_adjacency_subgraph"
+  "../../bin/test_adjacency_subgraph.pdb"
+  "CMakeFiles/test_adjacency_subgraph.dir/test_adjacency_subgraph.cpp.o"
+  "CMakeFiles/test_adjacency_subgraph.dir/test_adjacency_subgraph.cpp.o.d"
+  "test_adjacency_subgraph[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_adjacency_subgraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_edge"
+  "../../bin/test_edge.pdb"
+  "CMakeFiles/test_edge.dir/test_edge.cpp.o"
+  "CMakeFiles/test_edge.dir/test_edge.cpp.o.d"
+  "test_edge[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_edge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_graph_utilities"
+  "../../bin/test_graph_utilities.pdb"
+  "CMakeFiles/test_graph_utilities.dir/test_graph_utilities.cpp.o"
+  "CMakeFiles/test_graph_utilities.dir/test_graph_utilities.cpp.o.d"
+  "test_graph_utilities[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_graph_utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
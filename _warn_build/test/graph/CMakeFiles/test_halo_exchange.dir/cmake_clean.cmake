@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_halo_exchange"
+  "../../bin/test_halo_exchange.pdb"
+  "CMakeFiles/test_halo_exchange.dir/test_halo_exchange.cpp.o"
+  "CMakeFiles/test_halo_exchange.dir/test_halo_exchange.cpp.o.d"
+  "test_halo_exchange[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_halo_exchange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
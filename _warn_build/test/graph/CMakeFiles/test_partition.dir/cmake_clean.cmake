@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_partition"
+  "../../bin/test_partition.pdb"
+  "CMakeFiles/test_partition.dir/test_partition.cpp.o"
+  "CMakeFiles/test_partition.dir/test_partition.cpp.o.d"
+  "test_partition[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_partition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_reorder"
+  "../../bin/test_reorder.pdb"
+  "CMakeFiles/test_reorder.dir/test_reorder.cpp.o"
+  "CMakeFiles/test_reorder.dir/test_reorder.cpp.o.d"
+  "test_reorder[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/graph
+# Build directory: /root/repo/_warn_build/test/graph
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_warn_build/test/graph/test_adjacency_graph[1]_include.cmake")
+include("/root/repo/_warn_build/test/graph/test_adjacency_subgraph[1]_include.cmake")
+include("/root/repo/_warn_build/test/graph/test_edge[1]_include.cmake")
+include("/root/repo/_warn_build/test/graph/test_partition[1]_include.cmake")
+include("/root/repo/_warn_build/test/graph/test_reorder[1]_include.cmake")
+include("/root/repo/_warn_build/test/graph/test_graph_utilities[1]_include.cmake")
+include("/root/repo/_warn_build/test/graph/test_adjacency_graph_compressed[1]_include.cmake")
+include("/root/repo/_warn_build/test/graph/test_halo_exchange[1]_include.cmake")
@@ -0,0 +1,59 @@
+add_test([=[test_adjacency_graph.edge_list_construction]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.edge_list_construction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.edge_list_construction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.bulk_construction]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.bulk_construction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.bulk_construction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.at]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.at]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.at]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.access_operator]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.access_operator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.access_operator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.data]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.data]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.data]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.front]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.front]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.front]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.back]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.back]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.back]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.empty]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.size_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.size_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.size_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.size_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.size_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.size_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.reserve_capacity_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.reserve_capacity_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.reserve_capacity_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.reserve_capacity_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.reserve_capacity_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.reserve_capacity_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.shrink_to_fit]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.shrink_to_fit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.shrink_to_fit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.clear_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.clear_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.clear_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.clear_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.clear_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.clear_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.insert_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.insert_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.insert_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.insert_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.insert_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.insert_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.erase_if_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.erase_if_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.erase_if_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.erase_if_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.erase_if_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.erase_if_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.resize_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.resize_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.resize_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.resize_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.resize_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.resize_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.swap]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.swap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.contains_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.contains_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.contains_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.contains_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.contains_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.contains_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.degree]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.degree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.degree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.reorder_directed]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.reorder_directed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.reorder_directed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.reorder_undirected]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.reorder_undirected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.reorder_undirected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.reorder_parallel]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.reorder_parallel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.reorder_parallel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph.hash]=]  /root/repo/_warn_build/bin/test_adjacency_graph [==[--gtest_filter=test_adjacency_graph.hash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph.hash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_adjacency_graph_TESTS test_adjacency_graph.edge_list_construction test_adjacency_graph.bulk_construction test_adjacency_graph.at test_adjacency_graph.access_operator test_adjacency_graph.data test_adjacency_graph.front test_adjacency_graph.back test_adjacency_graph.empty test_adjacency_graph.size_directed test_adjacency_graph.size_undirected test_adjacency_graph.reserve_capacity_directed test_adjacency_graph.reserve_capacity_undirected test_adjacency_graph.shrink_to_fit test_adjacency_graph.clear_directed test_adjacency_graph.clear_undirected test_adjacency_graph.insert_directed test_adjacency_graph.insert_undirected test_adjacency_graph.erase_if_directed test_adjacency_graph.erase_if_undirected test_adjacency_graph.resize_directed test_adjacency_graph.resize_undirected test_adjacency_graph.swap test_adjacency_graph.contains_directed test_adjacency_graph.contains_undirected test_adjacency_graph.degree test_adjacency_graph.reorder_directed test_adjacency_graph.reorder_undirected test_adjacency_graph.reorder_parallel test_adjacency_graph.hash)
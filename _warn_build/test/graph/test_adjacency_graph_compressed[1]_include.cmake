@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/graph/test_adjacency_graph_compressed[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/graph/test_adjacency_graph_compressed[1]_tests.cmake")
+else()
+  add_test(test_adjacency_graph_compressed_NOT_BUILT test_adjacency_graph_compressed_NOT_BUILT)
+endif()
@@ -0,0 +1,7 @@
+add_test([=[test_adjacency_graph_compressed.construction]=]  /root/repo/_warn_build/bin/test_adjacency_graph_compressed [==[--gtest_filter=test_adjacency_graph_compressed.construction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph_compressed.construction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph_compressed.contains]=]  /root/repo/_warn_build/bin/test_adjacency_graph_compressed [==[--gtest_filter=test_adjacency_graph_compressed.contains]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph_compressed.contains]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_adjacency_graph_compressed.traversal]=]  /root/repo/_warn_build/bin/test_adjacency_graph_compressed [==[--gtest_filter=test_adjacency_graph_compressed.traversal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_adjacency_graph_compressed.traversal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_adjacency_graph_compressed_TESTS test_adjacency_graph_compressed.construction test_adjacency_graph_compressed.contains test_adjacency_graph_compressed.traversal)
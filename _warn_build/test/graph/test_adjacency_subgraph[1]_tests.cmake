@@ -0,0 +1,37 @@
+add_test([=[Adjacency_Subgraph.constructor_no_level]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.constructor_no_level]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.constructor_no_level]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.constructor_level]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.constructor_level]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.constructor_level]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.constructor_death]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.constructor_death]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.constructor_death]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.constructor_unsorted]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.constructor_unsorted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.constructor_unsorted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.data]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.data]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.data]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.clear]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.clear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.resize]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.resize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.swap]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.swap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.degree]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.degree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.degree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.is_local]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.is_local]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.is_local]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.is_parent]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.is_parent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.is_parent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.local_global]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.local_global]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.local_global]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.reorder]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.reorder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.reorder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.update_levels_add]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.update_levels_add]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.update_levels_add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.update_levels_remove]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.update_levels_remove]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.update_levels_remove]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.vertex_level]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.vertex_level]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.vertex_level]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.create_subgraph_list]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.create_subgraph_list]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.create_subgraph_list]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adjacency_Subgraph.update_levels_list]=]  /root/repo/_warn_build/bin/test_adjacency_subgraph [==[--gtest_filter=Adjacency_Subgraph.update_levels_list]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adjacency_Subgraph.update_levels_list]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_adjacency_subgraph_TESTS Adjacency_Subgraph.constructor_no_level Adjacency_Subgraph.constructor_level Adjacency_Subgraph.constructor_death Adjacency_Subgraph.constructor_unsorted Adjacency_Subgraph.data Adjacency_Subgraph.clear Adjacency_Subgraph.resize Adjacency_Subgraph.swap Adjacency_Subgraph.degree Adjacency_Subgraph.is_local Adjacency_Subgraph.is_parent Adjacency_Subgraph.local_global Adjacency_Subgraph.reorder Adjacency_Subgraph.update_levels_add Adjacency_Subgraph.update_levels_remove Adjacency_Subgraph.vertex_level Adjacency_Subgraph.create_subgraph_list Adjacency_Subgraph.update_levels_list)
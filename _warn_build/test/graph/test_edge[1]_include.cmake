@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/graph/test_edge[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/graph/test_edge[1]_tests.cmake")
+else()
+  add_test(test_edge_NOT_BUILT test_edge_NOT_BUILT)
+endif()
@@ -0,0 +1,3 @@
+add_test([=[test_edge.order_edge_vertex]=]  /root/repo/_warn_build/bin/test_edge [==[--gtest_filter=test_edge.order_edge_vertex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_edge.order_edge_vertex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_edge_TESTS test_edge.order_edge_vertex)
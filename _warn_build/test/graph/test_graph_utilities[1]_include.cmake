@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/graph/test_graph_utilities[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/graph/test_graph_utilities[1]_tests.cmake")
+else()
+  add_test(test_graph_utilities_NOT_BUILT test_graph_utilities_NOT_BUILT)
+endif()
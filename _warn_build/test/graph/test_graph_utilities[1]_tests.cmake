@@ -0,0 +1,23 @@
+add_test([=[test_graph_utilities.breadth_first_frontier]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.breadth_first_frontier]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.breadth_first_frontier]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.connected_components]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.connected_components]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.connected_components]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.level_traversal_single_start_vertex]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.level_traversal_single_start_vertex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.level_traversal_single_start_vertex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.level_traversal_multi_start_vertex]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.level_traversal_multi_start_vertex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.level_traversal_multi_start_vertex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.level_traversal_end_at_level]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.level_traversal_end_at_level]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.level_traversal_end_at_level]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.level_traversal_death]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.level_traversal_death]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.level_traversal_death]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.level_expansion]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.level_expansion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.level_expansion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.pseudo_peripheral_vertex]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.pseudo_peripheral_vertex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.pseudo_peripheral_vertex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.pseudo_centre_vertex]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.pseudo_centre_vertex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.pseudo_centre_vertex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.eccentricity_graph]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.eccentricity_graph]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.eccentricity_graph]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_graph_utilities.eccentricity_vertex_breadth_first]=]  /root/repo/_warn_build/bin/test_graph_utilities [==[--gtest_filter=test_graph_utilities.eccentricity_vertex_breadth_first]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_graph_utilities.eccentricity_vertex_breadth_first]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_graph_utilities_TESTS test_graph_utilities.breadth_first_frontier test_graph_utilities.connected_components test_graph_utilities.level_traversal_single_start_vertex test_graph_utilities.level_traversal_multi_start_vertex test_graph_utilities.level_traversal_end_at_level test_graph_utilities.level_traversal_death test_graph_utilities.level_expansion test_graph_utilities.pseudo_peripheral_vertex test_graph_utilities.pseudo_centre_vertex test_graph_utilities.eccentricity_graph test_graph_utilities.eccentricity_vertex_breadth_first)
@@ -0,0 +1,7 @@
+add_test([=[test_halo_exchange.create_halo_exchange_plan]=]  /root/repo/_warn_build/bin/test_halo_exchange [==[--gtest_filter=test_halo_exchange.create_halo_exchange_plan]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_halo_exchange.create_halo_exchange_plan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_halo_exchange.halo_exchange]=]  /root/repo/_warn_build/bin/test_halo_exchange [==[--gtest_filter=test_halo_exchange.halo_exchange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_halo_exchange.halo_exchange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_halo_exchange.transport_socket]=]  /root/repo/_warn_build/bin/test_halo_exchange [==[--gtest_filter=test_halo_exchange.transport_socket]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_halo_exchange.transport_socket]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_halo_exchange_TESTS test_halo_exchange.create_halo_exchange_plan test_halo_exchange.halo_exchange test_halo_exchange.transport_socket)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/graph/test_partition[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/graph/test_partition[1]_tests.cmake")
+else()
+  add_test(test_partition_NOT_BUILT test_partition_NOT_BUILT)
+endif()
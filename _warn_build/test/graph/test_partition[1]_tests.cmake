@@ -0,0 +1,13 @@
+add_test([=[test_partition.multinode_level_set_expansion]=]  /root/repo/_warn_build/bin/test_partition [==[--gtest_filter=test_partition.multinode_level_set_expansion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_partition.multinode_level_set_expansion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_partition.multilevel_graph_partition]=]  /root/repo/_warn_build/bin/test_partition [==[--gtest_filter=test_partition.multilevel_graph_partition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_partition.multilevel_graph_partition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_partition.space_filling_curve_partition]=]  /root/repo/_warn_build/bin/test_partition [==[--gtest_filter=test_partition.space_filling_curve_partition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_partition.space_filling_curve_partition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_partition.partition_metrics]=]  /root/repo/_warn_build/bin/test_partition [==[--gtest_filter=test_partition.partition_metrics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_partition.partition_metrics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_partition.recursive_graph_bisection_disjoint]=]  /root/repo/_warn_build/bin/test_partition [==[--gtest_filter=test_partition.recursive_graph_bisection_disjoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_partition.recursive_graph_bisection_disjoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LevelTraversalTest.SimpleTest]=]  /root/repo/_warn_build/bin/test_partition [==[--gtest_filter=LevelTraversalTest.SimpleTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LevelTraversalTest.SimpleTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_partition_TESTS test_partition.multinode_level_set_expansion test_partition.multilevel_graph_partition test_partition.space_filling_curve_partition test_partition.partition_metrics test_partition.recursive_graph_bisection_disjoint LevelTraversalTest.SimpleTest)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/graph/test_reorder[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/graph/test_reorder[1]_tests.cmake")
+else()
+  add_test(test_reorder_NOT_BUILT test_reorder_NOT_BUILT)
+endif()
@@ -0,0 +1,23 @@
+add_test([=[test_reorder.breadth_first]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.breadth_first]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.breadth_first]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.cuthill_mckee]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.cuthill_mckee]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.cuthill_mckee]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.cuthill_mckee_reverse]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.cuthill_mckee_reverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.cuthill_mckee_reverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.disjoint_graph]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.disjoint_graph]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.disjoint_graph]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.approximate_minimum_degree]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.approximate_minimum_degree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.approximate_minimum_degree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.nested_dissection]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.nested_dissection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.nested_dissection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.space_filling_curve]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.space_filling_curve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.space_filling_curve]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.greedy_multicolouring]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.greedy_multicolouring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.greedy_multicolouring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.jones_plassmann_colouring]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.jones_plassmann_colouring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.jones_plassmann_colouring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.interior_boundary_split]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.interior_boundary_split]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.interior_boundary_split]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_reorder.ordering_metrics]=]  /root/repo/_warn_build/bin/test_reorder [==[--gtest_filter=test_reorder.ordering_metrics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_reorder.ordering_metrics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/graph SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_reorder_TESTS test_reorder.breadth_first test_reorder.cuthill_mckee test_reorder.cuthill_mckee_reverse test_reorder.disjoint_graph test_reorder.approximate_minimum_degree test_reorder.nested_dissection test_reorder.space_filling_curve test_reorder.greedy_multicolouring test_reorder.jones_plassmann_colouring test_reorder.interior_boundary_split test_reorder.ordering_metrics)
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_direct"
+  "../../bin/test_direct.pdb"
+  "CMakeFiles/test_direct.dir/test_direct.cpp.o"
+  "CMakeFiles/test_direct.dir/test_direct.cpp.o.d"
+  "test_direct[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_direct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
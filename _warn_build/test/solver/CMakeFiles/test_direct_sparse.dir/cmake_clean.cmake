@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_direct_sparse"
+  "../../bin/test_direct_sparse.pdb"
+  "CMakeFiles/test_direct_sparse.dir/test_direct_sparse.cpp.o"
+  "CMakeFiles/test_direct_sparse.dir/test_direct_sparse.cpp.o.d"
+  "test_direct_sparse[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_direct_sparse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_solver"
+  "../../bin/test_solver.pdb"
+  "CMakeFiles/test_solver.dir/test_solver.cpp.o"
+  "CMakeFiles/test_solver.dir/test_solver.cpp.o.d"
+  "test_solver[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_solver_distributed"
+  "../../bin/test_solver_distributed.pdb"
+  "CMakeFiles/test_solver_distributed.dir/test_solver_distributed.cpp.o"
+  "CMakeFiles/test_solver_distributed.dir/test_solver_distributed.cpp.o.d"
+  "test_solver_distributed[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_solver_distributed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_solver_krylov"
+  "../../bin/test_solver_krylov.pdb"
+  "CMakeFiles/test_solver_krylov.dir/test_solver_krylov.cpp.o"
+  "CMakeFiles/test_solver_krylov.dir/test_solver_krylov.cpp.o.d"
+  "test_solver_krylov[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_solver_krylov.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../bin/test_solver_utilities"
+  "../../bin/test_solver_utilities.pdb"
+  "CMakeFiles/test_solver_utilities.dir/test_solver_utilities.cpp.o"
+  "CMakeFiles/test_solver_utilities.dir/test_solver_utilities.cpp.o.d"
+  "test_solver_utilities[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_solver_utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
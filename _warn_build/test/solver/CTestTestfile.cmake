@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/solver
+# Build directory: /root/repo/_warn_build/test/solver
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_warn_build/test/solver/test_direct[1]_include.cmake")
+include("/root/repo/_warn_build/test/solver/test_direct_sparse[1]_include.cmake")
+include("/root/repo/_warn_build/test/solver/test_solver[1]_include.cmake")
+include("/root/repo/_warn_build/test/solver/test_solver_utilities[1]_include.cmake")
+include("/root/repo/_warn_build/test/solver/test_solver_krylov[1]_include.cmake")
+include("/root/repo/_warn_build/test/solver/test_solver_distributed[1]_include.cmake")
@@ -0,0 +1,13 @@
+add_test([=[direct_solvers.lower_upper_factorisation_initialise]=]  /root/repo/_warn_build/bin/test_direct [==[--gtest_filter=direct_solvers.lower_upper_factorisation_initialise]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_solvers.lower_upper_factorisation_initialise]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_solvers.lower_upper_factorisation_death_test]=]  /root/repo/_warn_build/bin/test_direct [==[--gtest_filter=direct_solvers.lower_upper_factorisation_death_test]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_solvers.lower_upper_factorisation_death_test]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_solvers.lower_upper_factorisation_not_factorised]=]  /root/repo/_warn_build/bin/test_direct [==[--gtest_filter=direct_solvers.lower_upper_factorisation_not_factorised]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_solvers.lower_upper_factorisation_not_factorised]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_solvers.lower_upper_factorise_solve]=]  /root/repo/_warn_build/bin/test_direct [==[--gtest_filter=direct_solvers.lower_upper_factorise_solve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_solvers.lower_upper_factorise_solve]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_solvers.lower_upper_factorisation_mixed_precision]=]  /root/repo/_warn_build/bin/test_direct [==[--gtest_filter=direct_solvers.lower_upper_factorisation_mixed_precision]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_solvers.lower_upper_factorisation_mixed_precision]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_solvers.lower_upper_factorisation_blocked]=]  /root/repo/_warn_build/bin/test_direct [==[--gtest_filter=direct_solvers.lower_upper_factorisation_blocked]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_solvers.lower_upper_factorisation_blocked]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_direct_TESTS direct_solvers.lower_upper_factorisation_initialise direct_solvers.lower_upper_factorisation_death_test direct_solvers.lower_upper_factorisation_not_factorised direct_solvers.lower_upper_factorise_solve direct_solvers.lower_upper_factorisation_mixed_precision direct_solvers.lower_upper_factorisation_blocked)
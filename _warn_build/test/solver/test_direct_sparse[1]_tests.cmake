@@ -0,0 +1,13 @@
+add_test([=[direct_sparse_solvers.symbolic_factorisation]=]  /root/repo/_warn_build/bin/test_direct_sparse [==[--gtest_filter=direct_sparse_solvers.symbolic_factorisation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_sparse_solvers.symbolic_factorisation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_sparse_solvers.cholesky_factorisation_sparse]=]  /root/repo/_warn_build/bin/test_direct_sparse [==[--gtest_filter=direct_sparse_solvers.cholesky_factorisation_sparse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_sparse_solvers.cholesky_factorisation_sparse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_sparse_solvers.lower_upper_factorisation_sparse]=]  /root/repo/_warn_build/bin/test_direct_sparse [==[--gtest_filter=direct_sparse_solvers.lower_upper_factorisation_sparse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_sparse_solvers.lower_upper_factorisation_sparse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_sparse_solvers.ordering_fill_report]=]  /root/repo/_warn_build/bin/test_direct_sparse [==[--gtest_filter=direct_sparse_solvers.ordering_fill_report]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_sparse_solvers.ordering_fill_report]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_sparse_solvers.solver_wrapper]=]  /root/repo/_warn_build/bin/test_direct_sparse [==[--gtest_filter=direct_sparse_solvers.solver_wrapper]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_sparse_solvers.solver_wrapper]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[direct_sparse_solvers.direct_sparse_death_test]=]  /root/repo/_warn_build/bin/test_direct_sparse [==[--gtest_filter=direct_sparse_solvers.direct_sparse_death_test]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[direct_sparse_solvers.direct_sparse_death_test]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_direct_sparse_TESTS direct_sparse_solvers.symbolic_factorisation direct_sparse_solvers.cholesky_factorisation_sparse direct_sparse_solvers.lower_upper_factorisation_sparse direct_sparse_solvers.ordering_fill_report direct_sparse_solvers.solver_wrapper direct_sparse_solvers.direct_sparse_death_test)
@@ -0,0 +1,11 @@
+add_test([=[Laplace2DProblem.heat]=]  /root/repo/_warn_build/bin/test_solver [==[--gtest_filter=Laplace2DProblem.heat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Laplace2DProblem.heat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Laplace2DProblem.iterative_solver_test]=]  /root/repo/_warn_build/bin/test_solver [==[--gtest_filter=Laplace2DProblem.iterative_solver_test]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Laplace2DProblem.iterative_solver_test]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Laplace2DProblem.level_schedule]=]  /root/repo/_warn_build/bin/test_solver [==[--gtest_filter=Laplace2DProblem.level_schedule]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Laplace2DProblem.level_schedule]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Laplace2DProblem.wavefront_gauss_seidel]=]  /root/repo/_warn_build/bin/test_solver [==[--gtest_filter=Laplace2DProblem.wavefront_gauss_seidel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Laplace2DProblem.wavefront_gauss_seidel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Laplace2DProblem.asynchronous_relaxation]=]  /root/repo/_warn_build/bin/test_solver [==[--gtest_filter=Laplace2DProblem.asynchronous_relaxation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Laplace2DProblem.asynchronous_relaxation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_solver_TESTS Laplace2DProblem.heat Laplace2DProblem.iterative_solver_test Laplace2DProblem.level_schedule Laplace2DProblem.wavefront_gauss_seidel Laplace2DProblem.asynchronous_relaxation)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/test/solver/test_solver_distributed[1]_tests.cmake")
+  include("/root/repo/_warn_build/test/solver/test_solver_distributed[1]_tests.cmake")
+else()
+  add_test(test_solver_distributed_NOT_BUILT test_solver_distributed_NOT_BUILT)
+endif()
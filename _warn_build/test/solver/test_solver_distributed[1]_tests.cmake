@@ -0,0 +1,7 @@
+add_test([=[test_solver_distributed.distribute_matrix]=]  /root/repo/_warn_build/bin/test_solver_distributed [==[--gtest_filter=test_solver_distributed.distribute_matrix]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_solver_distributed.distribute_matrix]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_solver_distributed.distributed_solve_local]=]  /root/repo/_warn_build/bin/test_solver_distributed [==[--gtest_filter=test_solver_distributed.distributed_solve_local]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_solver_distributed.distributed_solve_local]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[test_solver_distributed.distributed_solve_socket]=]  /root/repo/_warn_build/bin/test_solver_distributed [==[--gtest_filter=test_solver_distributed.distributed_solve_socket]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[test_solver_distributed.distributed_solve_socket]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_solver_distributed_TESTS test_solver_distributed.distribute_matrix test_solver_distributed.distributed_solve_local test_solver_distributed.distributed_solve_socket)
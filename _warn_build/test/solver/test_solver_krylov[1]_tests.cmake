@@ -0,0 +1,5 @@
+add_test([=[Laplace2DSequence.conjugate_gradient]=]  /root/repo/_warn_build/bin/test_solver_krylov [==[--gtest_filter=Laplace2DSequence.conjugate_gradient]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Laplace2DSequence.conjugate_gradient]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Laplace2DSequence.conjugate_gradient_recycle]=]  /root/repo/_warn_build/bin/test_solver_krylov [==[--gtest_filter=Laplace2DSequence.conjugate_gradient_recycle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Laplace2DSequence.conjugate_gradient_recycle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_solver_krylov_TESTS Laplace2DSequence.conjugate_gradient Laplace2DSequence.conjugate_gradient_recycle)
@@ -0,0 +1,7 @@
+add_test([=[solver_utilites.update_convergence]=]  /root/repo/_warn_build/bin/test_solver_utilities [==[--gtest_filter=solver_utilites.update_convergence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[solver_utilites.update_convergence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[solver_utilites.is_converged]=]  /root/repo/_warn_build/bin/test_solver_utilities [==[--gtest_filter=solver_utilites.is_converged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[solver_utilites.is_converged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[solver_utilites.compute_residual]=]  /root/repo/_warn_build/bin/test_solver_utilities [==[--gtest_filter=solver_utilites.compute_residual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[solver_utilites.compute_residual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build/test/solver SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_solver_utilities_TESTS solver_utilites.update_convergence solver_utilites.is_converged solver_utilites.compute_residual)
@@ -24,6 +24,7 @@
 #define DISA_MATRIX_SPARSE_H
 
 #include "macros.hpp"
+#include "parallel.hpp"
 #include "scalar.hpp"
 #include "vector_dense.hpp"
 
@@ -1115,6 +1116,36 @@ Vector_Dense<Scalar, _size> operator*(const Matrix_Sparse& matrix, const Vector_
   matrix.size_row());
 }
 
+/**
+ * @brief Multiplies a contiguous range of rows of a sparse matrix and a vector, c_i = (A*b)_i for i in [begin, end).
+ * @tparam _size_result The size of the c vector, dynamic/static.
+ * @tparam _size The size of the b vector, dynamic/static.
+ * @param[in] matrix The sparse matrix, A, to be multiplied.
+ * @param[in] vector The vector, b, to multiply the matrix by.
+ * @param[in, out] result The vector, c, only the rows in the range are written.
+ * @param[in] row_range The [begin, end) range of rows to multiply.
+ *
+ * @note Splits a product into parts, e.g. computing rows independent of the halo entries of b while they are
+ *       exchanged, then the remaining rows. Rows are computed in parallel.
+ */
+template<std::size_t _size_result, std::size_t _size>
+void multiply_row_range(const Matrix_Sparse& matrix, const Vector_Dense<Scalar, _size>& vector,
+                        Vector_Dense<Scalar, _size_result>& result, const std::pair<std::size_t, std::size_t> row_range) {
+  ASSERT_DEBUG(matrix.size_column() == vector.size(),
+               "Incompatible vector-matrix dimensions, " + std::to_string(matrix.size_row()) + "," +
+               std::to_string(matrix.size_column()) + " vs. " + std::to_string(vector.size()) + ".");
+  ASSERT_DEBUG(row_range.first <= row_range.second && row_range.second <= std::min(matrix.size_row(), result.size()),
+               "Row range [" + std::to_string(row_range.first) + ", " + std::to_string(row_range.second) +
+               ") not in range [0, " + std::to_string(std::min(matrix.size_row(), result.size())) + ").");
+  parallel_for_block(row_range.second - row_range.first, [&](const std::size_t i_begin, const std::size_t i_end) {
+    FOR(i_row, row_range.first + i_begin, row_range.first + i_end) {
+      Scalar value = 0;
+      FOR_ITER(iter, *(matrix.begin() + static_cast<s_size_t>(i_row))) value += *iter * vector[iter.i_column()];
+      result[i_row] = value;
+    }
+  });
+}
+
 /**
  * @brief Adds two sparse matrices together, C = A + B, where A, B, and C are sparse matrices
  * @param[in] matrix_0 The first sparse matrix, A, to add.
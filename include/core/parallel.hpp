@@ -0,0 +1,321 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// File Name: parallel.hpp
+// Description: Light weight shared memory parallel primitives, built on the standard thread library.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef DISA_PARALLEL_H
+#define DISA_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Thread Configuration
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the user requested number of threads, zero indicating the hardware concurrency should be used.
+ * @return Reference to the (global) thread count setting.
+ */
+inline std::atomic<std::size_t>& parallel_thread_setting() {
+  static std::atomic<std::size_t> number_thread{0};
+  return number_thread;
+}
+
+/**
+ * @brief Returns true if the calling thread is already executing within a parallel region.
+ * @return Reference to the (thread local) flag.
+ */
+inline bool& parallel_active() {
+  thread_local bool active{false};
+  return active;
+}
+
+/**
+ * @brief Returns the number of threads the parallel algorithms of Disa will use.
+ * @return The number of threads, at least 1. Calls from within a parallel region always return 1.
+ */
+[[nodiscard]] inline std::size_t parallel_thread_count() {
+  if(parallel_active()) return 1;
+  const std::size_t setting = parallel_thread_setting().load(std::memory_order_relaxed);
+  if(setting) return setting;
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+/**
+ * @brief Sets the number of threads the parallel algorithms of Disa will use.
+ * @param[in] number_thread The number of threads, zero resets to the hardware concurrency.
+ */
+inline void parallel_thread_count_set(const std::size_t number_thread) {
+  parallel_thread_setting().store(number_thread, std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Thread Pool
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief A persistent team of worker threads, on which the parallel regions of Disa are executed.
+ *
+ * Creating a team of threads for every region dominates the cost of short regions, e.g. the per sweep regions of the
+ * wavefront Gauss-Seidel solver. The workers are therefore created on first use, grown to the largest team requested,
+ * and parked on a condition variable between regions. Only one region executes on the pool at a time.
+ */
+class Thread_Pool {
+ public:
+  /**
+   * @brief Returns the process wide pool.
+   * @return Reference to the pool.
+   *
+   * @details The child of a fork inherits a copy of the pool, but none of its worker threads. The copy is therefore
+   * abandoned (never destroyed, as it cannot be joined) and a new pool created in the child.
+   */
+  static Thread_Pool& instance() {
+    static std::mutex mutex;
+    static std::unique_ptr<Thread_Pool> pool;
+    std::scoped_lock lock(mutex);
+#if defined(__unix__) || defined(__APPLE__)
+    static pid_t owner = getpid();
+    if(owner != getpid()) {
+      static_cast<void>(pool.release());
+      owner = getpid();
+    }
+#endif
+    if(!pool) pool = std::make_unique<Thread_Pool>();
+    return *pool;
+  }
+
+  /**
+   * @brief Stops and joins the workers.
+   */
+  ~Thread_Pool() {
+    {
+      std::scoped_lock lock(mutex);
+      stop = true;
+    }
+    wake.notify_all();
+  }
+
+  /**
+   * @brief Executes a function on a team of threads, the calling thread participating as thread 0.
+   * @tparam _function Callable with signature void(std::size_t i_thread, std::size_t number_thread).
+   * @param[in] number_thread The size of the thread team, greater than 1.
+   * @param[in] function The function to execute.
+   * @return True if the function was executed, false if the pool is busy with another region.
+   */
+  template<class _function>
+  [[nodiscard]] bool run(const std::size_t number_thread, const _function& function) {
+    std::unique_lock region(region_mutex, std::try_to_lock);
+    if(!region.owns_lock()) return false;
+    {
+      std::scoped_lock lock(mutex);
+      while(worker.size() < number_thread - 1)
+        worker.emplace_back(&Thread_Pool::work, this, worker.size(), generation);
+      task = [](const void* context, const std::size_t i_thread, const std::size_t number_thread) {
+        (*static_cast<const _function*>(context))(i_thread, number_thread);
+      };
+      context = &function;
+      team_size = number_thread;
+      remaining = number_thread - 1;
+      ++generation;
+    }
+    wake.notify_all();
+    const auto wait = [&] {
+      std::unique_lock lock(mutex);
+      done.wait(lock, [&] { return remaining == 0; });
+    };
+    try {
+      function(0, number_thread);
+    } catch(...) {
+      wait();  // The workers reference the function, so must finish before the stack unwinds.
+      throw;
+    }
+    wait();
+    return true;
+  }
+
+ private:
+  /**
+   * @brief The worker loop, executing its share of each region it is part of the team for.
+   * @param[in] i_worker The index of the worker, the worker is thread i_worker + 1 of the team.
+   * @param[in] seen The region generation at the creation of the worker.
+   */
+  void work(const std::size_t i_worker, std::size_t seen) {
+    std::unique_lock lock(mutex);
+    while(true) {
+      wake.wait(lock, [&] { return stop || generation != seen; });
+      if(stop) return;
+      seen = generation;
+      if(i_worker + 1 >= team_size) continue;
+      const auto region_task = task;
+      const void* region_context = context;
+      const std::size_t region_size = team_size;
+      lock.unlock();
+      region_task(region_context, i_worker + 1, region_size);
+      lock.lock();
+      if(--remaining == 0) done.notify_one();
+    }
+  }
+
+  std::mutex region_mutex;                                       //!< Held by the thread dispatching a region.
+  std::mutex mutex;                                              //!< Guards the region state below.
+  std::condition_variable wake;                                  //!< Signals the workers of a new region (or stop).
+  std::condition_variable done;                                  //!< Signals the dispatcher the workers are done.
+  void (*task)(const void*, std::size_t, std::size_t){nullptr};  //!< Type erased invoker of the region function.
+  const void* context{nullptr};                                  //!< The region function.
+  std::size_t team_size{0};                                      //!< The size of the team of the current region.
+  std::size_t remaining{0};                                      //!< Number of workers yet to finish the region.
+  std::size_t generation{0};                                     //!< Incremented for every region.
+  bool stop{false};                                              //!< Set to stop the workers.
+  std::vector<std::jthread> worker;                              //!< The workers, destroyed (joined) first.
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Parallel Primitives
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Executes a function on a team of threads, the calling thread participating as thread 0.
+ * @tparam _function Callable with signature void(std::size_t i_thread, std::size_t number_thread).
+ * @param[in] number_thread The size of the thread team.
+ * @param[in] function The function to execute.
+ *
+ * @details Nested regions are serialised, i.e. parallel primitives called from within the region execute on the
+ * calling thread only. This prevents over-subscription when parallel algorithms are composed. Regions execute on the
+ * persistent Thread_Pool, a region started while the pool is busy (e.g. from another user thread) executes on a
+ * temporary team instead.
+ */
+template<class _function>
+void parallel_region(const std::size_t number_thread, const _function& function) {
+  const auto execute = [&](const std::size_t i_thread, const std::size_t) {
+    const bool active = parallel_active();
+    parallel_active() = true;
+    function(i_thread, number_thread);
+    parallel_active() = active;
+  };
+  if(number_thread <= 1) {
+    execute(0, 1);
+    return;
+  }
+  if(Thread_Pool::instance().run(number_thread, execute)) return;
+  std::vector<std::jthread> team;
+  team.reserve(number_thread - 1);
+  for(std::size_t i_thread = 1; i_thread < number_thread; ++i_thread) {
+    team.emplace_back(execute, i_thread, number_thread);
+  }
+  execute(0, number_thread);
+}
+
+/**
+ * @brief Returns the [begin, end) range of a thread's share of a statically scheduled (block) loop.
+ * @param[in] size The number of loop iterations.
+ * @param[in] i_thread The index of the thread.
+ * @param[in] number_thread The number of threads.
+ * @return Pair of the begin and end indices.
+ */
+[[nodiscard]] inline std::pair<std::size_t, std::size_t> parallel_block(const std::size_t size, const std::size_t i_thread,
+                                                                        const std::size_t number_thread) {
+  const std::size_t quotient = size / number_thread;
+  const std::size_t remainder = size % number_thread;
+  const std::size_t begin = i_thread * quotient + std::min(i_thread, remainder);
+  return {begin, begin + quotient + (i_thread < remainder ? 1 : 0)};
+}
+
+/**
+ * @brief Statically scheduled parallel loop over contiguous blocks of [0, size).
+ * @tparam _function Callable with signature void(std::size_t i_begin, std::size_t i_end).
+ * @param[in] size The number of loop iterations.
+ * @param[in] function The function to execute on each block.
+ * @param[in] grain The minimum number of iterations per thread, small loops are executed serially.
+ */
+template<class _function>
+void parallel_for_block(const std::size_t size, const _function& function, const std::size_t grain = 1024) {
+  const std::size_t number_thread = std::min(parallel_thread_count(), std::max<std::size_t>(size / grain, 1));
+  if(number_thread == 1) {
+    function(std::size_t(0), size);
+    return;
+  }
+  parallel_region(number_thread, [&](const std::size_t i_thread, const std::size_t number_thread) {
+    const auto [i_begin, i_end] = parallel_block(size, i_thread, number_thread);
+    function(i_begin, i_end);
+  });
+}
+
+/**
+ * @brief Statically scheduled parallel loop over [0, size).
+ * @tparam _function Callable with signature void(std::size_t index).
+ * @param[in] size The number of loop iterations.
+ * @param[in] function The loop body.
+ * @param[in] grain The minimum number of iterations per thread, small loops are executed serially.
+ */
+template<class _function>
+void parallel_for(const std::size_t size, const _function& function, const std::size_t grain = 1024) {
+  parallel_for_block(
+  size,
+  [&](const std::size_t i_begin, const std::size_t i_end) {
+    for(std::size_t index = i_begin; index < i_end; ++index) function(index);
+  },
+  grain);
+}
+
+/**
+ * @brief Parallel in place inclusive prefix sum, giving the same result as std::partial_sum.
+ * @tparam _type The (arithmetic) value type.
+ * @param[in, out] data The values, on exit each the sum of itself and all preceding values.
+ * @param[in] grain The minimum number of values per thread, small ranges are summed serially.
+ *
+ * @details Each thread sums its own block, the block totals are then summed serially and each thread adds the total of
+ * the preceding blocks to its own. For integer types the result is therefore exactly that of the serial sum.
+ */
+template<class _type>
+void parallel_partial_sum(std::vector<_type>& data, const std::size_t grain = 65536) {
+  const std::size_t number_thread = std::min(parallel_thread_count(), std::max<std::size_t>(data.size() / grain, 1));
+  if(number_thread == 1) {
+    std::partial_sum(data.begin(), data.end(), data.begin());
+    return;
+  }
+  std::vector<_type> block_sum(number_thread, _type(0));
+  parallel_region(number_thread, [&](const std::size_t i_thread, const std::size_t number_thread) {
+    const auto [i_begin, i_end] = parallel_block(data.size(), i_thread, number_thread);
+    std::partial_sum(data.begin() + i_begin, data.begin() + i_end, data.begin() + i_begin);
+    if(i_begin != i_end) block_sum[i_thread] = data[i_end - 1];
+  });
+  std::partial_sum(block_sum.begin(), block_sum.end(), block_sum.begin());
+  parallel_region(number_thread, [&](const std::size_t i_thread, const std::size_t number_thread) {
+    if(i_thread == 0) return;
+    const auto [i_begin, i_end] = parallel_block(data.size(), i_thread, number_thread);
+    for(std::size_t index = i_begin; index < i_end; ++index) data[index] += block_sum[i_thread - 1];
+  });
+}
+
+}  // namespace Disa
+
+#endif  //DISA_PARALLEL_H
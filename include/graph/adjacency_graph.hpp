@@ -24,8 +24,12 @@
 
 #include "edge.hpp"
 #include "macros.hpp"
+#include "parallel.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <numeric>
@@ -34,6 +38,49 @@
 
 namespace Disa {
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Hash_Cache
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Hash_Cache
+ * @brief A lazily computed hash value, which may be filled from concurrent const member functions.
+ *
+ * @details Zero marks a value not yet computed. Copies take the value, while moves also reset the moved from cache, as
+ * the moved from container no longer holds the hashed content.
+ */
+struct Hash_Cache {
+  std::atomic<std::size_t> value{0};  //!< The cached hash, zero if not computed.
+
+  Hash_Cache() = default;
+  Hash_Cache(const Hash_Cache& other) noexcept : value(other.value.load(std::memory_order_acquire)) {}
+  Hash_Cache(Hash_Cache&& other) noexcept : value(other.value.exchange(0, std::memory_order_acq_rel)) {}
+  Hash_Cache& operator=(const Hash_Cache& other) noexcept {
+    value.store(other.value.load(std::memory_order_acquire), std::memory_order_release);
+    return *this;
+  }
+  Hash_Cache& operator=(Hash_Cache&& other) noexcept {
+    value.store(other.value.exchange(0, std::memory_order_acq_rel), std::memory_order_release);
+    return *this;
+  }
+  ~Hash_Cache() = default;
+
+  /**
+   * @brief Marks the value as not computed, to be called on any change to the hashed content.
+   */
+  inline void invalidate() noexcept { value.store(0, std::memory_order_release); }
+
+  /**
+   * @brief Swaps the cached values of two caches.
+   * @param[in, out] other The other cache.
+   */
+  inline void swap(Hash_Cache& other) noexcept {
+    const std::size_t temp = value.load(std::memory_order_acquire);
+    value.store(other.value.load(std::memory_order_acquire), std::memory_order_release);
+    other.value.store(temp, std::memory_order_release);
+  }
+};
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Adjacency_Graph
 // ---------------------------------------------------------------------------------------------------------------------
@@ -86,11 +133,27 @@ class Adjacency_Graph {
   /**
    * @brief Construction via a list of edges connecting two vertices i and j, where i != j.
    * @param[in] edge_graph The list of edge.
-   *
-   * @note At preset this is not writen efficiently, and can be improved, mainly used for testing.
    */
   Adjacency_Graph(std::initializer_list<Edge> edge_graph);
 
+  /**
+   * @brief Bulk construction from a range of edges connecting two vertices i and j, where i != j, in O(V + E).
+   * @param[in] edge_graph The edges, in any order and possibly repeated.
+   * @param[in] number_vertices The minimum number of vertices, the graph is grown to fit the largest edge index.
+   */
+  explicit Adjacency_Graph(std::span<const Edge> edge_graph, std::size_t number_vertices = 0);
+
+  /**
+   * @brief Bulk construction from a compressed (CSR like) vertex to neighbour list, in O(V + E).
+   * @param[in] vertex_offset The start of each vertex's neighbours in vertex_adjacency, size is one greater than the
+   *                          number of vertices.
+   * @param[in] vertex_adjacency The neighbours of each vertex, in any order and possibly repeated.
+   *
+   * @note Self connections (i, i) are dropped, so the sparsity pattern of a matrix can be passed directly. For an
+   *       undirected graph the neighbours need not be symmetric, each (i, j) also inserts (j, i).
+   */
+  Adjacency_Graph(std::span<const std::size_t> vertex_offset, std::span<const std::size_t> vertex_adjacency);
+
   /**
    * @brief Default destructor.
    */
@@ -131,6 +194,7 @@ class Adjacency_Graph {
   [[nodiscard]] inline std::span<std::size_t> operator[](const std::size_t& i_vertex) {
     ASSERT_DEBUG(i_vertex < size_vertex(),
                  "Vertex index " + std::to_string(i_vertex) + " not in range [0, " + std::to_string(i_vertex) + ").");
+    hash_cache.invalidate();
     return {vertex_adjacent_list.begin() + static_cast<s_size_t>(offset[i_vertex]),
             offset[i_vertex + 1] - offset[i_vertex]};
   }
@@ -180,6 +244,7 @@ class Adjacency_Graph {
     *       are returned.
     */
   [[nodiscard]] inline std::pair<std::size_t*, std::size_t*> data() noexcept {
+    hash_cache.invalidate();
     if(empty()) return std::make_pair(nullptr, nullptr);
     else if(vertex_adjacent_list.empty()) return std::make_pair(nullptr, offset.data());
     else return std::make_pair(vertex_adjacent_list.data(), offset.data());
@@ -254,6 +319,7 @@ class Adjacency_Graph {
   inline void clear() noexcept {
     vertex_adjacent_list.clear();
     offset.clear();
+    hash_cache.invalidate();
   }
 
   /**
@@ -288,6 +354,7 @@ class Adjacency_Graph {
   inline void swap(Adjacency_Graph& graph_other) {
     vertex_adjacent_list.swap(graph_other.vertex_adjacent_list);
     offset.swap(graph_other.offset);
+    hash_cache.swap(graph_other.hash_cache);
   }
 
   // -------------------------------------------------------------------------------------------------------------------
@@ -323,6 +390,15 @@ class Adjacency_Graph {
    */
   Adjacency_Graph reorder(const std::vector<std::size_t>& permutation);
 
+  /**
+   * @brief Returns a hash of the full content of the graph, computed on first use and cached until the graph changes.
+   * @return The hash, zero for all empty graphs.
+   *
+   * @note Any modifier, or non-const element access, invalidates the cached value. Equal graphs give equal hashes, so
+   *       it may be used as a key for data derived from the graph, e.g. its orderings, partitions or factorisations.
+   */
+  [[nodiscard]] std::size_t hash() const;
+
   // -------------------------------------------------------------------------------------------------------------------
   // Private Members
   // -------------------------------------------------------------------------------------------------------------------
@@ -330,6 +406,7 @@ class Adjacency_Graph {
  protected:
   std::vector<std::size_t> vertex_adjacent_list;  //!< Single contiguous list of all vertex adjacency for the graph.
   std::vector<std::size_t> offset;                //!< List pointing to the start of each vertex's adjacency graph.
+  mutable Hash_Cache hash_cache;                  //!< The cached content hash.
 
   // -------------------------------------------------------------------------------------------------------------------
   // Helper Functions
@@ -355,6 +432,16 @@ class Adjacency_Graph {
    *          offset vector is not upto date this operation produces undefined behaviour.
    */
   void insert_vertex_adjacent_list(std::size_t vertex, std::size_t insert_vertex);
+
+  /**
+   * @brief Builds the graph from a sequence of edges, by counting, scattering, then sorting each adjacency.
+   * @tparam _edge_visitor Callable with signature void(auto function), calling function(i_vertex, j_vertex) for each
+   *                       edge.
+   * @param[in] number_vertices The number of vertices in the graph, all edge indices must be less than this.
+   * @param[in] visit_edge The edge visitor, called twice, so it must visit the same edges each time.
+   */
+  template<class _edge_visitor>
+  void construct(std::size_t number_vertices, const _edge_visitor& visit_edge);
 };
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -379,23 +466,49 @@ std::ostream& operator<<(std::ostream& ostream, const Adjacency_Graph<_directed>
 // ---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @details Initializes an Adjacency_Graph object with the edges in the given initializer list. The constructor finds
- * the vertex with the highest index to determine a suitable reserve for the graph in the provided edge list. Each edge
- * is then inserted into the edge and any excess reserve memory removed.
+ * @details Forwards the list to the bulk edge constructor.
+ */
+template<bool _directed>
+Adjacency_Graph<_directed>::Adjacency_Graph(std::initializer_list<Edge> edge_graph)
+    : Adjacency_Graph(std::span<const Edge>(edge_graph.begin(), edge_graph.size())) {}
+
+/**
+ * @details The number of vertices is found from the largest edge index, after which the graph is built by construct.
  */
 template<bool _directed>
-Adjacency_Graph<_directed>::Adjacency_Graph(std::initializer_list<Edge> edge_graph) {
-  const auto iter = std::max_element(edge_graph.begin(), edge_graph.end(),
-                                     !_directed ?
-                                      [](const Edge& edge_0, const Edge& edge_1) {
-                                          return order_edge_vertex(&edge_0).second < order_edge_vertex(&edge_1).second;
-                                        } :
-                                      [](const Edge& edge_0, const Edge& edge_1) {
-                                          return edge_0.second < edge_1.second;
-                                        });
-  reserve(!_directed ? std::max(iter->first, iter->second) : iter->first, edge_graph.size());
-  FOR_EACH(edge, edge_graph) insert(edge);
-  shrink_to_fit();
+Adjacency_Graph<_directed>::Adjacency_Graph(std::span<const Edge> edge_graph, std::size_t number_vertices) {
+  FOR_EACH(edge, edge_graph) number_vertices = std::max(number_vertices, std::max(edge.first, edge.second) + 1);
+  construct(number_vertices, [&](const auto& function) {
+    FOR_EACH(edge, edge_graph) {
+      ASSERT_DEBUG(edge.first != edge.second, "Edge vertices identical, " + std::to_string(edge.first) + " and " +
+                                              std::to_string(edge.second) + ".");
+      function(edge.first, edge.second);
+    }
+  });
+}
+
+/**
+ * @details Each neighbour j of vertex i, j != i, is treated as the edge (i, j), after which the graph is built by
+ * construct.
+ */
+template<bool _directed>
+Adjacency_Graph<_directed>::Adjacency_Graph(std::span<const std::size_t> vertex_offset,
+                                            std::span<const std::size_t> vertex_adjacency) {
+  ASSERT(!vertex_offset.empty(), "The vertex offsets must contain at least one entry.");
+  ASSERT(vertex_offset.back() == vertex_adjacency.size(),
+         "Vertex offsets end at " + std::to_string(vertex_offset.back()) + ", but there are " +
+         std::to_string(vertex_adjacency.size()) + " neighbours.");
+  const std::size_t number_vertices = vertex_offset.size() - 1;
+  ASSERT(std::all_of(vertex_adjacency.begin(), vertex_adjacency.end(),
+                     [&](const std::size_t i_vertex) { return i_vertex < number_vertices; }),
+         "A neighbour is not in the vertex range [0, " + std::to_string(number_vertices) + ").");
+  construct(number_vertices, [&](const auto& function) {
+    FOR(i_vertex, number_vertices) {
+      FOR(i_entry, vertex_offset[i_vertex], vertex_offset[i_vertex + 1]) {
+        if(vertex_adjacency[i_entry] != i_vertex) function(i_vertex, vertex_adjacency[i_entry]);
+      }
+    }
+  });
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -416,6 +529,7 @@ bool Adjacency_Graph<_directed>::insert(const Edge& edge) {
 
   // Preliminaries check if the edge exists, then determine if we need to resize.
   if(contains(edge)) return false;
+  hash_cache.invalidate();
   const auto& [i_first_vertex, i_second_vertex] =
   !_directed ? order_edge_vertex(&edge) : std::pair<const std::size_t&, const std::size_t&>({edge.first, edge.second});
   if(std::max(i_first_vertex, i_second_vertex) >= size_vertex()) resize(std::max(i_first_vertex, i_second_vertex) + 1);
@@ -446,6 +560,7 @@ template<bool _directed>
 template<class _unary_predicate>
 void Adjacency_Graph<_directed>::erase_if(_unary_predicate delete_vertex) {
 
+  hash_cache.invalidate();
   std::size_t removed = 0;
   std::size_t i_vertex = 0;
   std::vector<bool> adjacency_delete(vertex_adjacent_list.size(), false);
@@ -499,6 +614,7 @@ void Adjacency_Graph<_directed>::erase_if(_unary_predicate delete_vertex) {
  */
 template<bool _directed>
 void Adjacency_Graph<_directed>::resize(const std::size_t& size) {
+  hash_cache.invalidate();
 
   // Branch based on expansion or contraction of the graph.
   if(size_vertex() < size) {
@@ -549,11 +665,12 @@ template<bool _directed>
 
 /**
  * @details To begin new memory is allocated for a new graph. First the offsets for the new graph of determined by
- * computing and storing the offset for each old vertex and storing it in the new vertex position, and then by summing
- * the preceding offsets to obtain the new offset for each vertex. The new vertex lists are populated by coping and
- * renumbering the old vertex list's data to the new positions, using both the permutation vector and the newly computed
- * offsets. Each must also be resorted in an ascending fashion. Finally, the new graph is swapped with the current and
- * returned.
+ * computing and storing the degree of each old vertex in the new vertex position, and then by a (parallel) prefix sum
+ * to obtain the new offset for each vertex. The new vertex lists are populated by coping and renumbering the old vertex
+ * list's data to the new positions, using both the permutation vector and the newly computed offsets. Each must also
+ * be resorted in an ascending fashion. Each new vertex is written by exactly one old vertex, so both the degree and
+ * copy passes run in parallel over the old vertices, and the result is independent of the number of threads. Finally,
+ * the new graph is swapped with the current and returned.
  */
 template<bool _directed>
 Adjacency_Graph<_directed> Adjacency_Graph<_directed>::reorder(const std::vector<std::size_t>& permutation) {
@@ -572,30 +689,127 @@ Adjacency_Graph<_directed> Adjacency_Graph<_directed>::reorder(const std::vector
   // Set up the offsets for the new graph.
   if(!empty()) {
     graph.offset[0] = 0;
-    FOR(i_old, size_vertex()) graph.offset[permutation[i_old] + 1] = offset[i_old + 1] - offset[i_old];
-    FOR(i_new, size_vertex()) graph.offset[i_new + 1] += graph.offset[i_new];
+    parallel_for(size_vertex(), [&](const std::size_t i_old) {
+      graph.offset[permutation[i_old] + 1] = offset[i_old + 1] - offset[i_old];
+    });
+    parallel_partial_sum(graph.offset);
   }
 
   // Populate the new graph using the reorder mapping.
-  FOR(i_old, size_vertex()) {
+  parallel_for(size_vertex(), [&](const std::size_t i_old) {
     const std::size_t& i_new = permutation[i_old];
     auto adjacency_iter = vertex_adjacency_iter(i_old);
     std::transform(adjacency_iter.first, adjacency_iter.second,
                    std::next(graph.vertex_adjacent_list.begin(), static_cast<s_size_t>(graph.offset[i_new])),
-                   [permutation](const std::size_t& i_old) { return permutation[i_old]; });
+                   [&permutation](const std::size_t& i_old) { return permutation[i_old]; });
     adjacency_iter = graph.vertex_adjacency_iter(i_new);
     std::sort(adjacency_iter.first, adjacency_iter.second);
-  }
+  });
 
   // swap class data and return.
   this->swap(graph);
   return graph;
 }
 
+/**
+ * @details The offsets followed by the adjacency list are hashed as one sequence, using the rounds and avalanche of
+ * xxHash64. The sequence is cut into fixed size chunks, hashed in parallel, and the chunk hashes then combined in
+ * order, so the hash does not depend on the number of threads. The result is cached, a zero marking it as not
+ * computed, so a hash of zero is mapped to one.
+ */
+template<bool _directed>
+std::size_t Adjacency_Graph<_directed>::hash() const {
+  if(empty()) return 0;  // All empty graphs are considered identical.
+  std::size_t value = hash_cache.value.load(std::memory_order_acquire);
+  if(value != 0) return value;
+
+  constexpr std::uint64_t prime_1 = 0x9E3779B185EBCA87ull;
+  constexpr std::uint64_t prime_2 = 0xC2B2AE3D27D4EB4Full;
+  constexpr std::uint64_t prime_3 = 0x165667B19E3779F9ull;
+  constexpr std::uint64_t prime_5 = 0x27D4EB2F165667C5ull;
+  const auto round = [](const std::uint64_t accumulator, const std::uint64_t input) {
+    return std::rotl(accumulator + input * prime_2, 31) * prime_1;
+  };
+  const auto avalanche = [](std::uint64_t hash) {
+    hash = (hash ^ (hash >> 33)) * prime_2;
+    hash = (hash ^ (hash >> 29)) * prime_3;
+    return hash ^ (hash >> 32);
+  };
+
+  const std::size_t size = offset.size() + vertex_adjacent_list.size();
+  const std::size_t chunk_size = 4096;
+  std::vector<std::uint64_t> chunk_hash((size + chunk_size - 1) / chunk_size);
+  parallel_for(
+  chunk_hash.size(),
+  [&](const std::size_t i_chunk) {
+    std::uint64_t accumulator = prime_5 + i_chunk * prime_1;
+    FOR(index, i_chunk * chunk_size, std::min(size, (i_chunk + 1) * chunk_size)) {
+      const std::size_t entry = index < offset.size() ? offset[index] : vertex_adjacent_list[index - offset.size()];
+      accumulator = round(accumulator, entry);
+    }
+    chunk_hash[i_chunk] = avalanche(accumulator);
+  },
+  4);
+  std::uint64_t accumulator = prime_5 + offset.size() * prime_3 + (_directed ? prime_1 : 0);
+  FOR_EACH(hash, chunk_hash) accumulator = round(accumulator, hash);
+  value = static_cast<std::size_t>(avalanche(accumulator));
+  if(value == 0) value = 1;
+  hash_cache.value.store(value, std::memory_order_release);
+  return value;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Helper Functions
 // ---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @details Degrees are counted and prefix summed into the offsets, after which each edge is scattered into its
+ * vertices' adjacency (both for undirected graphs). Each adjacency is then sorted and de-duplicated in parallel, and
+ * if duplicates were removed the adjacency list is compacted, again in parallel. The result is identical to inserting
+ * each edge in turn, but in O(V + E) (plus the per vertex sorts) rather than O(E^2).
+ */
+template<bool _directed>
+template<class _edge_visitor>
+void Adjacency_Graph<_directed>::construct(const std::size_t number_vertices, const _edge_visitor& visit_edge) {
+  clear();
+  if(number_vertices == 0) return;
+
+  // Count and scatter.
+  offset.assign(number_vertices + 1, 0);
+  visit_edge([&](const std::size_t i_vertex, const std::size_t j_vertex) {
+    ++offset[i_vertex + 1];
+    if(!_directed) ++offset[j_vertex + 1];
+  });
+  parallel_partial_sum(offset);
+  vertex_adjacent_list.resize(offset.back());
+  std::vector<std::size_t> position(offset.begin(), offset.end() - 1);
+  visit_edge([&](const std::size_t i_vertex, const std::size_t j_vertex) {
+    vertex_adjacent_list[position[i_vertex]++] = j_vertex;
+    if(!_directed) vertex_adjacent_list[position[j_vertex]++] = i_vertex;
+  });
+
+  // Sort and de-duplicate each adjacency, position now holds the de-duplicated degree.
+  parallel_for(number_vertices, [&](const std::size_t i_vertex) {
+    const auto [begin, end] = vertex_adjacency_iter(i_vertex);
+    std::sort(begin, end);
+    position[i_vertex] = static_cast<std::size_t>(std::distance(begin, std::unique(begin, end)));
+  });
+
+  // Compact, if there were duplicates.
+  std::size_t size_unique = 0;
+  FOR_EACH(degree, position) size_unique += degree;
+  if(size_unique == vertex_adjacent_list.size()) return;
+  std::vector<std::size_t> offset_unique(number_vertices + 1, 0);
+  std::partial_sum(position.begin(), position.end(), offset_unique.begin() + 1);
+  std::vector<std::size_t> adjacent_unique(size_unique);
+  parallel_for(number_vertices, [&](const std::size_t i_vertex) {
+    std::copy_n(vertex_adjacent_list.begin() + static_cast<s_size_t>(offset[i_vertex]), position[i_vertex],
+                adjacent_unique.begin() + static_cast<s_size_t>(offset_unique[i_vertex]));
+  });
+  offset.swap(offset_unique);
+  vertex_adjacent_list.swap(adjacent_unique);
+}
+
 /**
  * @details This function inserts a new vertex into the adjacency list of the specified vertex in the graph. If the
  * inserted vertex is already present in the adjacency list, this function does nothing.
@@ -659,20 +873,13 @@ struct hash<Disa::Adjacency_Graph<_directed>> {
 };
 
 /**
- * @details Specialization of the std::hash template for the Disa::Adjacency_Graph class. It calculates a hash value for
- * the adjacency graph by XORing the hash values of its size, number of edges, and sizes of its first and last vertices.
- * If the graph is empty, the hash value is set to zero.
+ * @details Specialization of the std::hash template for the Disa::Adjacency_Graph class. Returns the graph's cached
+ * content hash, see Adjacency_Graph::hash. If the graph is empty, the hash value is zero.
  */
 template<bool _directed>
 std::size_t hash<Disa::Adjacency_Graph<_directed>>::operator()(
 const Disa::Adjacency_Graph<_directed>& graph) const noexcept {
-  if(graph.empty()) return 0;  // All empty graphs are considered identical.
-  std::size_t hashValue = 0;
-  hashValue ^= std::hash<std::size_t>{}(graph.size_vertex());
-  hashValue ^= std::hash<std::size_t>{}(graph.size_edge());
-  hashValue ^= std::hash<std::size_t>{}(graph.front().size());
-  hashValue ^= std::hash<std::size_t>{}(graph.back().size());
-  return hashValue;
+  return graph.hash();
 }
 
 }  // namespace std
@@ -0,0 +1,504 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ---------------------------------------------------------------------------------------------------------------------
+// File Name: adjacency_graph_compressed.hpp
+// Description: Contains the declaration and definitions for a read only, byte compressed, adjacency graph for Disa.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef DISA_ADJACENCY_GRAPH_COMPRESSED_H
+#define DISA_ADJACENCY_GRAPH_COMPRESSED_H
+
+#include "adjacency_graph.hpp"
+#include "macros.hpp"
+#include "parallel.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Adjacency_Graph_Compressed
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @class Adjacency_Graph_Compressed
+ * @brief A read only graph G(V, E), storing each vertex's sorted adjacency as a delta encoded variable length byte
+ *        stream.
+ *
+ * @details
+ * Each vertex's adjacency is written as its degree, then the zigzag encoded difference of the first neighbour to the
+ * vertex, then the gap to each following neighbour less one (the adjacency is sorted and unique, so gaps are at least
+ * one). Every value is a LEB128 varint, 7 bits per byte with the high bit marking a continuation, so neighbours with
+ * nearby indices, the norm after a bandwidth reducing reordering, take a single byte rather than the eight of
+ * Adjacency_Graph. Vertex offsets into the byte stream are stored as a 64 bit offset per block of 64 vertices, plus a
+ * 32 bit offset of each vertex within its block.
+ *
+ * Element access returns a lightweight range which decodes the neighbours as it is iterated, so the graph can be passed
+ * to the graph utilities (breadth first searches, level traversals, etc.) in place of an Adjacency_Graph. As the graph
+ * is read only, it is built once, either from an Adjacency_Graph or directly from a sorted compressed row list.
+ *
+ * @note Neighbours are decoded on the fly, so there is no random access within an adjacency, i.e. no operator[] or
+ *       back() on the returned range.
+ */
+template<bool _directed>
+class Adjacency_Graph_Compressed {
+
+ public:
+  // -------------------------------------------------------------------------------------------------------------------
+  // Adjacency Range
+  // -------------------------------------------------------------------------------------------------------------------
+
+  /**
+   * @class iterator
+   * @brief Forward iterator over a single vertex's adjacency, decoding each neighbour as it is advanced.
+   */
+  class iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;  //!< Multi-pass, but values are returned by value.
+    using iterator_category = std::input_iterator_tag;   //!< Legacy category, as reference is not a true reference.
+    using value_type = std::size_t;                      //!< The neighbour vertex index type.
+    using difference_type = std::ptrdiff_t;              //!< Difference type, required for the iterator concepts.
+    using reference = std::size_t;                       //!< Neighbours are decoded, so returned by value.
+
+    iterator() = default;
+
+    /**
+     * @brief Constructs the iterator at the start of a vertex's encoded adjacency.
+     * @param[in] i_vertex The vertex index, the first neighbour is encoded relative to it.
+     * @param[in] position Pointer to the vertex's encoded adjacency, starting at its degree.
+     */
+    iterator(const std::size_t i_vertex, const std::uint8_t* position) : byte(position) {
+      remaining = decode(byte);
+      if(remaining != 0) vertex = i_vertex + unzigzag(decode(byte));
+    }
+
+    [[nodiscard]] inline std::size_t operator*() const noexcept { return vertex; }
+
+    inline iterator& operator++() noexcept {
+      if(--remaining != 0) vertex += decode(byte) + 1;
+      return *this;
+    }
+
+    inline iterator operator++(int) noexcept {
+      iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    [[nodiscard]] inline bool operator==(const iterator& other) const noexcept {
+      return remaining == other.remaining && (remaining == 0 || byte == other.byte);
+    }
+
+    [[nodiscard]] inline bool operator==(std::default_sentinel_t) const noexcept { return remaining == 0; }
+
+   private:
+    const std::uint8_t* byte{nullptr};  //!< The next undecoded byte.
+    std::size_t remaining{0};           //!< The number of neighbours left, including the current.
+    std::size_t vertex{0};              //!< The current, decoded, neighbour.
+  };
+
+  /**
+   * @class Adjacency
+   * @brief A view of a single vertex's adjacency, the analogue of the span returned by Adjacency_Graph.
+   */
+  class Adjacency {
+   public:
+    /**
+     * @brief Constructs the view of a vertex's encoded adjacency.
+     * @param[in] i_vertex_ The vertex index.
+     * @param[in] position Pointer to the vertex's encoded adjacency, starting at its degree.
+     */
+    Adjacency(const std::size_t i_vertex_, const std::uint8_t* position) : i_vertex(i_vertex_), byte(position) {}
+
+    [[nodiscard]] inline iterator begin() const { return {i_vertex, byte}; }
+    [[nodiscard]] inline std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+    [[nodiscard]] inline std::size_t size() const noexcept {
+      const std::uint8_t* position = byte;
+      return decode(position);
+    }
+    [[nodiscard]] inline bool empty() const noexcept { return *byte == 0; }
+    [[nodiscard]] inline std::size_t front() const { return *begin(); }
+
+   private:
+    std::size_t i_vertex;      //!< The vertex index.
+    const std::uint8_t* byte;  //!< The vertex's encoded adjacency.
+  };
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Public Constructors and Destructors
+  // -------------------------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Default constructor.
+   */
+  Adjacency_Graph_Compressed() = default;
+
+  /**
+   * @brief Compresses an adjacency graph, in O(V + E).
+   * @param[in] graph The graph to compress.
+   */
+  explicit Adjacency_Graph_Compressed(const Adjacency_Graph<_directed>& graph);
+
+  /**
+   * @brief Compresses a compressed (CSR like) vertex to neighbour list, in O(V + E), without building an
+   *        Adjacency_Graph.
+   * @param[in] vertex_offset The start of each vertex's neighbours in vertex_adjacency, size is one greater than the
+   *                          number of vertices.
+   * @param[in] vertex_adjacency The neighbours of each vertex, each sorted, unique and not containing the vertex.
+   *
+   * @note Unlike the Adjacency_Graph constructor the list is not symmetrised, for an undirected graph it must already
+   *       contain both (i, j) and (j, i).
+   */
+  Adjacency_Graph_Compressed(std::span<const std::size_t> vertex_offset, std::span<const std::size_t> vertex_adjacency);
+
+  /**
+   * @brief Default destructor.
+   */
+  ~Adjacency_Graph_Compressed() = default;
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Element Access
+  // -------------------------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Subscript operator for access to a specified graph vertex's adjacency, with range checking.
+   * @param[in] i_vertex The vertex index to the adjacency being sought.
+   * @return A range decoding the vertex's adjacency.
+   */
+  [[nodiscard]] inline Adjacency at(const std::size_t& i_vertex) const {
+    ASSERT(i_vertex < size_vertex(),
+           "Vertex index " + std::to_string(i_vertex) + " not in range [0, " + std::to_string(size_vertex()) + ").");
+    return (*this)[i_vertex];
+  }
+
+  /**
+   * @brief Subscript operator for access to a specified graph vertex's adjacency.
+   * @param[in] i_vertex The vertex index to the adjacency being sought.
+   * @return A range decoding the vertex's adjacency.
+   */
+  [[nodiscard]] inline Adjacency operator[](const std::size_t& i_vertex) const {
+    ASSERT_DEBUG(i_vertex < size_vertex(),
+                 "Vertex index " + std::to_string(i_vertex) + " not in range [0, " + std::to_string(size_vertex()) +
+                 ").");
+    return {i_vertex, vertex_byte(i_vertex)};
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Capacity
+  // -------------------------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Checks whether the graph is empty, i.e. has no vertices.
+   * @return True if the graph is empty, false otherwise.
+   */
+  [[nodiscard]] inline bool empty() const noexcept { return number_vertex == 0; }
+
+  /**
+   * @brief Returns the number of vertices in the graph.
+   * @return The number of vertices.
+   */
+  [[nodiscard]] inline std::size_t size_vertex() const noexcept { return number_vertex; }
+
+  /**
+   * @brief Returns the number of edges in the graph, an undirected edge counted once.
+   * @return The number of edges.
+   */
+  [[nodiscard]] inline std::size_t size_edge() const noexcept { return _directed ? number_edge : number_edge / 2; }
+
+  /**
+   * @brief Returns the number of vertices and edges in the graph.
+   * @return Pair of the number of vertices and edges.
+   */
+  [[nodiscard]] inline std::pair<std::size_t, std::size_t> size() const noexcept {
+    return {size_vertex(), size_edge()};
+  }
+
+  /**
+   * @brief Returns the memory held by the graph's storage, the byte stream and offsets.
+   * @return The number of bytes.
+   */
+  [[nodiscard]] inline std::size_t size_byte() const noexcept {
+    return byte.size() * sizeof(std::uint8_t) + block_offset.size() * sizeof(std::uint64_t) +
+           vertex_offset.size() * sizeof(std::uint32_t);
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Graph Operators
+  // -------------------------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Computes the degree of a vertex: defined as the number of vertices it adjacent (connected) to.
+   * @param[in] i_vertex The vertex index for which to compute the degree.
+   * @return The degree of the vertex.
+   */
+  [[nodiscard]] inline std::size_t degree(const std::size_t& i_vertex) const {
+    ASSERT_DEBUG(i_vertex < size_vertex(),
+                 "Vertex index " + std::to_string(i_vertex) + " not in range [0, " + std::to_string(size_vertex()) +
+                 ").");
+    const std::uint8_t* position = vertex_byte(i_vertex);
+    return decode(position);
+  }
+
+  /**
+   * @brief Checks if an edge is in the graph, by decoding the first vertex's adjacency.
+   * @param[in] edge The edge to check for.
+   * @return True if the edge is in the graph, false otherwise.
+   */
+  [[nodiscard]] bool contains(const Edge& edge) const;
+
+  /**
+   * @brief Decompresses the graph.
+   * @return The equivalent adjacency graph.
+   */
+  [[nodiscard]] Adjacency_Graph<_directed> decompress() const;
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Private Members
+  // -------------------------------------------------------------------------------------------------------------------
+
+ private:
+  static constexpr std::size_t block_size = 64;  //!< The number of vertices sharing a 64 bit block offset.
+
+  std::size_t number_vertex{0};              //!< The number of vertices.
+  std::size_t number_edge{0};                //!< The number of adjacency entries, twice the edges if undirected.
+  std::vector<std::uint8_t> byte;            //!< The encoded adjacency of all vertices, in vertex order.
+  std::vector<std::uint64_t> block_offset;   //!< The start of each block of vertices in the byte stream.
+  std::vector<std::uint32_t> vertex_offset;  //!< The start of each vertex's adjacency, relative to its block.
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Helper Functions
+  // -------------------------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Returns a pointer to the start of a vertex's encoded adjacency.
+   * @param[in] i_vertex The vertex index.
+   * @return Pointer to the vertex's degree in the byte stream.
+   */
+  [[nodiscard]] inline const std::uint8_t* vertex_byte(const std::size_t i_vertex) const noexcept {
+    return byte.data() + block_offset[i_vertex / block_size] + vertex_offset[i_vertex];
+  }
+
+  /**
+   * @brief Decodes a LEB128 varint, advancing the pointer past it.
+   * @param[in, out] position Pointer to the first byte of the value, on return the byte following it.
+   * @return The decoded value.
+   */
+  [[nodiscard]] static inline std::size_t decode(const std::uint8_t*& position) noexcept {
+    std::size_t value = *position++;
+    if(value < 0x80) [[likely]] return value;
+    value &= 0x7f;
+    for(std::size_t shift = 7;; shift += 7) {
+      const std::size_t next = *position++;
+      value |= (next & 0x7f) << shift;
+      if(next < 0x80) return value;
+    }
+  }
+
+  /**
+   * @brief Encodes a LEB128 varint, advancing the pointer past it.
+   * @param[in] value The value to encode.
+   * @param[in, out] position Pointer to write the first byte to, on return the byte following the value.
+   */
+  static inline void encode(std::size_t value, std::uint8_t*& position) noexcept {
+    while(value >= 0x80) {
+      *position++ = static_cast<std::uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    *position++ = static_cast<std::uint8_t>(value);
+  }
+
+  /**
+   * @brief Returns the number of bytes needed to LEB128 encode a value.
+   * @param[in] value The value to encode.
+   * @return The number of bytes, in [1, 10].
+   */
+  [[nodiscard]] static inline std::size_t size_encode(std::size_t value) noexcept {
+    std::size_t size = 1;
+    for(; value >= 0x80; value >>= 7) ++size;
+    return size;
+  }
+
+  /**
+   * @brief Maps a signed difference to an unsigned value, interleaving positive and negative values.
+   * @param[in] value The difference, as the two's complement wrap of the unsigned subtraction.
+   * @return The zigzag encoded value.
+   */
+  [[nodiscard]] static inline std::size_t zigzag(const std::size_t value) noexcept {
+    return (value << 1) ^ static_cast<std::size_t>(static_cast<s_size_t>(value) >> 63);
+  }
+
+  /**
+   * @brief Inverts the zigzag encoding.
+   * @param[in] value The zigzag encoded value.
+   * @return The difference, as the two's complement wrap, to be added to the vertex index.
+   */
+  [[nodiscard]] static inline std::size_t unzigzag(const std::size_t value) noexcept {
+    return (value >> 1) ^ (~(value & 1) + 1);
+  }
+
+  /**
+   * @brief Builds the byte stream and offsets, sizing each vertex's encoding, then encoding each, in parallel.
+   * @tparam _adjacency_visitor Callable with signature std::span<const std::size_t>(std::size_t i_vertex).
+   * @param[in] size_vertex The number of vertices.
+   * @param[in] adjacency The sorted, unique, adjacency of each vertex.
+   */
+  template<class _adjacency_visitor>
+  void construct(std::size_t size_vertex, const _adjacency_visitor& adjacency);
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Adjacency_Graph_Compressed Template Definitions
+// ---------------------------------------------------------------------------------------------------------------------
+// Public Constructors and Destructors
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details The adjacency of an Adjacency_Graph is always sorted and unique, so is encoded directly.
+ */
+template<bool _directed>
+Adjacency_Graph_Compressed<_directed>::Adjacency_Graph_Compressed(const Adjacency_Graph<_directed>& graph) {
+  construct(graph.size_vertex(), [&](const std::size_t i_vertex) { return graph[i_vertex]; });
+}
+
+/**
+ * @details Checks the offsets are consistent, and in debug that each adjacency is sorted and unique, before encoding.
+ */
+template<bool _directed>
+Adjacency_Graph_Compressed<_directed>::Adjacency_Graph_Compressed(std::span<const std::size_t> vertex_offset,
+                                                                  std::span<const std::size_t> vertex_adjacency) {
+  if(vertex_offset.size() < 2) return;
+  ASSERT(vertex_offset.front() == 0 && vertex_offset.back() == vertex_adjacency.size(),
+         "Offsets span [" + std::to_string(vertex_offset.front()) + ", " + std::to_string(vertex_offset.back()) +
+         "], but there are " + std::to_string(vertex_adjacency.size()) + " neighbours.");
+  const std::size_t size_vertex = vertex_offset.size() - 1;
+  construct(size_vertex, [&](const std::size_t i_vertex) {
+    const std::span<const std::size_t> adjacency =
+    vertex_adjacency.subspan(vertex_offset[i_vertex], vertex_offset[i_vertex + 1] - vertex_offset[i_vertex]);
+    ASSERT_DEBUG(std::adjacent_find(adjacency.begin(), adjacency.end(), std::greater_equal<>()) == adjacency.end(),
+                 "Adjacency of vertex " + std::to_string(i_vertex) + " is not sorted and unique.");
+    ASSERT_DEBUG(adjacency.empty() || adjacency.back() < size_vertex,
+                 "Adjacency of vertex " + std::to_string(i_vertex) + " is not in range [0, " +
+                 std::to_string(size_vertex) + ").");
+    return adjacency;
+  });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Graph Operators
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details Decodes the first vertex's adjacency until a neighbour not less than the second vertex is found.
+ */
+template<bool _directed>
+bool Adjacency_Graph_Compressed<_directed>::contains(const Edge& edge) const {
+  ASSERT_DEBUG(edge.first != edge.second, "Edge vertices identical, " + std::to_string(edge.first) + " and " +
+                                          std::to_string(edge.second) + ".");
+  if(std::max(edge.first, edge.second) >= size_vertex()) return false;
+  FOR_EACH(i_adjacent, (*this)[edge.first]) {
+    if(i_adjacent >= edge.second) return i_adjacent == edge.second;
+  }
+  return false;
+}
+
+/**
+ * @details Degrees are decoded into the offsets, which are then prefix summed, after which each adjacency is decoded in
+ * parallel into place.
+ */
+template<bool _directed>
+Adjacency_Graph<_directed> Adjacency_Graph_Compressed<_directed>::decompress() const {
+  if(empty()) return {};
+  std::vector<std::size_t> offset(size_vertex() + 1, 0);
+  parallel_for(size_vertex(), [&](const std::size_t i_vertex) { offset[i_vertex + 1] = degree(i_vertex); });
+  parallel_partial_sum(offset);
+  std::vector<std::size_t> adjacency(offset.back());
+  parallel_for(size_vertex(), [&](const std::size_t i_vertex) {
+    std::size_t i_adjacency = offset[i_vertex];
+    FOR_EACH(i_adjacent, (*this)[i_vertex]) adjacency[i_adjacency++] = i_adjacent;
+  });
+  return Adjacency_Graph<_directed>(offset, adjacency);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details Three passes: the encoded size of each vertex is computed in parallel, the sizes are then summed within
+ * each block to give the vertex offsets, and across blocks (serially, there are V / 64) to give the block offsets.
+ * Finally each vertex is encoded, in parallel, into its now known place in the byte stream.
+ */
+template<bool _directed>
+template<class _adjacency_visitor>
+void Adjacency_Graph_Compressed<_directed>::construct(const std::size_t size_vertex,
+                                                      const _adjacency_visitor& adjacency) {
+  number_vertex = size_vertex;
+  if(number_vertex == 0) return;
+
+  // Size each vertex's encoding.
+  std::vector<std::size_t> vertex_size(number_vertex);
+  parallel_for(number_vertex, [&](const std::size_t i_vertex) {
+    const std::span<const std::size_t> neighbours = adjacency(i_vertex);
+    std::size_t size = size_encode(neighbours.size());
+    if(!neighbours.empty()) {
+      size += size_encode(zigzag(neighbours.front() - i_vertex));
+      FOR(i_neighbour, std::size_t{1}, neighbours.size())
+      size += size_encode(neighbours[i_neighbour] - neighbours[i_neighbour - 1] - 1);
+    }
+    vertex_size[i_vertex] = size;
+  });
+
+  // Offsets within and between blocks.
+  const std::size_t number_block = (number_vertex + block_size - 1) / block_size;
+  block_offset.assign(number_block + 1, 0);
+  vertex_offset.resize(number_vertex);
+  parallel_for(number_block, [&](const std::size_t i_block) {
+    std::size_t offset = 0;
+    FOR(i_vertex, i_block * block_size, std::min((i_block + 1) * block_size, number_vertex)) {
+      vertex_offset[i_vertex] = static_cast<std::uint32_t>(offset);
+      offset += vertex_size[i_vertex];
+    }
+    ASSERT(offset <= std::numeric_limits<std::uint32_t>::max(),
+           "Block " + std::to_string(i_block) + " encodes to " + std::to_string(offset) + " bytes, exceeding 4 GiB.");
+    block_offset[i_block + 1] = offset;
+  });
+  FOR(i_block, number_block) block_offset[i_block + 1] += block_offset[i_block];
+
+  // Encode.
+  byte.resize(block_offset.back());
+  std::vector<std::size_t> vertex_edge(number_vertex);
+  parallel_for(number_vertex, [&](const std::size_t i_vertex) {
+    const std::span<const std::size_t> neighbours = adjacency(i_vertex);
+    std::uint8_t* position = byte.data() + block_offset[i_vertex / block_size] + vertex_offset[i_vertex];
+    encode(neighbours.size(), position);
+    if(!neighbours.empty()) {
+      encode(zigzag(neighbours.front() - i_vertex), position);
+      FOR(i_neighbour, std::size_t{1}, neighbours.size())
+      encode(neighbours[i_neighbour] - neighbours[i_neighbour - 1] - 1, position);
+    }
+    vertex_edge[i_vertex] = neighbours.size();
+  });
+  FOR_EACH(edge, vertex_edge) number_edge += edge;
+}
+
+}  // namespace Disa
+
+#endif  //DISA_ADJACENCY_GRAPH_COMPRESSED_H
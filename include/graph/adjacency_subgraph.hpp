@@ -27,7 +27,9 @@
 #include "graph_utilities.hpp"
 
 #include <functional>
+#include <limits>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace Disa {
@@ -86,13 +88,14 @@ class Adjacency_Subgraph {
   ~Adjacency_Subgraph() = default;
 
   /**
-   * @brief Constructor for creating a subgraph from a parent graph.
+   * @brief Constructor for creating a subgraph from a parent graph, in O(local edges) for sorted vertices.
    * @param[in] parent_graph The parent graph upon which this subgraph will be constructed.
    * @param[in] i_partition_local_global For this partition of the parent graph, the local to global index mapping.
    * @param[in] extra_levels Additional levels to add to the primary partition.
    * @return Constructed Adjacency_Subgraph
    *
-   * @note There are no guarantees placed on the resulting local partition ordering.
+   * @note Local vertex i is global vertex i_partition_local_global[i]. Unsorted vertices are accepted, at the cost of
+   *       an additional sort of the vertices.
    */
   Adjacency_Subgraph(const Adjacency_Graph<false>& parent_graph, const std::vector<std::size_t>& i_sub_graph_vertex,
                      std::size_t extra_levels = 0);
@@ -291,6 +294,12 @@ class Adjacency_Subgraph {
     return level_set_value.empty() ? true : level_set_value[i_vertex] == 0;
   }
 
+  /**
+   * @brief Returns the local graph, e.g. to compute orderings of the subgraph with the graph algorithms.
+   * @return The graph, in local vertex indices.
+   */
+  [[nodiscard]] inline const Adjacency_Graph<false>& local_graph() const noexcept { return graph; }
+
   /**
    * @brief Checks if the parsed graph is the parent of this sub-graph.
    * @param[in] graph_parent The parent graph to check.
@@ -324,10 +333,9 @@ class Adjacency_Subgraph {
    * @param[in] max_level The new number of levels the subgraph must have.
    * @param[out] i_global_local A global to local mapping of all vertices in the parent graph. Defaults to nullptr.
    *
-   * @note i_global_local may be a nullptr. In this case it will be populated for adding levels, as a working vector is
-   *       needed, but will be left as a nullptr when removing levels. Since no shrink-to-fit is called, multiple calls
-   *       using the same pointer/vector can increase performance by avoiding repeated 'large' memory allocations.
-   *       Finally, and std::numeric_limits<std::size_t>::max() value implies no mapping into this subgraph.
+   * @note i_global_local may be a nullptr, in which case no parent sized storage is used and the cost of adding levels
+   *       is proportional to the subgraph and its new halo. Otherwise it is (re)populated, at O(V_parent) cost, and a
+   *       std::numeric_limits<std::size_t>::max() value implies no mapping into this subgraph.
    */
   void update_levels(const Adjacency_Graph<false>& parent_graph, std::size_t max_level,
                      std::shared_ptr<std::vector<std::size_t>> i_global_local = nullptr);
@@ -360,8 +368,8 @@ class Adjacency_Subgraph {
    * @param[in] parent_graph The parent graph
    * @param[in] max_level The new number of levels the sub graph must contain.
    * @param[in] current_max The current number of levels the subgraph contains.
-   * @param[out] i_global_local The global to local mapping of all vertices in the parent graph. Will be populated if
-   *                            empty.
+   * @param[out] i_global_local The global to local mapping of all vertices in the parent graph. Will only be populated
+   *                            if parsed as a non-nullptr.
    */
   void add_levels(const Adjacency_Graph<false>& parent_graph, std::size_t max_level, std::size_t current_max,
                   std::shared_ptr<std::vector<std::size_t>> i_global_local);
@@ -375,8 +383,50 @@ class Adjacency_Subgraph {
    */
   void remove_levels(const Adjacency_Graph<false>& parent_graph, std::size_t max_level,
                      std::shared_ptr<std::vector<std::size_t>> i_global_local);
+
+  /**
+   * @brief Builds the primary partition directly from the parent graph, without copying the parent.
+   * @tparam _global_local Callable with signature std::size_t(std::size_t i_global), returning the local index of a
+   *                       global vertex, or std::numeric_limits<std::size_t>::max() if it is not in the subgraph.
+   * @param[in] parent_graph The parent graph.
+   * @param[in] i_partition_local_global For this partition of the parent graph, the local to global index mapping.
+   * @param[in] global_local The global to local mapping.
+   */
+  template<class _global_local>
+  void construct(const Adjacency_Graph<false>& parent_graph, std::span<const std::size_t> i_partition_local_global,
+                 const _global_local& global_local);
+
+  friend std::vector<Adjacency_Subgraph> create_subgraph_list(const Adjacency_Graph<false>& parent_graph,
+                                                              const std::vector<std::size_t>& vertex_subgraph,
+                                                              std::size_t number_subgraph, std::size_t extra_levels);
 };
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Batch Construction
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Creates all the subgraphs of a partitioning of a parent graph in a single parallel pass, in O(V + E).
+ * @param[in] parent_graph The parent graph to be partitioned.
+ * @param[in] vertex_subgraph For each vertex of the parent graph, the subgraph it is a primary vertex of.
+ * @param[in] number_subgraph The number of subgraphs, some of which may be empty. Defaults to zero, in which case it is
+ *                            the largest subgraph plus one.
+ * @param[in] extra_levels Additional levels to add to each primary partition.
+ * @return The subgraphs, each holding its vertices in ascending global order.
+ */
+std::vector<Adjacency_Subgraph> create_subgraph_list(const Adjacency_Graph<false>& parent_graph,
+                                                     const std::vector<std::size_t>& vertex_subgraph,
+                                                     std::size_t number_subgraph = 0, std::size_t extra_levels = 0);
+
+/**
+ * @brief Changes the number of 'halo' levels/vertices around each subgraph of a parent graph, in parallel.
+ * @param[in] parent_graph The parent graph of the subgraphs.
+ * @param[in, out] subgraph_list The subgraphs, each updated as by Adjacency_Subgraph::update_levels.
+ * @param[in] max_level The new number of levels each subgraph must have.
+ */
+void update_levels(const Adjacency_Graph<false>& parent_graph, std::vector<Adjacency_Subgraph>& subgraph_list,
+                   std::size_t max_level);
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Operator Overloading
 // ---------------------------------------------------------------------------------------------------------------------
@@ -388,10 +438,6 @@ class Adjacency_Subgraph {
  * @param[in] ostream The out stream to write to.
  * @param[in] graph The graph to write.
  * @return Returns the ostream, with the graph writen out.
- *
- * @note Since there is no complete way to fully check if two graphs are identical, other than a brute force approach,
- * this approach is 'lazy'. It picks out a few properties of the graph and combines them, in the hope that major
- * topological changes will be caught. However it is possible to 'flip' and edge and for the hash to remain unchanged.
  */
 std::ostream& operator<<(std::ostream& ostream, const Adjacency_Subgraph& graph);
 
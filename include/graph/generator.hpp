@@ -46,10 +46,10 @@ namespace Disa {
  */
 template<bool _directed>
 Adjacency_Graph<_directed> create_graph_line(std::size_t number_vertices) {
-  Adjacency_Graph<_directed> line;
-  for(std::size_t i_x = 0; i_x < number_vertices - 1; ++i_x)
-    line.insert({i_x, i_x + 1});
-  return line;
+  std::vector<Edge> edge;
+  edge.reserve(number_vertices);
+  for(std::size_t i_x = 0; i_x + 1 < number_vertices; ++i_x) edge.emplace_back(i_x, i_x + 1);
+  return Adjacency_Graph<_directed>(edge);
 };
 
 /**
@@ -80,17 +80,41 @@ Adjacency_Graph<_directed> create_graph_line(std::size_t number_vertices) {
  */
 template<bool _directed>
 Adjacency_Graph<_directed> create_graph_structured(std::size_t number_vertices) {
-  Adjacency_Graph<_directed> structured;
+  std::vector<Edge> edge;
+  edge.reserve(2 * number_vertices * number_vertices);
   for(std::size_t i_y = 0; i_y < number_vertices; ++i_y) {
     for(std::size_t i_x = 0; i_x < number_vertices; ++i_x) {
       const std::size_t i_vertex = i_y * (number_vertices) + i_x;
-      if(!_directed && i_x != 0) structured.insert({i_vertex - 1, i_vertex});
-      if(i_x != number_vertices - 1) structured.insert({i_vertex, i_vertex + 1});
-      if(!_directed && i_y != 0) structured.insert({i_vertex - number_vertices, i_vertex});
-      if(i_y < number_vertices - 1) structured.insert({i_vertex, i_vertex + number_vertices});
+      if(i_x != number_vertices - 1) edge.emplace_back(i_vertex, i_vertex + 1);
+      if(i_y < number_vertices - 1) edge.emplace_back(i_vertex, i_vertex + number_vertices);
     }
   }
-  return structured;
+  return Adjacency_Graph<_directed>(edge);
+}
+
+/**
+ * @brief Creates a disjoint Adjacency Graph, of two interleaved structured grids and a number of isolated vertices.
+ * @param[in] number_vertices The number of vertices n along one of the 'axis' of the first grid, the second has n/2.
+ * @param[in] number_isolated The number of isolated vertices, appended after the grids.
+ * @return The created Adjacency Graph.
+ *
+ * @details Vertex i of the first grid is vertex 2i, and vertex i of the second grid is vertex 2i + 1. The odd vertices
+ * beyond the second grid, and the appended vertices, are isolated. There are thus 2 + n^2 - (n/2)^2 + number_isolated
+ * connected components.
+ */
+inline Adjacency_Graph<false> create_graph_disjoint(const std::size_t number_vertices,
+                                                    const std::size_t number_isolated) {
+  std::vector<Edge> edge;
+  const auto add_grid = [&edge](const std::size_t size, const std::size_t shift) {
+    const Adjacency_Graph<false> grid = create_graph_structured<false>(size);
+    for(std::size_t i_vertex = 0; i_vertex < grid.size_vertex(); ++i_vertex) {
+      for(const std::size_t i_adjacent : grid[i_vertex])
+        if(i_vertex < i_adjacent) edge.emplace_back(2 * i_vertex + shift, 2 * i_adjacent + shift);
+    }
+  };
+  add_grid(number_vertices, 0);
+  add_grid(number_vertices / 2, 1);
+  return Adjacency_Graph<false>(edge, 2 * number_vertices * number_vertices + number_isolated);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
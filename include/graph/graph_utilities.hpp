@@ -24,8 +24,12 @@
 
 #include "adjacency_graph.hpp"
 #include "adjacency_subgraph.hpp"
+#include "parallel.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <numeric>
 #include <queue>
 #include <vector>
@@ -36,6 +40,190 @@ namespace Disa {
 // Utility Functions
 // ---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Level synchronous, direction optimising, breadth first traversal of an undirected graph from a frontier of
+ *        vertices of equal level.
+ * @tparam _graph The type of the graph, must be symmetric (undirected).
+ * @param[in] graph The graph on which the traversal is to be performed.
+ * @param[in] frontier The starting vertices, in order, all of which must already have their (equal) level set.
+ * @param[in,out] vertex_level The level of each vertex, vertices with a level other than max are treated as visited.
+ * @param[in] end_level The maximum level to be considered during traversal (default is maximum value of std::size_t).
+ * @return The vertices in the order visited, starting with the frontier.
+ *
+ * @details Each level is expanded either top-down, each frontier vertex claiming its unvisited neighbours, or
+ * bottom-up, each unvisited vertex searching its neighbours for the frontier, switching between the two with the
+ * heuristics of Beamer et al., "Direction-optimizing breadth-first search" (SC 2012). Both claim a vertex for the
+ * frontier vertex with the lowest frontier position, and children are gathered in parent then adjacency order, so the
+ * visit order is exactly that of a first-in first-out queue, whatever the thread count or direction. As a result the
+ * bottom-up search cannot stop at the first frontier neighbour, it still avoids the atomic updates of the top-down
+ * step. Visited vertices are tracked in a bitmap.
+ */
+template<class _graph>
+std::vector<std::size_t> breadth_first_frontier(const _graph& graph, std::vector<std::size_t> frontier,
+                                                std::vector<std::size_t>& vertex_level,
+                                                const std::size_t end_level = std::numeric_limits<std::size_t>::max()) {
+  constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+  constexpr std::size_t alpha = 14;  // Switch to bottom-up once frontier edges exceed unvisited edges / alpha.
+  constexpr std::size_t beta = 24;   // Switch to top-down once the frontier is smaller than vertices / beta.
+  constexpr std::size_t grain = 256;
+  const std::size_t size = graph.size_vertex();
+  ASSERT_DEBUG(vertex_level.size() == size, "Vertex level and graph size_vertex do not match.");
+
+  std::vector<std::size_t> order(frontier);
+  if(frontier.empty()) return order;
+  std::size_t level = vertex_level[frontier.front()];
+  ASSERT_DEBUG(std::all_of(frontier.begin(), frontier.end(),
+                           [&](const std::size_t i_vertex) { return vertex_level[i_vertex] == level; }),
+               "The frontier vertices must all be of the same level.");
+
+  // Visited bitmap, the position of each vertex in the frontier and the frontier position of each claimed vertex.
+  std::vector<std::uint64_t> visited((size + 63) / 64, 0);
+  parallel_for(visited.size(), [&](const std::size_t i_word) {
+    std::uint64_t word = 0;
+    FOR(i_bit, 64) {
+      const std::size_t i_vertex = i_word * 64 + i_bit;
+      if(i_vertex < size && vertex_level[i_vertex] != unset) word |= std::uint64_t(1) << i_bit;
+    }
+    visited[i_word] = word;
+  });
+  const auto is_visited = [&](const std::size_t i_vertex) {
+    return static_cast<bool>((visited[i_vertex / 64] >> (i_vertex % 64)) & 1);
+  };
+  std::vector<std::size_t> position(size, unset);
+  std::vector<std::size_t> parent(size, unset);
+  std::size_t edge_unvisited = 0;
+  FOR(i_vertex, size) if(!is_visited(i_vertex)) edge_unvisited += graph.degree(i_vertex);
+
+  bool is_bottom_up = false;
+  std::vector<std::size_t> child_offset;
+  std::vector<std::size_t> next;
+  while(!frontier.empty() && level < end_level) {
+    std::size_t edge_frontier = 0;
+    FOR_EACH(i_vertex, frontier) edge_frontier += graph.degree(i_vertex);
+    parallel_for(frontier.size(), [&](const std::size_t i_front) { position[frontier[i_front]] = i_front; }, grain);
+    if(!is_bottom_up) is_bottom_up = edge_frontier > edge_unvisited / alpha;
+    else is_bottom_up = frontier.size() >= size / beta;
+
+    // Claim unvisited vertices for the lowest positioned frontier neighbour.
+    if(is_bottom_up) {
+      parallel_for(
+      size,
+      [&](const std::size_t i_vertex) {
+        if(is_visited(i_vertex)) return;
+        std::size_t i_parent = unset;
+        FOR_EACH(i_adjacent, graph[i_vertex]) i_parent = std::min(i_parent, position[i_adjacent]);
+        parent[i_vertex] = i_parent;
+      },
+      grain);
+    } else {
+      parallel_for(
+      frontier.size(),
+      [&](const std::size_t i_front) {
+        FOR_EACH(i_adjacent, graph[frontier[i_front]]) {
+          if(is_visited(i_adjacent)) continue;
+          std::atomic_ref<std::size_t> claim(parent[i_adjacent]);
+          std::size_t current = claim.load(std::memory_order_relaxed);
+          while(i_front < current && !claim.compare_exchange_weak(current, i_front, std::memory_order_relaxed)) {}
+        }
+      },
+      grain);
+    }
+
+    // Gather children in parent then adjacency order, i.e. the order a FIFO queue would have visited them.
+    const auto is_child = [&](const std::size_t i_front, const std::size_t i_vertex) {
+      return !is_visited(i_vertex) && parent[i_vertex] == i_front;
+    };
+    child_offset.assign(frontier.size() + 1, 0);
+    parallel_for(
+    frontier.size(),
+    [&](const std::size_t i_front) {
+      FOR_EACH(i_adjacent, graph[frontier[i_front]]) child_offset[i_front + 1] += is_child(i_front, i_adjacent);
+    },
+    grain);
+    std::partial_sum(child_offset.begin(), child_offset.end(), child_offset.begin());
+    next.resize(child_offset.back());
+    parallel_for(
+    frontier.size(),
+    [&](const std::size_t i_front) {
+      std::size_t i_next = child_offset[i_front];
+      FOR_EACH(i_adjacent, graph[frontier[i_front]]) if(is_child(i_front, i_adjacent)) next[i_next++] = i_adjacent;
+    },
+    grain);
+
+    // Advance the frontier.
+    parallel_for(frontier.size(), [&](const std::size_t i_front) { position[frontier[i_front]] = unset; }, grain);
+    parallel_for(
+    next.size(),
+    [&](const std::size_t i_next) {
+      const std::size_t i_vertex = next[i_next];
+      vertex_level[i_vertex] = level + 1;
+      std::atomic_ref<std::uint64_t>(visited[i_vertex / 64])
+      .fetch_or(std::uint64_t(1) << (i_vertex % 64), std::memory_order_relaxed);
+    },
+    grain);
+    FOR_EACH(i_vertex, next) edge_unvisited -= graph.degree(i_vertex);
+    order.insert(order.end(), next.begin(), next.end());
+    std::swap(frontier, next);
+    ++level;
+  }
+  return order;
+}
+
+/**
+ * @brief Labels the connected components of an undirected graph, in parallel.
+ * @tparam _graph The type of the graph, must be symmetric (undirected).
+ * @param[in] graph The graph whose components are to be found.
+ * @param[out] component For each vertex, its component, components numbered in order of their lowest vertex.
+ * @return The number of components.
+ *
+ * @details A lock-free union-find. Each edge is united in parallel, the larger root always being linked beneath the
+ * smaller by a compare and swap, so a root is the lowest vertex of its tree, parents only decrease and no cycle can
+ * form. Finds compress the path by halving, also via compare and swap, which may fail harmlessly under contention.
+ * Once all edges are united, the root of each vertex is found and the roots numbered in ascending order, so the
+ * labelling is independent of the thread count.
+ */
+template<class _graph>
+std::size_t connected_components(const _graph& graph, std::vector<std::size_t>& component) {
+  const std::size_t size = graph.size_vertex();
+  std::vector<std::size_t> parent(size);
+  parallel_for(size, [&](const std::size_t i_vertex) { parent[i_vertex] = i_vertex; });
+
+  const auto find = [&](std::size_t i_vertex) {
+    while(true) {
+      std::atomic_ref<std::size_t> vertex_parent(parent[i_vertex]);
+      std::size_t i_parent = vertex_parent.load(std::memory_order_acquire);
+      const std::size_t i_grand_parent = std::atomic_ref<std::size_t>(parent[i_parent]).load(std::memory_order_acquire);
+      if(i_parent == i_grand_parent) return i_parent;
+      vertex_parent.compare_exchange_weak(i_parent, i_grand_parent, std::memory_order_acq_rel);
+      i_vertex = i_grand_parent;
+    }
+  };
+  const auto unite = [&](std::size_t i_vertex_0, std::size_t i_vertex_1) {
+    while(true) {
+      i_vertex_0 = find(i_vertex_0);
+      i_vertex_1 = find(i_vertex_1);
+      if(i_vertex_0 == i_vertex_1) return;
+      if(i_vertex_0 < i_vertex_1) std::swap(i_vertex_0, i_vertex_1);
+      std::size_t i_root = i_vertex_0;
+      if(std::atomic_ref<std::size_t>(parent[i_vertex_0])
+         .compare_exchange_strong(i_root, i_vertex_1, std::memory_order_acq_rel))
+        return;
+    }
+  };
+  parallel_for(size, [&](const std::size_t i_vertex) {
+    FOR_EACH(i_adjacent, graph[i_vertex]) if(i_adjacent < i_vertex) unite(i_vertex, i_adjacent);
+  });
+
+  // Find the root of each vertex, then number the roots in ascending order.
+  component.resize(size);
+  parallel_for(size, [&](const std::size_t i_vertex) { component[i_vertex] = find(i_vertex); });
+  std::vector<std::size_t> root_number(size);
+  parallel_for(size, [&](const std::size_t i_vertex) { root_number[i_vertex] = component[i_vertex] == i_vertex; });
+  parallel_partial_sum(root_number);
+  parallel_for(size, [&](const std::size_t i_vertex) { component[i_vertex] = root_number[component[i_vertex]] - 1; });
+  return size == 0 ? 0 : root_number.back();
+}
+
 /**
  * @brief Performs level traversal on a given graph starting from a specified vertex and returns a vector that stores
  *        the level of each vertex.
@@ -54,9 +242,8 @@ std::vector<std::size_t> level_traversal(const _graph& graph, const std::size_t
                "Starting vertex not in range (0, " + std::to_string(graph.size_vertex()) + "].");
 
   std::vector<std::size_t> vertex_level(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
-  std::queue<std::size_t> vertex_queue({i_start});
   vertex_level[i_start] = 0;
-  level_traversal(graph, vertex_queue, vertex_level, end_level);
+  breadth_first_frontier(graph, {i_start}, vertex_level, end_level);
   return vertex_level;
 }
 
@@ -75,22 +262,19 @@ void level_traversal(const _graph& graph, std::queue<std::size_t>& vertex_queue,
 
   ASSERT_DEBUG(!graph.empty(), "Graph is empty.");
   ASSERT_DEBUG(vertex_level.size() == graph.size_vertex(), "Vertex level and graph size_vertex do not match.");
-  FOR_EACH_REF(level, vertex_level)++ level;  // roll the vector over, before checking max.
-  ASSERT_DEBUG(*std::max_element(vertex_level.begin(), vertex_level.end()) < graph.size_vertex(),
+  ASSERT_DEBUG(std::all_of(vertex_level.begin(), vertex_level.end(),
+                           [&](const std::size_t level) {
+                             return level == std::numeric_limits<std::size_t>::max() || level < graph.size_vertex();
+                           }),
                "A vertex in vertex level not in graph range (0, " + std::to_string(graph.size_vertex()) + "].");
 
+  std::vector<std::size_t> frontier;
+  frontier.reserve(vertex_queue.size());
   while(!vertex_queue.empty()) {
-    const std::size_t front = vertex_queue.front();
+    frontier.push_back(vertex_queue.front());
     vertex_queue.pop();
-    if(vertex_level[front] == end_level + 1) continue;  // Do not add new vertices, +1 because of above increment.
-    FOR_EACH(vertex, graph[front]) {
-      if(!static_cast<bool>(vertex_level[vertex])) {
-        vertex_queue.push(vertex);
-        vertex_level[vertex] = vertex_level[front] + 1;
-      }
-    }
   }
-  FOR_EACH_REF(level, vertex_level)-- level;
+  breadth_first_frontier(graph, std::move(frontier), vertex_level, end_level);
 }
 
 /**
@@ -100,6 +284,9 @@ void level_traversal(const _graph& graph, std::queue<std::size_t>& vertex_queue,
  * @param[in] graph  The graph on which level expansion is to be performed.
  * @param[in] seeds Indices of seed vertices from which expansion will occur (No. colors = size of this vector).
  * @param[out] vertex_color Of graph vertex size, and containing the color of each vertex after the level expansion.
+ *
+ * @note If the graph is disjoint, each connected component without a seed is given, whole, to the color with the
+ *       fewest vertices, so every vertex is colored.
  */
 template<class _graph>
 void level_expansion(const _graph& graph, const std::vector<std::size_t>& seeds,
@@ -143,6 +330,40 @@ void level_expansion(const _graph& graph, const std::vector<std::size_t>& seeds,
     ASSERT(iteration++ < graph.size_vertex(),
            "Number of iterations have exceeded, " + std::to_string(iteration) + ". Is the graph disjoint?");
   }
+
+  // Components holding no seed are unreached, give each whole to the least populated color, largest first.
+  if(std::none_of(vertex_color.begin(), vertex_color.end(),
+                  [](const std::size_t color) { return color == std::numeric_limits<std::size_t>::max(); }))
+    return;
+  std::vector<std::size_t> component;
+  const std::size_t number_component = connected_components(graph, component);
+  std::vector<std::size_t> component_size(number_component, 0);
+  std::vector<std::size_t> component_color(number_component, std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> color_size(seeds.size(), 0);
+  FOR(i_vertex, graph.size_vertex()) {
+    ++component_size[component[i_vertex]];
+    if(vertex_color[i_vertex] == std::numeric_limits<std::size_t>::max()) continue;
+    component_color[component[i_vertex]] = vertex_color[i_vertex];
+    ++color_size[vertex_color[i_vertex]];
+  }
+  std::vector<std::size_t> unreached;
+  FOR(i_component, number_component) {
+    if(component_color[i_component] == std::numeric_limits<std::size_t>::max()) unreached.push_back(i_component);
+  }
+  std::stable_sort(unreached.begin(), unreached.end(),
+                   [&](const std::size_t i_component_0, const std::size_t i_component_1) {
+                     return component_size[i_component_0] > component_size[i_component_1];
+                   });
+  FOR_EACH(i_component, unreached) {
+    const std::size_t i_color =
+    static_cast<std::size_t>(std::distance(color_size.begin(), std::min_element(color_size.begin(), color_size.end())));
+    component_color[i_component] = i_color;
+    color_size[i_color] += component_size[i_component];
+  }
+  FOR(i_vertex, graph.size_vertex()) {
+    if(vertex_color[i_vertex] == std::numeric_limits<std::size_t>::max())
+      vertex_color[i_vertex] = component_color[component[i_vertex]];
+  }
 }
 
 /**
@@ -173,6 +394,7 @@ std::size_t pseudo_peripheral_vertex(const _graph& graph, std::size_t i_start =
     found = true;
     distance = level_traversal(graph, pseudo_peripheral_node);
     FOR(i_vertex, graph.size_vertex()) {
+      if(distance[i_vertex] == std::numeric_limits<std::size_t>::max()) continue;  // Not in this component.
       if(distance[i_vertex] > max_distance ||
          (distance[i_vertex] == max_distance && graph.degree(i_vertex) < graph.degree(pseudo_peripheral_node))) {
         max_distance = distance[i_vertex];
@@ -184,6 +406,49 @@ std::size_t pseudo_peripheral_vertex(const _graph& graph, std::size_t i_start =
   return pseudo_peripheral_node;
 }
 
+/**
+ * @brief Finds an approximate centre vertex of the parsed graph, i.e. a vertex of (near) minimal eccentricity.
+ * @tparam _graph The type of the graph.
+ * @param[in] graph A non-empty graph to search for a centre vertex.
+ * @param[in] i_start The starting vertex, only the connected component containing it is searched. Defaults to 0.
+ * @return The index of the pseudo centre vertex.
+ *
+ * @details Rather than computing all eccentricities, O(V E), a few breadth first sweeps are made. The first starts from
+ * a pseudo peripheral vertex, each following sweep from the vertex furthest from all previous sources. The eccentricity
+ * of each vertex is then approximated by its maximum distance to the sources, and the vertex minimising it returned.
+ * Ties go to the vertex furthest from its nearest source, then the lowest index. For paths and grids this is the exact
+ * centre, the cost is O(E).
+ */
+template<class _graph>
+std::size_t pseudo_centre_vertex(const _graph& graph, std::size_t i_start = 0) {
+  constexpr std::size_t number_sweep = 3;
+  constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+  ASSERT_DEBUG(!graph.empty(), "The parsed graph is empty.");
+  ASSERT_DEBUG(i_start < graph.size_vertex(), "The parsed start vertex is not in the graph.");
+  if(graph.degree(i_start) == 0) return i_start;
+
+  std::vector<std::size_t> eccentricity(graph.size_vertex(), 0);
+  std::vector<std::size_t> nearest(graph.size_vertex(), unset);
+  std::size_t i_source = pseudo_peripheral_vertex(graph, i_start);
+  FOR(i_sweep, number_sweep) {
+    const std::vector<std::size_t> level = level_traversal(graph, i_source);
+    FOR(i_vertex, graph.size_vertex()) {
+      eccentricity[i_vertex] = std::max(eccentricity[i_vertex], level[i_vertex]);
+      nearest[i_vertex] = std::min(nearest[i_vertex], level[i_vertex]);
+    }
+    FOR(i_vertex, graph.size_vertex()) {
+      if(level[i_vertex] != unset && nearest[i_vertex] > nearest[i_source]) i_source = i_vertex;
+    }
+  }
+  std::size_t i_centre = i_start;
+  FOR(i_vertex, graph.size_vertex()) {
+    if(eccentricity[i_vertex] < eccentricity[i_centre] ||
+       (eccentricity[i_vertex] == eccentricity[i_centre] && nearest[i_vertex] > nearest[i_centre]))
+      i_centre = i_vertex;
+  }
+  return i_centre;
+}
+
 /**
  * @brief Computes the eccentricity of all vertices in the graph using the breadth-first search algorithm.
  * @tparam _graph Type of the input graph.
@@ -207,9 +472,9 @@ void eccentricity_graph(const _graph& graph, std::vector<std::vector<std::size_t
  * @param[out] distance Vector to store the distances between the starting vertex and each vertex in the graph.
  * @param[in] i_stop The index of a stopping vertex, defaults to max. See details.
  *
- * @details The function uses a queue to store the vertices to be visited and updates the distance vector as it performs
- * a breath first search. If the index of the vertex at the front of the queue is greater than or equal to i_stop it is
- * not visited, this can improve performance when building full eccentricities which are symmetric.
+ * @details The function performs a breadth first search, see breadth_first_frontier. Vertices with an index greater
+ * than or equal to i_stop are not visited, and the distance vector is sized to i_stop, this can improve performance
+ * when building full eccentricities which are symmetric.
  */
 template<class _graph>
 void eccentricity_vertex_breadth_first(const _graph& graph, const std::size_t i_start,
@@ -217,32 +482,18 @@ void eccentricity_vertex_breadth_first(const _graph& graph, const std::size_t i_
                                        const std::size_t i_stop = std::numeric_limits<std::size_t>::max()) {
   ASSERT_DEBUG(!graph.empty(), "The parsed graph is empty.");
   ASSERT_DEBUG(i_start < graph.size_vertex(), "The parsed start vertex is not in the graph.");
-  ASSERT_DEBUG(i_start <= i_stop, "The parsed start vertex is greater than the parsed stop vertex.");
+  ASSERT_DEBUG(i_start < i_stop, "The parsed start vertex is not less than the parsed stop vertex.");
   ASSERT_DEBUG(i_stop == std::numeric_limits<std::size_t>::max() || i_stop <= graph.size_vertex(),
                "The stopping vertex is not in the graph size range [0, " + std::to_string(graph.size_vertex()) +
                "] and not set to a default.");
 
-  // Initialise the distance vector.
-  std::fill(distance.begin(), distance.end(), std::numeric_limits<std::size_t>::max());
-  distance.resize(graph.size_vertex() <= i_stop ? graph.size_vertex() : i_stop,
-                  std::numeric_limits<std::size_t>::max());
-
-  // Create a priority queue to store the vertices to be visited
-  std::queue<std::size_t> queue({i_start});
-  distance[i_start] = 0;
-
-  // Visit each vertex in the graph
-  while(!queue.empty()) {
-    const std::size_t front = queue.front();
-    queue.pop();
-    if(front >= i_stop) continue;  // we don't search.
-    FOR_EACH(vertex, graph[front]) {
-      if(distance[vertex] == std::numeric_limits<std::size_t>::max()) {
-        distance[vertex] = distance[front] + 1;
-        queue.push(vertex);
-      }
-    }
-  }
+  // Vertices from i_stop on are never searched, so they are marked as visited up front.
+  const std::size_t size_stop = std::min(graph.size_vertex(), i_stop);
+  std::vector<std::size_t> level(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+  std::fill(level.begin() + static_cast<s_size_t>(size_stop), level.end(), 0);
+  level[i_start] = 0;
+  breadth_first_frontier(graph, {i_start}, level);
+  distance.assign(level.begin(), level.begin() + static_cast<s_size_t>(size_stop));
 }
 
 }  // namespace Disa
@@ -0,0 +1,488 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ---------------------------------------------------------------------------------------------------------------------
+// File Name: halo_exchange.hpp
+// Description: Contains the declarations for halo exchange plans between subgraphs, and their execution.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef DISA_HALO_EXCHANGE_H
+#define DISA_HALO_EXCHANGE_H
+
+#include "macros.hpp"
+#include "scalar.hpp"
+#include "vector_dense.hpp"
+
+#ifdef DISA_MPI
+#include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace Disa {
+
+template<bool _directed>
+class Adjacency_Graph;
+class Adjacency_Subgraph;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Halo Exchange Plan
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Halo_Exchange_Plan
+ * @brief The gather/scatter plan of a single subgraph, listing which of its owned (level 0) entries each neighbouring
+ *        subgraph needs, and which of its halo (level > 0) entries each neighbour owns.
+ *
+ * @details Entries are local vertex indices of the subgraph, packed by neighbour, with the neighbours in ascending
+ * order. Within a neighbour the entries are in ascending global order, so the send list of subgraph p to q and the
+ * receive list of q from p match entry for entry, and no indices need to be communicated during an exchange.
+ */
+struct Halo_Exchange_Plan {
+  std::size_t i_subgraph = 0;                  //!< The subgraph (rank) this plan belongs to.
+  std::vector<std::size_t> send_neighbour;     //!< The subgraphs needing owned entries of this subgraph, ascending.
+  std::vector<std::size_t> send_offset{0};     //!< The start of each send neighbour's entries in send_index.
+  std::vector<std::size_t> send_index;         //!< The owned local indices to send, packed by neighbour.
+  std::vector<std::size_t> receive_neighbour;  //!< The subgraphs owning halo entries of this subgraph, ascending.
+  std::vector<std::size_t> receive_offset{0};  //!< The start of each receive neighbour's entries in receive_index.
+  std::vector<std::size_t> receive_index;      //!< The halo local indices to receive, packed by neighbour.
+
+  /**
+   * @brief Returns the send entries of a neighbour.
+   * @param[in] i_neighbour The index of the neighbour in send_neighbour.
+   * @return The owned local indices to send.
+   */
+  [[nodiscard]] inline std::span<const std::size_t> send(const std::size_t i_neighbour) const {
+    return {send_index.data() + send_offset[i_neighbour], send_offset[i_neighbour + 1] - send_offset[i_neighbour]};
+  }
+
+  /**
+   * @brief Returns the receive entries of a neighbour.
+   * @param[in] i_neighbour The index of the neighbour in receive_neighbour.
+   * @return The halo local indices to receive.
+   */
+  [[nodiscard]] inline std::span<const std::size_t> receive(const std::size_t i_neighbour) const {
+    return {receive_index.data() + receive_offset[i_neighbour],
+            receive_offset[i_neighbour + 1] - receive_offset[i_neighbour]};
+  }
+};
+
+/**
+ * @brief Creates the halo exchange plan of each subgraph of a partitioned parent graph.
+ * @param[in] parent_graph The parent graph of the subgraphs.
+ * @param[in] subgraph_list The subgraphs, whose primary (level 0) vertices must cover each vertex exactly once.
+ * @return The plan of each subgraph, in the order of subgraph_list.
+ */
+[[nodiscard]] std::vector<Halo_Exchange_Plan>
+create_halo_exchange_plan(const Adjacency_Graph<false>& parent_graph,
+                          const std::vector<Adjacency_Subgraph>& subgraph_list);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Shared Memory Execution
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Refreshes the halo entries of every subgraph's vector from their owners, directly in shared memory.
+ * @param[in] plan_list The plan of each subgraph.
+ * @param[in, out] vector_list The local vector of each subgraph, indexed by local vertex, only halo entries change.
+ */
+void halo_exchange(const std::vector<Halo_Exchange_Plan>& plan_list, std::vector<Vector_Dense<Scalar, 0>>& vector_list);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Transport Execution
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @class Transport_Local
+ * @brief An in-process message transport between a fixed number of ranks, e.g. threads each owning a subgraph.
+ *
+ * @details Each rank communicates through its Endpoint. Sends are buffered, so never block, while a receive blocks
+ * until the next message from the given source arrives, messages between a pair of ranks being received in the order
+ * sent. It stands in for a distributed transport, e.g. Transport_Socket or Transport_MPI, which provide the same send,
+ * receive, rank and size functions.
+ */
+class Transport_Local {
+
+ public:
+  /**
+   * @class Endpoint
+   * @brief A single rank's handle to the transport.
+   */
+  class Endpoint {
+   public:
+    /**
+     * @brief Constructs the handle of a rank.
+     * @param[in] transport_ The transport.
+     * @param[in] i_rank_ The rank.
+     */
+    Endpoint(Transport_Local& transport_, const std::size_t i_rank_) : transport(&transport_), i_rank(i_rank_) {}
+
+    /**
+     * @brief Sends a message to a rank, without blocking.
+     * @param[in] i_destination The destination rank.
+     * @param[in] data The message.
+     */
+    void send(std::size_t i_destination, std::span<const Scalar> data);
+
+    /**
+     * @brief Receives the next message from a rank, blocking until it arrives.
+     * @param[in] i_source The source rank.
+     * @param[out] data The message, which must be sized to the message.
+     */
+    void receive(std::size_t i_source, std::span<Scalar> data);
+
+    /**
+     * @brief Returns the rank of this endpoint.
+     * @return The rank.
+     */
+    [[nodiscard]] inline std::size_t rank() const noexcept { return i_rank; }
+
+    /**
+     * @brief Returns the number of ranks.
+     * @return The number of ranks.
+     */
+    [[nodiscard]] inline std::size_t size() const noexcept { return transport->size(); }
+
+   private:
+    Transport_Local* transport;  //!< The transport.
+    std::size_t i_rank;          //!< The rank of this endpoint.
+  };
+
+  /**
+   * @brief Constructs a transport between a number of ranks.
+   * @param[in] number_rank The number of ranks.
+   */
+  explicit Transport_Local(const std::size_t number_rank) : mailbox(number_rank) {
+    FOR_EACH_REF(rank_mailbox, mailbox) rank_mailbox.message.resize(number_rank);
+  }
+
+  /**
+   * @brief Returns the endpoint of a rank.
+   * @param[in] i_rank The rank.
+   * @return The endpoint.
+   */
+  [[nodiscard]] inline Endpoint endpoint(const std::size_t i_rank) {
+    ASSERT(i_rank < mailbox.size(),
+           "Rank " + std::to_string(i_rank) + " not in range [0, " + std::to_string(mailbox.size()) + ").");
+    return {*this, i_rank};
+  }
+
+  /**
+   * @brief Returns the number of ranks.
+   * @return The number of ranks.
+   */
+  [[nodiscard]] inline std::size_t size() const noexcept { return mailbox.size(); }
+
+ private:
+  /**
+   * @struct Mailbox
+   * @brief The pending messages of a rank, one queue per source.
+   */
+  struct Mailbox {
+    std::mutex mutex;                                      //!< Guards the queues.
+    std::condition_variable arrived;                       //!< Signalled on each arrival.
+    std::vector<std::deque<std::vector<Scalar>>> message;  //!< For each source, its pending messages, oldest first.
+  };
+
+  std::vector<Mailbox> mailbox;  //!< For each rank, its mailbox.
+};
+
+/**
+ * @class Transport_Socket
+ * @brief A message transport between processes on a single machine, connected pairwise by Unix domain socket pairs.
+ *
+ * @details Allows distributed algorithms to run on several processes without MPI, e.g. for testing or on a workstation.
+ * The processes are forked by run(), each owning one rank. Sends never block: whatever the socket does not accept
+ * immediately is kept in a pending buffer, which is progressed, for every peer, whenever this rank blocks in a receive.
+ * Hence, as for Transport_Local, any send order is free of deadlock. Messages between a pair of ranks are received in
+ * the order sent.
+ */
+class Transport_Socket {
+
+ public:
+  /**
+   * @brief Runs a function on a number of ranks, rank 0 on the calling process and the others on forked processes.
+   * @param[in] number_rank The number of ranks.
+   * @param[in] function The function to run, called once per rank with that rank's transport.
+   * @return True if the function returned on every rank, false if it threw or a forked process failed.
+   *
+   * @note Forked processes exit once the function returns, so must not rely on state shared with rank 0. The calling
+   *       process should have no other active threads when calling.
+   */
+  static bool run(std::size_t number_rank, const std::function<void(Transport_Socket&)>& function);
+
+  Transport_Socket(const Transport_Socket&) = delete;
+  Transport_Socket& operator=(const Transport_Socket&) = delete;
+
+  /**
+   * @brief Delivers any pending messages, then closes the sockets.
+   */
+  ~Transport_Socket();
+
+  /**
+   * @brief Sends a message to a rank, without blocking.
+   * @param[in] i_destination The destination rank.
+   * @param[in] data The message.
+   */
+  void send(std::size_t i_destination, std::span<const Scalar> data);
+
+  /**
+   * @brief Receives the next message from a rank, blocking until it arrives.
+   * @param[in] i_source The source rank.
+   * @param[out] data The message, which must be sized to the message.
+   */
+  void receive(std::size_t i_source, std::span<Scalar> data);
+
+  /**
+   * @brief Returns the rank of this process.
+   * @return The rank.
+   */
+  [[nodiscard]] inline std::size_t rank() const noexcept { return i_rank; }
+
+  /**
+   * @brief Returns the number of ranks.
+   * @return The number of ranks.
+   */
+  [[nodiscard]] inline std::size_t size() const noexcept { return socket.size(); }
+
+ private:
+  /**
+   * @brief Constructs the transport of a rank from its connected sockets.
+   * @param[in] i_rank_ The rank.
+   * @param[in] socket_ For each rank, the file descriptor of the socket to it, -1 for this rank.
+   */
+  Transport_Socket(std::size_t i_rank_, std::vector<int> socket_);
+
+  /**
+   * @brief Writes as much pending data to each peer as their sockets accept, without blocking.
+   */
+  void progress();
+
+  /**
+   * @brief Reads a number of bytes from a peer, progressing pending writes to all peers while waiting.
+   * @param[in] i_source The source rank.
+   * @param[out] data The bytes read.
+   */
+  void read(std::size_t i_source, std::span<std::byte> data);
+
+  std::size_t i_rank;                           //!< The rank of this process.
+  std::vector<int> socket;                      //!< For each rank, the socket to it, -1 for this rank.
+  std::vector<std::vector<std::byte>> pending;  //!< For each rank, the bytes sent but not yet written.
+  std::vector<std::size_t> pending_begin;       //!< For each rank, the first unwritten byte of pending.
+};
+
+#ifdef DISA_MPI
+/**
+ * @class Transport_MPI
+ * @brief A message transport over an MPI communicator, one rank per MPI process.
+ *
+ * @details Sends are non-blocking, the data being copied to a buffer retained until the send completes, and receives
+ * blocking. A single tag is used, so messages between a pair of ranks are received in the order sent. MPI must be
+ * initialised, and not yet finalised, for the lifetime of the transport.
+ */
+class Transport_MPI {
+
+ public:
+  /**
+   * @brief Constructs the transport over a communicator.
+   * @param[in] communicator_ The communicator, its ranks are the ranks of the transport.
+   */
+  explicit Transport_MPI(MPI_Comm communicator_ = MPI_COMM_WORLD);
+
+  Transport_MPI(const Transport_MPI&) = delete;
+  Transport_MPI& operator=(const Transport_MPI&) = delete;
+
+  /**
+   * @brief Waits for all outstanding sends to complete.
+   */
+  ~Transport_MPI();
+
+  /**
+   * @brief Sends a message to a rank, without blocking.
+   * @param[in] i_destination The destination rank.
+   * @param[in] data The message.
+   */
+  void send(std::size_t i_destination, std::span<const Scalar> data);
+
+  /**
+   * @brief Receives the next message from a rank, blocking until it arrives.
+   * @param[in] i_source The source rank.
+   * @param[out] data The message, which must be sized to the message.
+   */
+  void receive(std::size_t i_source, std::span<Scalar> data);
+
+  /**
+   * @brief Sums a value over all ranks.
+   * @param[in] value This rank's value.
+   * @return The sum, identical on every rank.
+   */
+  [[nodiscard]] Scalar all_reduce_sum(Scalar value);
+
+  /**
+   * @brief Finds the maximum of a value over all ranks.
+   * @param[in] value This rank's value.
+   * @return The maximum, identical on every rank.
+   */
+  [[nodiscard]] Scalar all_reduce_max(Scalar value);
+
+  /**
+   * @brief Returns the rank of this process.
+   * @return The rank.
+   */
+  [[nodiscard]] inline std::size_t rank() const noexcept { return i_rank; }
+
+  /**
+   * @brief Returns the number of ranks.
+   * @return The number of ranks.
+   */
+  [[nodiscard]] inline std::size_t size() const noexcept { return number_rank; }
+
+ private:
+  MPI_Comm communicator;                         //!< The communicator.
+  std::size_t i_rank;                            //!< The rank of this process.
+  std::size_t number_rank;                       //!< The number of ranks.
+  std::deque<MPI_Request> request;               //!< The outstanding sends, oldest first.
+  std::deque<std::vector<Scalar>> request_data;  //!< The data of each outstanding send.
+};
+#endif
+
+/**
+ * @brief Starts a halo exchange, packing and sending the owned entries each neighbour needs.
+ * @tparam _transport Type providing send(std::size_t i_destination, std::span<const Scalar> data), e.g.
+ *                    Transport_Local::Endpoint.
+ * @param[in] plan The plan of this rank's subgraph.
+ * @param[in] vector This rank's local vector.
+ * @param[in, out] transport This rank's transport.
+ *
+ * @note Owned entries may be updated once this returns, while the halo is in flight, e.g. by interior computations.
+ */
+template<class _transport>
+void halo_exchange_begin(const Halo_Exchange_Plan& plan, const Vector_Dense<Scalar, 0>& vector,
+                         _transport& transport) {
+  std::vector<Scalar> buffer;
+  FOR(i_neighbour, plan.send_neighbour.size()) {
+    const std::span<const std::size_t> index = plan.send(i_neighbour);
+    buffer.resize(index.size());
+    FOR(i_entry, index.size()) buffer[i_entry] = vector[index[i_entry]];
+    transport.send(plan.send_neighbour[i_neighbour], buffer);
+  }
+}
+
+/**
+ * @brief Completes a halo exchange, receiving and unpacking the halo entries from each neighbour.
+ * @tparam _transport Type providing receive(std::size_t i_source, std::span<Scalar> data), e.g.
+ *                    Transport_Local::Endpoint.
+ * @param[in] plan The plan of this rank's subgraph.
+ * @param[in, out] vector This rank's local vector, only halo entries change.
+ * @param[in, out] transport This rank's transport.
+ */
+template<class _transport>
+void halo_exchange_end(const Halo_Exchange_Plan& plan, Vector_Dense<Scalar, 0>& vector, _transport& transport) {
+  std::vector<Scalar> buffer;
+  FOR(i_neighbour, plan.receive_neighbour.size()) {
+    const std::span<const std::size_t> index = plan.receive(i_neighbour);
+    buffer.resize(index.size());
+    transport.receive(plan.receive_neighbour[i_neighbour], buffer);
+    FOR(i_entry, index.size()) vector[index[i_entry]] = buffer[i_entry];
+  }
+}
+
+/**
+ * @brief Refreshes the halo entries of this rank's vector from their owners, over a transport.
+ * @tparam _transport Type providing the send and receive functions of Transport_Local::Endpoint.
+ * @param[in] plan The plan of this rank's subgraph.
+ * @param[in, out] vector This rank's local vector, only halo entries change.
+ * @param[in, out] transport This rank's transport.
+ */
+template<class _transport>
+void halo_exchange(const Halo_Exchange_Plan& plan, Vector_Dense<Scalar, 0>& vector, _transport& transport) {
+  halo_exchange_begin(plan, vector, transport);
+  halo_exchange_end(plan, vector, transport);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Collectives
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Reduces a value over all ranks of a transport, using its own reduction if it has one.
+ * @tparam _transport Type providing the send, receive, rank and size functions of Transport_Local::Endpoint.
+ * @tparam _reduce Binary function type, Scalar(Scalar, Scalar), associative and commutative.
+ * @param[in, out] transport This rank's transport.
+ * @param[in] value This rank's value.
+ * @param[in] reduce The reduction.
+ * @return The reduced value, identical on every rank.
+ *
+ * @details Every rank sends its value to rank 0, which reduces them in rank order and returns the result to each.
+ * The rank order makes the result bitwise identical on all ranks, which collective decisions, e.g. convergence, need.
+ * Must be called by every rank, in the same order relative to other collectives.
+ */
+template<class _transport, class _reduce>
+[[nodiscard]] Scalar all_reduce(_transport& transport, Scalar value, _reduce reduce) {
+  if(transport.size() == 1) return value;
+  Scalar message[1] = {value};
+  if(transport.rank() == 0) {
+    FOR(i_rank, std::size_t{1}, transport.size()) {
+      transport.receive(i_rank, message);
+      value = reduce(value, message[0]);
+    }
+    message[0] = value;
+    FOR(i_rank, std::size_t{1}, transport.size()) transport.send(i_rank, message);
+  } else {
+    transport.send(0, message);
+    transport.receive(0, message);
+  }
+  return message[0];
+}
+
+/**
+ * @brief Sums a value over all ranks of a transport.
+ * @tparam _transport Type providing the send, receive, rank and size functions of Transport_Local::Endpoint, and
+ *                    optionally its own all_reduce_sum(Scalar), e.g. Transport_MPI.
+ * @param[in, out] transport This rank's transport.
+ * @param[in] value This rank's value.
+ * @return The sum, identical on every rank.
+ */
+template<class _transport>
+[[nodiscard]] Scalar all_reduce_sum(_transport& transport, const Scalar value) {
+  if constexpr(requires { transport.all_reduce_sum(value); }) return transport.all_reduce_sum(value);
+  else return all_reduce(transport, value, [](const Scalar left, const Scalar right) { return left + right; });
+}
+
+/**
+ * @brief Finds the maximum of a value over all ranks of a transport.
+ * @tparam _transport Type providing the send, receive, rank and size functions of Transport_Local::Endpoint, and
+ *                    optionally its own all_reduce_max(Scalar), e.g. Transport_MPI.
+ * @param[in, out] transport This rank's transport.
+ * @param[in] value This rank's value.
+ * @return The maximum, identical on every rank.
+ */
+template<class _transport>
+[[nodiscard]] Scalar all_reduce_max(_transport& transport, const Scalar value) {
+  if constexpr(requires { transport.all_reduce_max(value); }) return transport.all_reduce_max(value);
+  else return all_reduce(transport, value, [](const Scalar left, const Scalar right) { return std::max(left, right); });
+}
+
+}  // namespace Disa
+
+#endif  //DISA_HALO_EXCHANGE_H
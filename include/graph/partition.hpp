@@ -22,6 +22,10 @@
 #ifndef DISA_PARTITION_H
 #define DISA_PARTITION_H
 
+#include "reorder.hpp"
+#include "scalar.hpp"
+#include "vector_dense.hpp"
+
 #include <vector>
 
 namespace Disa {
@@ -52,6 +56,85 @@ void multinode_level_set_expansion(const Adjacency_Graph<false>& graph, std::siz
 std::vector<Adjacency_Subgraph> recursive_graph_bisection(const Adjacency_Graph<false>& graph,
                                                           std::size_t number_partitions);
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Multilevel Partitioning
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Partitions a graph into k balanced subgraphs, minimising the edge cut, using a multilevel scheme.
+ * @param[in] graph The graph to partition.
+ * @param[in] number_partitions The number of subgraphs to be generated.
+ * @param[in] vertex_weight The weight of each vertex, e.g. its work, empty for unit weights.
+ * @param[in] imbalance The allowed imbalance, the heaviest subgraph may weigh up to (1 + imbalance) times the average.
+ * @return A vector of subgraphs representing the partitioned graph.
+ */
+std::vector<Adjacency_Subgraph> multilevel_graph_partition(const Adjacency_Graph<false>& graph,
+                                                           std::size_t number_partitions,
+                                                           const std::vector<std::size_t>& vertex_weight = {},
+                                                           Scalar imbalance = 0.03);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Geometric Partitioning
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Partitions a graph into contiguous chunks along a space filling curve through the vertex coordinates.
+ * @tparam _dimension The spatial dimension, 2 or 3.
+ * @param[in] graph The graph to partition.
+ * @param[in] coordinate The coordinates of each vertex of the graph.
+ * @param[in] number_partitions The number of subgraphs to be generated.
+ * @param[in] curve The space filling curve to use. Defaults to Hilbert.
+ * @return A vector of subgraphs, with vertex counts differing by at most one.
+ */
+template<std::size_t _dimension>
+std::vector<Adjacency_Subgraph> space_filling_curve_partition(
+const Adjacency_Graph<false>& graph, const std::vector<Vector_Dense<Scalar, _dimension>>& coordinate,
+std::size_t number_partitions, Curve_Type curve = Curve_Type::hilbert);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Partition Metrics
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Partition_Metrics
+ * @brief Quality measures of a partitioning of a graph, used to compare partitioners.
+ *
+ * @details The communication volume of a vertex is the number of other parts it is adjacent to, i.e. the number of
+ * parts its value must be sent to in a halo exchange. The volume of a part is the sum over its vertices.
+ */
+struct Partition_Metrics {
+  std::size_t edge_cut = 0;                  //!< The number of edges between vertices of different parts.
+  std::size_t communication_volume = 0;      //!< The total communication volume, summed over all parts.
+  std::size_t communication_volume_max = 0;  //!< The largest communication volume of any single part.
+  Scalar imbalance = 0;                      //!< The heaviest part weight over the average part weight, less one.
+  std::vector<std::size_t> part_weight;      //!< For each part, the sum of its vertex weights.
+  std::vector<std::size_t> boundary_vertex;  //!< For each part, the number of vertices adjacent to another part.
+  std::vector<std::size_t> neighbour_part;   //!< For each part, the number of other parts it is adjacent to.
+  std::vector<std::size_t> component;        //!< For each part, the number of connected components it consists of.
+};
+
+/**
+ * @brief Computes the quality metrics of a partitioning given as a part per vertex.
+ * @param[in] graph The partitioned graph.
+ * @param[in] vertex_part The part of each vertex, the number of parts is taken as the largest part plus one.
+ * @param[in] vertex_weight The weight of each vertex, e.g. its work, empty for unit weights.
+ * @return The partition metrics.
+ */
+[[nodiscard]] Partition_Metrics partition_metrics(const Adjacency_Graph<false>& graph,
+                                                  const std::vector<std::size_t>& vertex_part,
+                                                  const std::vector<std::size_t>& vertex_weight = {});
+
+/**
+ * @brief Computes the quality metrics of a partitioning given as subgraphs of the graph.
+ * @param[in] graph The parent graph of the subgraphs.
+ * @param[in] subgraph_list The subgraphs, whose primary (level 0) vertices must cover each vertex exactly once.
+ * @param[in] vertex_weight The weight of each vertex, e.g. its work, empty for unit weights.
+ * @return The partition metrics.
+ */
+[[nodiscard]] Partition_Metrics partition_metrics(const Adjacency_Graph<false>& graph,
+                                                  const std::vector<Adjacency_Subgraph>& subgraph_list,
+                                                  const std::vector<std::size_t>& vertex_weight = {});
+
 }  // namespace Disa
 
 #endif  //DISA_PARTITION_H
@@ -23,26 +23,32 @@
 #define DISA_REORDER_H
 
 #include "adjacency_graph.hpp"
+#include "matrix_sparse.hpp"
+#include "vector_dense.hpp"
 
+#include <cstdint>
+#include <limits>
 #include <numeric>
 
 namespace Disa {
 
+class Adjacency_Subgraph;
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Level-Set Orderings
 // ---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Constructs a permutation vector for a given non-disjoint graph using the bread first (search) algorithm.
- * @param[in] graph The graph to reorder.
+ * @brief Constructs a permutation vector for a given graph using the bread first (search) algorithm.
+ * @param[in] graph The graph to reorder, may be disjoint, its components being ordered one after another.
  * @param[in] start_vertex The new graph root vertex, or starting vertex for the reordering. Defaults to 0.
  * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
  */
 [[nodiscard]] std::vector<std::size_t> breadth_first(const Adjacency_Graph<false>& graph, std::size_t start_vertex = 0);
 
 /**
- * @brief Constructs a permutation vector given non-disjoint graph using the Cuthill-Mckee algorithm.
- * @param[in] graph The graph to reorder.
+ * @brief Constructs a permutation vector given graph using the Cuthill-Mckee algorithm.
+ * @param[in] graph The graph to reorder, may be disjoint, its components being ordered one after another.
  * @param[in] start_vertex The new graph root vertex, if default a periphery node will be search for. Defaults to max().
  * @return The permutation vector mapping the old to new graph, i.e. new_index = re_order[old_index].
  */
@@ -50,8 +56,8 @@ std::vector<std::size_t> cuthill_mckee(const Adjacency_Graph<false>& graph,
                                        std::size_t start_vertex = std::numeric_limits<std::size_t>::max());
 
 /**
- * @brief Constructs a permutation vector given non-disjoint graph using the Reverse Cuthill-Mckee algorithm.
- * @param[in] graph The graph to reorder.
+ * @brief Constructs a permutation vector given graph using the Reverse Cuthill-Mckee algorithm.
+ * @param[in] graph The graph to reorder, may be disjoint.
  * @param[in] root_vertex The new graph root vertex, if default a periphery node will be search for. Defaults to max().
  * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
  */
@@ -64,6 +70,107 @@ const Adjacency_Graph<false>& graph, std::size_t root_vertex = std::numeric_limi
   return permutation;
 };
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Fill Reducing Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a fill reducing permutation vector using the approximate minimum degree (AMD) algorithm.
+ * @param[in] graph The graph to reorder, may be disjoint.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+std::vector<std::size_t> approximate_minimum_degree(const Adjacency_Graph<false>& graph);
+
+/**
+ * @struct Separator_Tree_Node
+ * @brief A node of a separator tree, its own vertices, and those of its subtree, are contiguous in the new ordering.
+ * @note Indices are those of the new ordering, for leaves separator = begin, i.e. all vertices are the node's own.
+ */
+struct Separator_Tree_Node {
+  std::size_t parent{std::numeric_limits<std::size_t>::max()};       //!< The parent node, max() for the root.
+  std::size_t child_left{std::numeric_limits<std::size_t>::max()};   //!< The first child, max() for leaves.
+  std::size_t child_right{std::numeric_limits<std::size_t>::max()};  //!< The second child, max() for leaves.
+  std::size_t begin{0};                                              //!< The first index of the subtree.
+  std::size_t separator{0};                                          //!< The first index of the node's own vertices.
+  std::size_t end{0};                                                //!< One past the last index of the subtree.
+};
+
+/**
+ * @struct Separator_Tree
+ * @brief The tree of separators produced by nested dissection, the root (node 0) holds the top level separator.
+ *
+ * @details The two subtrees of a node are mutually independent, i.e. no edge connects them, and so they may be
+ * eliminated (factorised) in parallel. Each node's own vertices, [separator, end), are numbered after its subtrees.
+ */
+struct Separator_Tree {
+  std::vector<Separator_Tree_Node> node;  //!< The nodes of the tree, parents always precede their children.
+
+  /**
+   * @brief Checks if a node of the tree is a leaf.
+   * @param[in] i_node The node to check.
+   * @return True if the node has no children, else false.
+   */
+  [[nodiscard]] inline bool is_leaf(const std::size_t i_node) const {
+    return node[i_node].child_left == std::numeric_limits<std::size_t>::max();
+  };
+};
+
+/**
+ * @brief Constructs a fill reducing permutation vector using nested dissection, with level-set vertex separators.
+ * @param[in] graph The graph to reorder, may be disjoint.
+ * @param[out] separator_tree The separator tree of the dissection.
+ * @param[in] leaf_size Subgraphs with this number, or fewer, vertices are not dissected further. Defaults to 64.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+std::vector<std::size_t> nested_dissection(const Adjacency_Graph<false>& graph, Separator_Tree& separator_tree,
+                                           std::size_t leaf_size = 64);
+
+/**
+ * @brief Constructs a fill reducing permutation vector using nested dissection, with level-set vertex separators.
+ * @param[in] graph The graph to reorder, may be disjoint.
+ * @param[in] leaf_size Subgraphs with this number, or fewer, vertices are not dissected further. Defaults to 64.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+inline std::vector<std::size_t> nested_dissection(const Adjacency_Graph<false>& graph, std::size_t leaf_size = 64) {
+  Separator_Tree separator_tree;
+  return nested_dissection(graph, separator_tree, leaf_size);
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Geometric Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @enum Curve_Type
+ * @brief Enumerated list of the space filling curves available for geometric orderings.
+ */
+enum class Curve_Type {
+  hilbert,  //!< The Hilbert curve, consecutive cells are always face neighbours.
+  morton    //!< The Morton (Z-order) curve, cheaper to compute but with jumps between quadrants/octants.
+};
+
+/**
+ * @brief Computes the space filling curve key of each vertex, from its coordinates.
+ * @tparam _dimension The spatial dimension, 2 or 3.
+ * @param[in] coordinate The coordinates of each vertex.
+ * @param[in] curve The space filling curve to use. Defaults to Hilbert.
+ * @return The key of each vertex, i.e. its (quantised) position along the curve.
+ */
+template<std::size_t _dimension>
+std::vector<std::uint64_t> space_filling_curve_key(const std::vector<Vector_Dense<Scalar, _dimension>>& coordinate,
+                                                   Curve_Type curve = Curve_Type::hilbert);
+
+/**
+ * @brief Constructs a permutation vector from vertex coordinates, by ordering the vertices along a space filling curve.
+ * @tparam _dimension The spatial dimension, 2 or 3.
+ * @param[in] coordinate The coordinates of each vertex.
+ * @param[in] curve The space filling curve to use. Defaults to Hilbert.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+template<std::size_t _dimension>
+std::vector<std::size_t> space_filling_curve(const std::vector<Vector_Dense<Scalar, _dimension>>& coordinate,
+                                             Curve_Type curve = Curve_Type::hilbert);
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Multicolour Ordering
 // ---------------------------------------------------------------------------------------------------------------------
@@ -75,5 +182,118 @@ const Adjacency_Graph<false>& graph, std::size_t root_vertex = std::numeric_limi
  */
 std::vector<std::size_t> greedy_multicolouring(const Adjacency_Graph<false>& graph);
 
+/**
+ * @brief Colours the vertices of a graph in parallel, so that no two adjacent vertices share a colour.
+ * @param[in] graph The graph to colour.
+ * @param[in] is_balanced If true, vertices are moved out of over full colours to even the colour sizes, without adding
+ *                        colours. Defaults to false.
+ * @return The colour of each vertex, numbered from 0.
+ */
+std::vector<std::size_t> jones_plassmann_colouring(const Adjacency_Graph<false>& graph, bool is_balanced = false);
+
+/**
+ * @brief Constructs a permutation vector given non-disjoint graph using a parallel multicolouring algorithm.
+ * @param[in] graph The graph to reorder.
+ * @param[in] is_balanced If true, the colours are balanced in size, see jones_plassmann_colouring.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+std::vector<std::size_t> jones_plassmann_multicolouring(const Adjacency_Graph<false>& graph, bool is_balanced = false);
+
+/**
+ * @brief Constructs the permutation grouping vertices by colour, in increasing colour then increasing vertex order.
+ * @param[in] colour The colour of each vertex, numbered from 0.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+std::vector<std::size_t> colour_permutation(const std::vector<std::size_t>& colour);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Subgraph Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Interior_Boundary_Split
+ * @brief A subgraph ordering placing the interior, then the boundary, then the halo vertices contiguously.
+ *
+ * @details Interior vertices are primary (level 0) vertices with no halo neighbours, so the rows of a local matrix
+ * assembled on them only use owned entries, and can be computed while the halo is exchanged. Boundary vertices are the
+ * primary vertices with a halo neighbour, and halo vertices those with a non-zero level.
+ */
+struct Interior_Boundary_Split {
+  std::vector<std::size_t> permutation;  //!< The ordering, new_index = permutation[old_index].
+  std::size_t size_interior = 0;         //!< The number of interior vertices.
+  std::size_t size_boundary = 0;         //!< The number of boundary vertices.
+  std::size_t size_halo = 0;             //!< The number of halo vertices.
+
+  /**
+   * @return The [begin, end) new index range of the interior vertices, and rows of the local matrix.
+   */
+  [[nodiscard]] inline std::pair<std::size_t, std::size_t> interior() const noexcept { return {0, size_interior}; }
+
+  /**
+   * @return The [begin, end) new index range of the boundary vertices, and rows of the local matrix.
+   */
+  [[nodiscard]] inline std::pair<std::size_t, std::size_t> boundary() const noexcept {
+    return {size_interior, size_interior + size_boundary};
+  }
+
+  /**
+   * @return The [begin, end) new index range of the halo vertices.
+   */
+  [[nodiscard]] inline std::pair<std::size_t, std::size_t> halo() const noexcept {
+    return {size_interior + size_boundary, size_interior + size_boundary + size_halo};
+  }
+};
+
+/**
+ * @brief Constructs the interior, boundary, then halo ordering of a subgraph, keeping a given ordering within each.
+ * @param[in] subgraph The subgraph, which must have at least one halo level for its boundary to be found.
+ * @param[in] permutation The ordering to keep within each class, e.g. cuthill_mckee(subgraph.local_graph()) or a
+ *                        space filling curve, new_index = permutation[old_index]. Empty for the current ordering.
+ * @return The split ordering, to be applied with subgraph.reorder(split.permutation).
+ */
+[[nodiscard]] Interior_Boundary_Split interior_boundary_split(const Adjacency_Subgraph& subgraph,
+                                                              const std::vector<std::size_t>& permutation = {});
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Ordering Metrics
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Ordering_Metrics
+ * @brief Locality measures of a (permuted) graph or matrix, used to compare candidate orderings.
+ *
+ * @details All measures are taken in the new (permuted) indexing, with (i, j) a non-zero or edge. The diagonal is
+ * assumed present in every row, as it is for the matrices assembled on these graphs.
+ */
+struct Ordering_Metrics {
+  std::size_t bandwidth = 0;     //!< The maximum |i - j|.
+  std::size_t profile = 0;       //!< The lower envelope size, sum over the rows of i - min(j, i).
+  Scalar average_distance = 0;   //!< The mean |i - j| over the off-diagonal entries.
+  Scalar cache_line_reuse = 0;   //!< The fraction of row gathers hitting a line already used by this or the last row.
+};
+
+/**
+ * @brief Computes the bandwidth, profile and locality of a graph under a permutation, without applying it.
+ * @param[in] graph The graph.
+ * @param[in] permutation The candidate ordering, new_index = permutation[old_index]. Empty for the current ordering.
+ * @param[in] line_size The number of vector entries per cache line, defaults to 8 (64 byte lines of doubles).
+ * @return The ordering metrics.
+ */
+[[nodiscard]] Ordering_Metrics ordering_metrics(const Adjacency_Graph<false>& graph,
+                                                const std::vector<std::size_t>& permutation = {},
+                                                std::size_t line_size = 8);
+
+/**
+ * @brief Computes the bandwidth, profile and locality of a square matrix under a symmetric permutation, without
+ * applying it.
+ * @param[in] matrix The square sparse matrix.
+ * @param[in] permutation The candidate ordering, new_index = permutation[old_index]. Empty for the current ordering.
+ * @param[in] line_size The number of vector entries per cache line, defaults to 8 (64 byte lines of doubles).
+ * @return The ordering metrics.
+ */
+[[nodiscard]] Ordering_Metrics ordering_metrics(const Matrix_Sparse& matrix,
+                                                const std::vector<std::size_t>& permutation = {},
+                                                std::size_t line_size = 8);
+
 }  // namespace Disa
 #endif  //DISA_REORDER_H
@@ -24,11 +24,13 @@
 
 #include "direct.hpp"
 #include "matrix_dense.hpp"
+#include "parallel.hpp"
 #include "solver_utilities.hpp"
 #include "vector_dense.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 namespace Disa {
 
@@ -68,12 +70,17 @@ class Direct_Lower_Upper_Factorisation
     ASSERT(config.type == _solver_type, "Miss-match between config tpye and LU/LUP selection.");
     ASSERT(config.pivot == _pivot, "Miss-match between config pivoting and LU/LUP selection.");
     factorisation_tolerance = config.factor_tolerance;
+    mixed_precision = config.mixed_precision;
+    refinement_iterations = config.refinement_iterations;
   };
 
   /**
    * @brief Factorises the coefficient matrix, using LU(P) factorisation.
    * @param[in] a_matrix The coefficient matrix to factorise.
    * @return True if the matrix was factorised successfully, else false for degenerate/singular matrices.
+   *
+   * @warning In mixed precision mode the solver keeps a reference to a_matrix, to compute the refinement residuals, it
+   * must therefore outlive all subsequent solves.
    */
   bool factorise(const Matrix_Dense<Scalar, _size, _size>& a_matrix);
 
@@ -88,6 +95,17 @@ class Direct_Lower_Upper_Factorisation
    */
   Convergence_Data solve_system(Vector_Dense<Scalar, _size>& x_vector, const Vector_Dense<Scalar, _size>& b_vector);
 
+  /**
+   * @brief Solves the linear system for multiple right hand sides, AX = B, using the factorised coefficient matrix.
+   * @tparam _size_rhs The number of right hand sides, if zero dynamically sized.
+   * @param[out] x_matrix The solutions (column wise), will be resized and modified, inital value is irrelevant.
+   * @param[in] b_matrix The constants (column wise), appropriate to the coefficient matrix which was factorised.
+   * @return A Convergence_Data object detailing the solve status (the least converged of the right hand sides).
+   */
+  template<std::size_t _size_rhs>
+  Convergence_Data solve_system(Matrix_Dense<Scalar, _size, _size_rhs>& x_matrix,
+                                const Matrix_Dense<Scalar, _size, _size_rhs>& b_matrix);
+
   /**
    * @brief Gets the current configuration of the solver.
    * @return A configuration object, containing the current solver configuration.
@@ -97,6 +115,8 @@ class Direct_Lower_Upper_Factorisation
     config.type = _solver_type;
     config.pivot = _pivot;
     config.factor_tolerance = factorisation_tolerance;
+    config.mixed_precision = mixed_precision;
+    config.refinement_iterations = refinement_iterations;
     return config;
   }
 
@@ -107,6 +127,46 @@ class Direct_Lower_Upper_Factorisation
   Matrix_Dense<Scalar, _size, _size>
   lu_factorised;                    //<! The factorised LU coefficient matrix (implicit 1's on diagonal of L).
   std::vector<std::size_t> pivots;  //<! The pivots indicies, is only sized for LUP solver.
+
+  static constexpr std::size_t block_size = 64;      //<! The number of columns in each panel of the factorisation.
+  static constexpr std::size_t tile_size = 512;      //<! The number of columns in each tile of the trailing update.
+  static constexpr std::size_t trailing_grain = 32;  //<! The minimum number of trailing rows per thread.
+
+  // Mixed precision
+  bool mixed_precision{false};            //<! Factorise in single precision, and refine solutions in double.
+  std::size_t refinement_iterations{10};  //<! Maximum refinement iterations before falling back to double precision.
+  bool single_factorised{false};          //<! Is the single precision factorisation the active one.
+  bool fallback{false};                   //<! Has the solver fallen back to a double precision factorisation.
+  Matrix_Dense<float, _size, _size> lu_factorised_single;  //<! The single precision factorised LU matrix.
+  const Matrix_Dense<Scalar, _size, _size>* a_matrix_factorised{nullptr};  //<! The (double) matrix factorised.
+
+  /**
+   * @brief Factorises a matrix in place, in the precision of the matrix, updating the pivots.
+   * @tparam _type The floating point type of the factorisation.
+   * @param[in,out] lu_matrix The matrix to factorise on entry, the LU factors on exit.
+   * @return True if the matrix was factorised successfully, else false.
+   */
+  template<typename _type>
+  bool factorise_matrix(Matrix_Dense<_type, _size, _size>& lu_matrix);
+
+  /**
+   * @brief Performs the forward and backward substitution, in the precision of the factors.
+   * @tparam _type The floating point type of the factorisation.
+   * @param[in] lu_matrix The LU factors.
+   * @param[out] x_vector The solution vector, must be sized.
+   * @param[in] b_vector The constant vector.
+   */
+  template<typename _type>
+  void substitute(const Matrix_Dense<_type, _size, _size>& lu_matrix, Vector_Dense<_type, _size>& x_vector,
+                  const Vector_Dense<_type, _size>& b_vector) const;
+
+  /**
+   * @brief Solves the linear system using the single precision factors, refined to double precision accuracy.
+   * @param[out] x_vector The solution vector, must be sized.
+   * @param[in] b_vector The constant vector.
+   * @return A Convergence_Data object detailing the refinement and if a fallback to double precision was required.
+   */
+  Convergence_Data solve_system_mixed(Vector_Dense<Scalar, _size>& x_vector, const Vector_Dense<Scalar, _size>& b_vector);
 };
 
 template<std::size_t _size>
@@ -145,85 +205,327 @@ const Matrix_Dense<Scalar, _size, _size>& a_matrix) {
 
   // Initialise factorisation data.
   factorised = false;
+  single_factorised = false;
+  fallback = false;
+  a_matrix_factorised = nullptr;
+
+  // Mixed precision, factorise in single and only fall back to double if the single factorisation breaks down.
+  if(mixed_precision) {
+    a_matrix_factorised = &a_matrix;
+    if constexpr(_size == 0) lu_factorised_single.resize(a_matrix.size_row(), a_matrix.size_column());
+    FOR(i_row, a_matrix.size_row()) FOR(i_column, a_matrix.size_column()) {
+      lu_factorised_single[i_row][i_column] = static_cast<float>(a_matrix[i_row][i_column]);
+    }
+    single_factorised = factorise_matrix(lu_factorised_single);
+    if(single_factorised) {
+      factorised = true;
+      return true;
+    }
+    fallback = true;
+  }
+
   lu_factorised = a_matrix;
+  factorised = factorise_matrix(lu_factorised);
+  return factorised;
+}
+
+/**
+ * @details Blocked right-looking factorisation, templated on the floating point type such that the same algorithm (and
+ * therefore results) is used for both the double and single precision factorisations. For each panel of block_size
+ * columns:
+ *
+ * 1. Panel: the columns of the panel are factorised (with partial pivoting), updating only the panel columns. Pivot
+ *    rows are swapped in full.
+ * 2. U_12: the rows of the panel, right of the panel, are solved against the unit lower triangle of the panel.
+ * 3. Trailing update: A_22 -= L_21 U_12, as row-wise axpy's tiled over columns so the U_12 tile remains in cache, with
+ *    the rows split across threads.
+ *
+ * Every element receives its updates in the same (ascending pivot) order as the unblocked Doolittle algorithm, and
+ * the pivot search sees the same values, the factors are therefore identical to those of the unblocked algorithm.
+ */
+template<Solver_Type _solver_type, std::size_t _size, bool _pivot>
+template<typename _type>
+bool Direct_Lower_Upper_Factorisation<_solver_type, _size, _pivot>::factorise_matrix(
+Matrix_Dense<_type, _size, _size>& lu_matrix) {
+
+  const std::size_t size = lu_matrix.size_row();
   if(_pivot) {
-    pivots.resize(lu_factorised.size_column());
+    pivots.resize(lu_matrix.size_column());
     std::iota(pivots.begin(), pivots.end(), 0);
   }
 
-  // Factorise A into L and U.
-  for(std::size_t i_row = 0; i_row < lu_factorised.size_row(); ++i_row) {
+  for(std::size_t i_panel = 0; i_panel < size; i_panel += block_size) {
+    const std::size_t i_panel_end = std::min(i_panel + block_size, size);
+
+    // Panel factorisation.
+    for(std::size_t i_row = i_panel; i_row < i_panel_end; ++i_row) {
+
+      // Pivoting
+      if(_pivot) {
 
-    // Pivoting
-    if(_pivot) {
+        // Find largest remaining column value to pivot on.
+        Scalar max = 0.0;
+        std::size_t i_max = i_row;
+        for(std::size_t i_row_sweep = i_row; i_row_sweep < size; ++i_row_sweep) {
+          const Scalar absA = std::abs(lu_matrix[i_row_sweep][i_row]);
+          if(is_nearly_greater(absA, max)) {
+            max = absA;
+            i_max = i_row_sweep;
+          }
+        }
 
-      // Find largest remaining column value to pivot on.
-      Scalar max = 0.0;
-      std::size_t i_max = i_row;
-      for(std::size_t i_row_sweep = i_row; i_row_sweep < lu_factorised.size_column(); ++i_row_sweep) {
-        const Scalar absA = std::abs(lu_factorised[i_row_sweep][i_row]);
-        if(is_nearly_greater(absA, max)) {
-          max = absA;
-          i_max = i_row_sweep;
+        // Pivot if larger value found.
+        if(i_max != i_row) {
+          std::swap(pivots[i_row], pivots[i_max]);
+          std::swap(lu_matrix[i_row], lu_matrix[i_max]);
         }
       }
 
-      // Pivot if larger value found.
-      if(i_max != i_row) {
-        std::swap(pivots[i_row], pivots[i_max]);
-        std::swap(lu_factorised[i_row], lu_factorised[i_max]);
+      // Check degeneracy.
+      if(std::abs(lu_matrix[i_row][i_row]) < factorisation_tolerance) return false;
+
+      // Decomposition, restricted to the panel columns.
+      for(std::size_t i_row_sweep = i_row + 1; i_row_sweep < size; ++i_row_sweep) {
+        lu_matrix[i_row_sweep][i_row] /= lu_matrix[i_row][i_row];
+        for(std::size_t i_column_sweep = i_row + 1; i_column_sweep < i_panel_end; ++i_column_sweep)
+          lu_matrix[i_row_sweep][i_column_sweep] -= lu_matrix[i_row_sweep][i_row] * lu_matrix[i_row][i_column_sweep];
       }
     }
+    if(i_panel_end == size) break;
+
+    // U_12, forward substitution with the unit lower triangle of the panel.
+    for(std::size_t i_row = i_panel; i_row < i_panel_end; ++i_row) {
+      for(std::size_t i_row_sweep = i_row + 1; i_row_sweep < i_panel_end; ++i_row_sweep) {
+        const _type factor = lu_matrix[i_row_sweep][i_row];
+        for(std::size_t i_column = i_panel_end; i_column < size; ++i_column)
+          lu_matrix[i_row_sweep][i_column] -= factor * lu_matrix[i_row][i_column];
+      }
+    }
+
+    // Trailing update, A_22 -= L_21 U_12.
+    parallel_for_block(
+    size - i_panel_end,
+    [&](const std::size_t i_begin, const std::size_t i_end) {
+      for(std::size_t i_tile = i_panel_end; i_tile < size; i_tile += tile_size) {
+        const std::size_t i_tile_end = std::min(i_tile + tile_size, size);
+        for(std::size_t i_row_sweep = i_panel_end + i_begin; i_row_sweep < i_panel_end + i_end; ++i_row_sweep) {
+          for(std::size_t i_row = i_panel; i_row < i_panel_end; ++i_row) {
+            const _type factor = lu_matrix[i_row_sweep][i_row];
+            for(std::size_t i_column = i_tile; i_column < i_tile_end; ++i_column)
+              lu_matrix[i_row_sweep][i_column] -= factor * lu_matrix[i_row][i_column];
+          }
+        }
+      }
+    },
+    trailing_grain);
+  }
+  return true;
+}
 
-    // Check degeneracy.
-    if(std::abs(lu_factorised[i_row][i_row]) < factorisation_tolerance) return false;
+template<Solver_Type _solver_type, std::size_t _size, bool _pivot>
+Convergence_Data Direct_Lower_Upper_Factorisation<_solver_type, _size, _pivot>::solve_system(
+Vector_Dense<Scalar, _size>& x_vector, const Vector_Dense<Scalar, _size>& b_vector) {
 
-    // Decomposition, actual factorisation to compute L and U.
-    for(std::size_t i_row_sweep = i_row + 1; i_row_sweep < lu_factorised.size_row(); ++i_row_sweep) {
-      lu_factorised[i_row_sweep][i_row] /= lu_factorised[i_row][i_row];
+  ASSERT_DEBUG(b_vector.size() == (single_factorised ? lu_factorised_single.size_row() : lu_factorised.size_row()),
+               "Constant vector not of the correct size.");
 
-      for(std::size_t i_column_sweep = i_row + 1; i_column_sweep < lu_factorised.size_column(); ++i_column_sweep)
-        lu_factorised[i_row_sweep][i_column_sweep] -=
-        lu_factorised[i_row_sweep][i_row] * lu_factorised[i_row][i_column_sweep];
-    }
-  }
+  Convergence_Data convergence_data = Convergence_Data();
+  if(!factorised) return convergence_data;
 
-  factorised = true;
-  return true;
+  x_vector.resize(b_vector.size());
+  if(single_factorised) return solve_system_mixed(x_vector, b_vector);
+
+  ++convergence_data.iteration;
+  substitute(lu_factorised, x_vector, b_vector);
+  convergence_data.converged = true;
+  convergence_data.fallback = fallback;
+  return convergence_data;
 }
 
 /**
- * @details 
- * This function solves a linear system of equations using direct lower-upper factorization. It takes an input dense 
- * vector `b_vector` representing the right-hand side of constants, and solves for the solution vector `x_vector`. A 
- * forward and backward sweep are performed with the LU factorised matrix to compute the solution. The x vector will be 
- * resized appropriately to solve, while the b-vector must be sized appropriately to the lu-factored matrix. Should no 
- * factorisation have been completed the solver returns an 'un-converged state'.
+ * @details The right hand sides are split, in contiguous blocks of columns, across threads. Each thread then performs
+ * the forward and backward substitution on its block, as row-wise axpy's over the block's columns. Each column thus
+ * sees exactly the operations of the single right hand side solve. In mixed precision mode each column is solved, and
+ * refined, individually.
  */
 template<Solver_Type _solver_type, std::size_t _size, bool _pivot>
+template<std::size_t _size_rhs>
 Convergence_Data Direct_Lower_Upper_Factorisation<_solver_type, _size, _pivot>::solve_system(
-Vector_Dense<Scalar, _size>& x_vector, const Vector_Dense<Scalar, _size>& b_vector) {
+Matrix_Dense<Scalar, _size, _size_rhs>& x_matrix, const Matrix_Dense<Scalar, _size, _size_rhs>& b_matrix) {
 
-  ASSERT_DEBUG(b_vector.size() == lu_factorised.size_row(), "Constant vector not of the correct size.");
+  const std::size_t size = b_matrix.size_row();
+  const std::size_t size_rhs = b_matrix.size_column();
+  ASSERT_DEBUG(size == (single_factorised ? lu_factorised_single.size_row() : lu_factorised.size_row()),
+               "Constant matrix not of the correct size.");
 
   Convergence_Data convergence_data = Convergence_Data();
   if(!factorised) return convergence_data;
+  if constexpr(_size_rhs == 0) x_matrix.resize(size, size_rhs);
+
+  if(single_factorised) {
+    Vector_Dense<Scalar, _size> x_vector;
+    Vector_Dense<Scalar, _size> b_vector;
+    if constexpr(_size == 0) b_vector.resize(size);
+    convergence_data.converged = true;
+    FOR(i_rhs, size_rhs) {
+      FOR(i_row, size) b_vector[i_row] = b_matrix[i_row][i_rhs];
+      const Convergence_Data column_data = solve_system(x_vector, b_vector);
+      FOR(i_row, size) x_matrix[i_row][i_rhs] = x_vector[i_row];
+      const bool converged = convergence_data.converged && column_data.converged;
+      const bool fallback = convergence_data.fallback || column_data.fallback;
+      if(column_data.iteration >= convergence_data.iteration) convergence_data = column_data;
+      convergence_data.converged = converged;
+      convergence_data.fallback = fallback;
+    }
+    return convergence_data;
+  }
+
+  parallel_for_block(
+  size_rhs,
+  [&](const std::size_t i_begin, const std::size_t i_end) {
+    for(std::size_t i_row = 0; i_row < size; ++i_row) {
+      for(std::size_t i_rhs = i_begin; i_rhs < i_end; ++i_rhs)
+        x_matrix[i_row][i_rhs] = b_matrix[_pivot ? pivots[i_row] : i_row][i_rhs];
+      for(std::size_t i_column = 0; i_column < i_row; ++i_column) {
+        const Scalar factor = lu_factorised[i_row][i_column];
+        for(std::size_t i_rhs = i_begin; i_rhs < i_end; ++i_rhs)
+          x_matrix[i_row][i_rhs] -= factor * x_matrix[i_column][i_rhs];
+      }
+    }
+
+    for(std::size_t i_row = size - 1; i_row != std::numeric_limits<std::size_t>::max(); --i_row) {
+      for(std::size_t i_column = i_row + 1; i_column < size; ++i_column) {
+        const Scalar factor = lu_factorised[i_row][i_column];
+        for(std::size_t i_rhs = i_begin; i_rhs < i_end; ++i_rhs)
+          x_matrix[i_row][i_rhs] -= factor * x_matrix[i_column][i_rhs];
+      }
+      for(std::size_t i_rhs = i_begin; i_rhs < i_end; ++i_rhs) x_matrix[i_row][i_rhs] /= lu_factorised[i_row][i_row];
+    }
+  },
+  16);
 
   ++convergence_data.iteration;
-  x_vector.resize(b_vector.size());
-  for(std::size_t i_row = 0; i_row < lu_factorised.size_row(); ++i_row) {
+  convergence_data.converged = true;
+  convergence_data.fallback = fallback;
+  return convergence_data;
+}
+
+/**
+ * @details Standard forward (with the row permutation applied to b for LUP) then backward substitution.
+ */
+template<Solver_Type _solver_type, std::size_t _size, bool _pivot>
+template<typename _type>
+void Direct_Lower_Upper_Factorisation<_solver_type, _size, _pivot>::substitute(
+const Matrix_Dense<_type, _size, _size>& lu_matrix, Vector_Dense<_type, _size>& x_vector,
+const Vector_Dense<_type, _size>& b_vector) const {
+  for(std::size_t i_row = 0; i_row < lu_matrix.size_row(); ++i_row) {
     x_vector[i_row] = b_vector[_pivot ? pivots[i_row] : i_row];
 
     for(std::size_t i_column = 0; i_column < i_row; ++i_column)
-      x_vector[i_row] -= lu_factorised[i_row][i_column] * x_vector[i_column];
+      x_vector[i_row] -= lu_matrix[i_row][i_column] * x_vector[i_column];
   }
 
-  for(std::size_t i_row = lu_factorised.size_row() - 1; i_row != std::numeric_limits<std::size_t>::max(); --i_row) {
-    for(std::size_t i_column = i_row + 1; i_column < lu_factorised.size_column(); ++i_column)
-      x_vector[i_row] -= lu_factorised[i_row][i_column] * x_vector[i_column];
-    x_vector[i_row] /= lu_factorised[i_row][i_row];
+  for(std::size_t i_row = lu_matrix.size_row() - 1; i_row != std::numeric_limits<std::size_t>::max(); --i_row) {
+    for(std::size_t i_column = i_row + 1; i_column < lu_matrix.size_column(); ++i_column)
+      x_vector[i_row] -= lu_matrix[i_row][i_column] * x_vector[i_column];
+    x_vector[i_row] /= lu_matrix[i_row][i_row];
   }
+}
+
+/**
+ * @details Mixed precision iterative refinement (as per LAPACK's dsgesv). The single precision factors give an initial
+ * solution, x_0, which is refined as
+ *
+ * r_k = b - A x_k           (double, using the original matrix),
+ * (LU) d_k = r_k            (single),
+ * x_{k+1} = x_k + d_k       (double),
+ *
+ * until |r_k|_inf <= sqrt(n) eps |A|_inf |x_k|_inf, i.e. a double precision backward stable solution. If the residual
+ * fails to halve between iterations, or the iteration limit is reached, the matrix is too ill-conditioned for single
+ * precision factors. The solver then falls back to a double precision factorisation, used for all subsequent solves,
+ * which is reported via the fallback flag. Iterations count the residual evaluations, the residual norms are those of
+ * the final solution normalised to that of the initial (unrefined) solution.
+ */
+template<Solver_Type _solver_type, std::size_t _size, bool _pivot>
+Convergence_Data Direct_Lower_Upper_Factorisation<_solver_type, _size, _pivot>::solve_system_mixed(
+Vector_Dense<Scalar, _size>& x_vector, const Vector_Dense<Scalar, _size>& b_vector) {
+
+  const Matrix_Dense<Scalar, _size, _size>& a_matrix = *a_matrix_factorised;
+  const std::size_t size = b_vector.size();
+  Convergence_Data convergence_data = Convergence_Data();
+
+  Vector_Dense<Scalar, _size> residual;
+  Vector_Dense<float, _size> single_x;
+  Vector_Dense<float, _size> single_b;
+  if constexpr(_size == 0) {
+    residual.resize(size);
+    single_x.resize(size);
+    single_b.resize(size);
+  }
+
+  Scalar a_norm = 0;
+  FOR(i_row, size) {
+    Scalar row_sum = 0;
+    FOR(i_column, size) row_sum += std::abs(a_matrix[i_row][i_column]);
+    a_norm = std::max(a_norm, row_sum);
+  }
+
+  // Computes r = b - Ax and its norms, returning the linf norm.
+  const auto update_residual = [&]() {
+    Scalar l2_norm = 0;
+    Scalar linf_norm = 0;
+    FOR(i_row, size) {
+      Scalar value = b_vector[i_row];
+      FOR(i_column, size) value -= a_matrix[i_row][i_column] * x_vector[i_column];
+      residual[i_row] = value;
+      l2_norm += value * value;
+      linf_norm = std::max(linf_norm, std::abs(value));
+    }
+    convergence_data.residual = std::sqrt(l2_norm / static_cast<Scalar>(size));
+    convergence_data.residual_max = linf_norm;
+    if(!convergence_data.iteration) {
+      convergence_data.residual_0 = convergence_data.residual;
+      convergence_data.residual_max_0 = convergence_data.residual_max;
+    }
+    convergence_data.residual_normalised = convergence_data.residual / convergence_data.residual_0;
+    convergence_data.residual_max_normalised = convergence_data.residual_max / convergence_data.residual_max_0;
+    ++convergence_data.iteration;
+    return linf_norm;
+  };
 
+  // Initial single precision solve.
+  FOR(i_row, size) single_b[i_row] = static_cast<float>(b_vector[i_row]);
+  substitute(lu_factorised_single, single_x, single_b);
+  FOR(i_row, size) x_vector[i_row] = static_cast<Scalar>(single_x[i_row]);
+
+  Scalar residual_previous = scalar_max;
+  FOR(i_refine, refinement_iterations + 1) {
+    const Scalar residual_norm = update_residual();
+    Scalar x_norm = 0;
+    FOR(i_row, size) x_norm = std::max(x_norm, std::abs(x_vector[i_row]));
+    const Scalar tolerance = std::sqrt(static_cast<Scalar>(size)) * std::numeric_limits<Scalar>::epsilon() * a_norm;
+    if(residual_norm <= tolerance * x_norm) {
+      convergence_data.converged = true;
+      return convergence_data;
+    }
+    if(residual_norm > 0.5 * residual_previous || i_refine == refinement_iterations) break;
+    residual_previous = residual_norm;
+
+    FOR(i_row, size) single_b[i_row] = static_cast<float>(residual[i_row]);
+    substitute(lu_factorised_single, single_x, single_b);
+    FOR(i_row, size) x_vector[i_row] += static_cast<Scalar>(single_x[i_row]);
+  }
+
+  // Refinement failed, fall back to a double precision factorisation.
+  single_factorised = false;
+  fallback = true;
+  lu_factorised = a_matrix;
+  factorised = factorise_matrix(lu_factorised);
+  if constexpr(_size == 0) lu_factorised_single.clear();
+  convergence_data.fallback = true;
+  if(!factorised) return convergence_data;
+  substitute(lu_factorised, x_vector, b_vector);
+  update_residual();
   convergence_data.converged = true;
   return convergence_data;
 }
@@ -0,0 +1,240 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ---------------------------------------------------------------------------------------------------------------------
+// File Name: direct_sparse_factorisation.hpp
+// Description: Contains the declaration of the supernodal sparse Cholesky and LU direct solvers.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef DISA_DIRECT_SPARSE_FACTORISATION_H
+#define DISA_DIRECT_SPARSE_FACTORISATION_H
+
+#include "adjacency_graph.hpp"
+#include "matrix_sparse.hpp"
+#include "solver_utilities.hpp"
+#include "vector_dense.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Symbolic Factorisation
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Symbolic_Factorisation
+ * @brief The result of the symbolic analysis of a sparse matrix, depends only on the sparsity pattern of the matrix.
+ *
+ * @details
+ * The columns of the (permuted) factor are grouped into supernodes, contiguous columns which share the same row
+ * structure below the diagonal block. Each supernode stores its factor as a dense row major panel, of the supernode's
+ * rows by its columns, where the first rows form the (dense) diagonal block. The analysis can be reused for any number
+ * of numeric factorisations of matrices with the same sparsity pattern.
+ */
+struct Symbolic_Factorisation {
+  std::size_t signature{std::numeric_limits<std::size_t>::max()};  //!< Pattern signature of the analysed matrix.
+  std::vector<std::size_t> permutation;      //!< The fill reducing ordering, new_index = permutation[old_index].
+  std::vector<std::size_t> parent;           //!< The elimination tree, max() for roots (permuted indexing).
+  std::vector<std::size_t> supernode_of;     //!< The supernode containing each (permuted) column.
+  std::vector<std::size_t> column_offset;    //!< The first column of each supernode, size supernodes + 1.
+  std::vector<std::size_t> row_offset;       //!< Offsets into row for each supernode, size supernodes + 1.
+  std::vector<std::size_t> row;              //!< The sorted row structure of each supernode, diagonal block first.
+  std::vector<std::size_t> value_offset;     //!< Offsets of each supernode's panel in the factor values.
+  std::vector<std::size_t> scatter;          //!< For each matrix non-zero (CSR order), its index in the factor.
+
+  /**
+   * @brief Returns the number of supernodes in the factor.
+   * @return The number of supernodes.
+   */
+  [[nodiscard]] inline std::size_t size_supernode() const noexcept {
+    return !column_offset.empty() ? column_offset.size() - 1 : 0;
+  };
+
+  /**
+   * @brief Returns the number of values stored for (one triangle of) the factor, including the padding of the dense
+   * diagonal blocks.
+   * @return The number of stored values.
+   */
+  [[nodiscard]] inline std::size_t size_value() const noexcept {
+    return !value_offset.empty() ? value_offset.back() : 0;
+  };
+
+  /**
+   * @brief Returns the number of non-zeros in the lower triangular factor, L, including the diagonal.
+   * @return The number of non-zeros in L.
+   */
+  [[nodiscard]] std::size_t size_non_zero() const noexcept;
+};
+
+/**
+ * @brief Constructs the (symmetrised) adjacency graph of the sparsity pattern of a square sparse matrix.
+ * @param[in] a_matrix The sparse matrix.
+ * @return The graph, with an edge for each off-diagonal non-zero a_ij or a_ji.
+ */
+[[nodiscard]] Adjacency_Graph<false> pattern_graph(const Matrix_Sparse& a_matrix);
+
+/**
+ * @brief Performs the symbolic factorisation of a square sparse matrix, under a given ordering.
+ * @param[in] a_matrix The sparse matrix, only the pattern is used, which is symmetrised.
+ * @param[in] permutation The (fill reducing) ordering, new_index = permutation[old_index].
+ * @return The symbolic factorisation.
+ */
+[[nodiscard]] Symbolic_Factorisation symbolic_factorisation(const Matrix_Sparse& a_matrix,
+                                                            const std::vector<std::size_t>& permutation);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Direct Sparse Factorisation
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @class Direct_Sparse_Factorisation
+ * @brief Implements supernodal sparse Cholesky (LL^T) and LU direct solvers for sparse linear systems.
+ * @tparam _solver_type Either cholesky_factorisation_sparse (SPD systems) or lower_upper_factorisation_sparse.
+ *
+ * @details
+ * The solve is split into three phases:
+ * 1. Analysis: a fill reducing ordering is computed and the symbolic factorisation is performed. This is only repeated
+ *    if the sparsity pattern of the matrix changes.
+ * 2. Factorisation: the numeric factorisation, supernode by supernode, using dense kernels on each supernode's panel.
+ * 3. Solve: forward and backward substitution with the factors, any number of times.
+ *
+ * The LU factorisation uses the symmetrised pattern of the matrix and static pivoting, i.e. pivots are taken in the
+ * order given by the fill reducing ordering. It is therefore suited to (structurally) near symmetric systems, which
+ * are diagonally dominant or otherwise safe to factorise without pivoting.
+ */
+template<Solver_Type _solver_type>
+class Direct_Sparse_Factorisation {
+
+ public:
+  /**
+   * @brief Construct a new Direct_Sparse_Factorisation object.
+   */
+  explicit Direct_Sparse_Factorisation() = default;
+
+  /**
+   * @brief Construct a new Direct_Sparse_Factorisation object.
+   * @param[in] config The configuration for the solver to use.
+   */
+  explicit Direct_Sparse_Factorisation(Solver_Config config) { initialise_solver(config); };
+
+  /**
+   * @brief Initialises the solver, copying in the relevant config data.
+   * @param[in] config The configuration for the solver to use.
+   */
+  void initialise(Solver_Config config) { initialise_solver(config); };
+
+  /**
+   * @brief Initialises the solver, copying in the relevant config data.
+   * @param[in] config The configuration for the solver to use.
+   */
+  void initialise_solver(Solver_Config config) {
+    ASSERT(config.type == _solver_type, "Miss-match between config type and the sparse factorisation selection.");
+    factorisation_tolerance = config.factor_tolerance;
+  };
+
+  /**
+   * @brief Computes a fill reducing ordering, approximate minimum degree, and performs the symbolic factorisation.
+   * @param[in] a_matrix The coefficient matrix to analyse.
+   */
+  void analyse(const Matrix_Sparse& a_matrix);
+
+  /**
+   * @brief Performs the symbolic factorisation of the matrix, with a user supplied ordering.
+   * @param[in] a_matrix The coefficient matrix to analyse.
+   * @param[in] permutation The ordering to use, new_index = permutation[old_index].
+   */
+  void analyse(const Matrix_Sparse& a_matrix, const std::vector<std::size_t>& permutation);
+
+  /**
+   * @brief Numerically factorises the coefficient matrix, the analysis is only (re)performed if the pattern changed.
+   * @param[in] a_matrix The coefficient matrix to factorise.
+   * @return True if the matrix was factorised successfully, else false for degenerate/singular (or for Cholesky non
+   * positive definite) matrices.
+   */
+  bool factorise(const Matrix_Sparse& a_matrix);
+
+  /**
+   * @brief Solves the linear system, using the solver's internally stored factors.
+   * @param[out] x_vector The solution vector, will be resized and modified, inital value is irrelevant.
+   * @param[in] b_vector The constant vector, appropriate to the coefficient matrix which was factorised.
+   * @return A Convergence_Data object detailing the solve status.
+   *
+   * @warning The factorise function must have been called before this function, and returned true for a correct solve
+   * to occur.
+   */
+  Convergence_Data solve_system(Vector_Dense<Scalar, 0>& x_vector, const Vector_Dense<Scalar, 0>& b_vector);
+
+  /**
+   * @brief Factorises the coefficient matrix, reusing the analysis where possible, and solves the linear system.
+   * @param[in] a_matrix The coefficient matrix.
+   * @param[out] x_vector The solution vector, will be resized and modified, inital value is irrelevant.
+   * @param[in] b_vector The constant vector.
+   * @return A Convergence_Data object detailing the solve status.
+   */
+  Convergence_Data solve_system(const Matrix_Sparse& a_matrix, Vector_Dense<Scalar, 0>& x_vector,
+                                const Vector_Dense<Scalar, 0>& b_vector);
+
+  /**
+   * @brief Returns the current symbolic factorisation.
+   * @return The symbolic factorisation, empty if no matrix has been analysed.
+   */
+  [[nodiscard]] const Symbolic_Factorisation& symbolic() const { return symbolic_data; };
+
+  /**
+   * @brief Gets the current configuration of the solver.
+   * @return A configuration object, containing the current solver configuration.
+   */
+  Solver_Config get_config() const {
+    Solver_Config config;
+    config.type = _solver_type;
+    config.factor_tolerance = factorisation_tolerance;
+    return config;
+  }
+
+ private:
+  static constexpr bool is_cholesky = _solver_type == Solver_Type::cholesky_factorisation_sparse;
+  static constexpr std::size_t update_grain = 64;  //<! The minimum number of update rows per thread.
+
+  bool factorised{false};  //<! Has factorisation been completed successfully.
+  Scalar factorisation_tolerance{default_absolute};  //<! The value below which pivots should be considered zero.
+  Symbolic_Factorisation symbolic_data;              //<! The symbolic factorisation of the last analysed pattern.
+  std::vector<Scalar> lower;  //<! The supernodal panels of L (for LU, including the packed diagonal blocks of U).
+  std::vector<Scalar> upper;  //<! The supernodal panels of U^T below the diagonal blocks, LU only.
+  std::vector<Scalar> work;   //<! Permuted right hand side/solution work vector.
+
+  /**
+   * @brief Factorises a single supernode, assuming all updates from its descendants have been applied.
+   * @param[in] i_supernode The supernode to factorise.
+   * @return True if successful, else false.
+   */
+  bool factorise_supernode(std::size_t i_supernode);
+
+  /**
+   * @brief Applies the update of a factorised supernode to its ancestors, i.e. the right looking Schur complement.
+   * @param[in] i_supernode The factorised supernode.
+   * @param[in,out] position Work vector, of the matrix size, used to map rows to their position in the target panels.
+   */
+  void update_ancestors(std::size_t i_supernode, std::vector<std::size_t>& position);
+};
+
+using Solver_Cholesky_Sparse = Direct_Sparse_Factorisation<Solver_Type::cholesky_factorisation_sparse>;
+using Solver_LU_Sparse = Direct_Sparse_Factorisation<Solver_Type::lower_upper_factorisation_sparse>;
+
+}  // namespace Disa
+
+#endif  //DISA_DIRECT_SPARSE_FACTORISATION_H
@@ -23,8 +23,10 @@
 #define DISA_SOLVERS_H
 
 #include "direct_lower_upper_factorisation.hpp"
+#include "direct_sparse_factorisation.hpp"
 #include "scalar.hpp"
 #include "solver_fixed_point.hpp"
+#include "solver_krylov.hpp"
 #include "solver_utilities.hpp"
 
 #include <memory>
@@ -47,7 +49,9 @@ class Solver {
   explicit Solver() = default;
 
   std::variant<std::unique_ptr<Solver_LU<0>>, std::unique_ptr<Solver_LUP<0>>, std::unique_ptr<Solver_Jacobi>,
-               std::unique_ptr<Solver_Gauss_Seidel>, std::unique_ptr<Sover_Sor>, std::nullptr_t>
+               std::unique_ptr<Solver_Gauss_Seidel>, std::unique_ptr<Sover_Sor>, std::unique_ptr<Solver_CG>,
+               std::unique_ptr<Solver_Asynchronous>, std::unique_ptr<Solver_Cholesky_Sparse>,
+               std::unique_ptr<Solver_LU_Sparse>, std::nullptr_t>
   solver{nullptr};
 
   Convergence_Data solve(const Matrix_Sparse& a_matrix, Vector_Dense<Scalar, 0>& x_vector,
@@ -56,14 +60,24 @@ class Solver {
     switch(solver.index()) {
       case 0:
         ERROR("LU solver does not support sparse matrices.");
+        exit(1);
       case 1:
         ERROR("LUP solver does not support sparse matrices.");
+        exit(1);
       case 2:
         return std::get<std::unique_ptr<Solver_Jacobi>>(solver)->solve_system(a_matrix, x_vector, b_vector);
       case 3:
         return std::get<std::unique_ptr<Solver_Gauss_Seidel>>(solver)->solve_system(a_matrix, x_vector, b_vector);
       case 4:
         return std::get<std::unique_ptr<Sover_Sor>>(solver)->solve_system(a_matrix, x_vector, b_vector);
+      case 5:
+        return std::get<std::unique_ptr<Solver_CG>>(solver)->solve_system(a_matrix, x_vector, b_vector);
+      case 6:
+        return std::get<std::unique_ptr<Solver_Asynchronous>>(solver)->solve_system(a_matrix, x_vector, b_vector);
+      case 7:
+        return std::get<std::unique_ptr<Solver_Cholesky_Sparse>>(solver)->solve_system(a_matrix, x_vector, b_vector);
+      case 8:
+        return std::get<std::unique_ptr<Solver_LU_Sparse>>(solver)->solve_system(a_matrix, x_vector, b_vector);
       default:
         ERROR("Unknown or uninitialized solver.");
         exit(1);
@@ -79,15 +93,53 @@ class Solver {
         return std::get<std::unique_ptr<Solver_LUP<0>>>(solver)->solve_system(x_vector, b_vector);
       case 2:
         ERROR("Jacobi solver does not support sparse matrices.");
+        exit(1);
       case 3:
         ERROR("Gauss Seidel solver does not support sparse matrices.");
+        exit(1);
       case 4:
         ERROR("SOR solver does not support sparse matrices.");
+        exit(1);
+      case 5:
+        ERROR("CG solver does not support dense matrices.");
+        exit(1);
+      case 6:
+        ERROR("Asynchronous solver does not support dense matrices.");
+        exit(1);
+      case 7:
+        return std::get<std::unique_ptr<Solver_Cholesky_Sparse>>(solver)->solve_system(x_vector, b_vector);
+      case 8:
+        return std::get<std::unique_ptr<Solver_LU_Sparse>>(solver)->solve_system(x_vector, b_vector);
       default:
         ERROR("Unknown or uninitialized solver.");
         exit(1);
     }
   };
+
+  /**
+   * @brief Factorises a sparse coefficient matrix, for the sparse direct solvers, for subsequent (repeated) solves.
+   * @param[in] a_matrix The coefficient matrix to factorise.
+   * @return True if the matrix was factorised successfully, else false.
+   */
+  bool factorise(const Matrix_Sparse& a_matrix) {
+    switch(solver.index()) {
+      case 7:
+        return std::get<std::unique_ptr<Solver_Cholesky_Sparse>>(solver)->factorise(a_matrix);
+      case 8:
+        return std::get<std::unique_ptr<Solver_LU_Sparse>>(solver)->factorise(a_matrix);
+      default:
+        ERROR("Only the sparse direct solvers support separate factorisation.");
+        exit(1);
+    }
+  };
+
+  /**
+   * @brief Discards any subspace a Krylov solver has recycled, e.g. when the next system is unrelated to the last.
+   * @note Recycled subspaces are also discarded automatically when the sparsity pattern of the system changes.
+   */
+  void recycle_clear() {
+    if(solver.index() == 5) std::get<std::unique_ptr<Solver_CG>>(solver)->recycle_clear();
+  };
 };
 
 Solver build_solver(Solver_Config config);
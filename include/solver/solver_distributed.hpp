@@ -0,0 +1,300 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// File Name: solver_krylov.hpp
+// File Name: solver_distributed.hpp
+// Description: Contains the declarations of distributed sparse matrices, and the solvers operating on them.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef DISA_SOLVER_DISTRIBUTED_H
+#define DISA_SOLVER_DISTRIBUTED_H
+
+#include "halo_exchange.hpp"
+#include "matrix_sparse.hpp"
+#include "scalar.hpp"
+#include "solver_utilities.hpp"
+#include "vector_dense.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Distributed Matrix
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Distributed_Matrix
+ * @brief The part of a sparse matrix owned by a single rank, with the plan to exchange the entries it shares.
+ *
+ * @details Each rank owns the rows of a partition of the matrix graph. Its local indices number the owned vertices
+ * first, interior then boundary (see Interior_Boundary_Split), followed by the halo (ghost) vertices owned by other
+ * ranks. The local matrix holds the owned rows with local column indices, so multiplies a local vector, of size
+ * size_local(), once its halo entries are exchanged. Interior rows do not reference the halo, so can be computed while
+ * the exchange is in flight.
+ */
+struct Distributed_Matrix {
+  std::size_t size_global = 0;                   //!< The number of rows of the global matrix.
+  Matrix_Sparse matrix;                          //!< The owned rows, indexed by local row and column.
+  Halo_Exchange_Plan plan;                       //!< The halo exchange plan of this rank.
+  std::vector<std::size_t> i_local_global;       //!< For each local index, its global index.
+  std::pair<std::size_t, std::size_t> interior;  //!< The [begin, end) local rows not referencing the halo.
+  std::pair<std::size_t, std::size_t> boundary;  //!< The [begin, end) local rows referencing the halo.
+
+  /**
+   * @brief Returns the number of owned rows (and entries of a local vector).
+   * @return The number of owned rows.
+   */
+  [[nodiscard]] inline std::size_t size_owned() const noexcept { return matrix.size_row(); }
+
+  /**
+   * @brief Returns the number of owned and halo entries of a local vector.
+   * @return The size of a local vector.
+   */
+  [[nodiscard]] inline std::size_t size_local() const noexcept { return i_local_global.size(); }
+};
+
+/**
+ * @brief Distributes a square sparse matrix over a number of ranks, partitioning its graph by recursive bisection.
+ * @param[in] matrix The global sparse matrix.
+ * @param[in] number_partition The number of ranks.
+ * @return The distributed matrix of each rank, indexed by rank.
+ *
+ * @note All ranks are computed, so each process may construct the list redundantly and keep its own, or the list may be
+ *       constructed once before forking, e.g. via Transport_Socket::run().
+ */
+[[nodiscard]] std::vector<Distributed_Matrix> distribute_matrix(const Matrix_Sparse& matrix,
+                                                                std::size_t number_partition);
+
+/**
+ * @brief Gathers the owned and halo entries of a rank from a global vector.
+ * @param[in] distributed The distributed matrix of the rank.
+ * @param[in] vector The global vector.
+ * @return The local vector.
+ */
+[[nodiscard]] Vector_Dense<Scalar, 0> distribute_vector(const Distributed_Matrix& distributed,
+                                                        const Vector_Dense<Scalar, 0>& vector);
+
+/**
+ * @brief Scatters the owned entries of a rank's local vector to a global vector.
+ * @param[in] distributed The distributed matrix of the rank.
+ * @param[in] vector_local The local vector.
+ * @param[in, out] vector The global vector, only the entries owned by the rank are written.
+ */
+void collect_vector(const Distributed_Matrix& distributed, const Vector_Dense<Scalar, 0>& vector_local,
+                    Vector_Dense<Scalar, 0>& vector);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Distributed Operations
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Computes the owned entries of y = Ax, overlapping the halo exchange of x with the interior rows.
+ * @tparam _transport Type providing the send and receive functions of Transport_Local::Endpoint.
+ * @param[in] distributed The distributed matrix, A, of this rank.
+ * @param[in, out] x_vector The local vector, x, its halo entries are refreshed.
+ * @param[out] y_vector The local vector, y, must be at least size_owned(), only owned entries are written.
+ * @param[in, out] transport This rank's transport.
+ */
+template<class _transport>
+void distributed_multiply(const Distributed_Matrix& distributed, Vector_Dense<Scalar, 0>& x_vector,
+                          Vector_Dense<Scalar, 0>& y_vector, _transport& transport) {
+  halo_exchange_begin(distributed.plan, x_vector, transport);
+  multiply_row_range(distributed.matrix, x_vector, y_vector, distributed.interior);
+  halo_exchange_end(distributed.plan, x_vector, transport);
+  multiply_row_range(distributed.matrix, x_vector, y_vector, distributed.boundary);
+}
+
+/**
+ * @brief Computes the dot product of two distributed vectors.
+ * @tparam _transport Type providing the send, receive, rank and size functions of Transport_Local::Endpoint.
+ * @param[in] distributed The distributed matrix of this rank.
+ * @param[in] vector_0 The first local vector.
+ * @param[in] vector_1 The second local vector.
+ * @param[in, out] transport This rank's transport.
+ * @return The global dot product, identical on every rank.
+ */
+template<class _transport>
+[[nodiscard]] Scalar distributed_dot_product(const Distributed_Matrix& distributed,
+                                             const Vector_Dense<Scalar, 0>& vector_0,
+                                             const Vector_Dense<Scalar, 0>& vector_1, _transport& transport) {
+  Scalar value = 0;
+  FOR(i_row, distributed.size_owned()) value += vector_0[i_row] * vector_1[i_row];
+  return all_reduce_sum(transport, value);
+}
+
+/**
+ * @brief Computes the residual, r = b - Ax, of a distributed system, and its norms.
+ * @tparam _transport Type providing the send, receive, rank and size functions of Transport_Local::Endpoint.
+ * @param[in] distributed The distributed matrix, A, of this rank.
+ * @param[in, out] x_vector The local solution, x, its halo entries are refreshed.
+ * @param[in] b_vector The local constant, b, only owned entries are used.
+ * @param[out] residual The local residual, r, must be at least size_owned(), only owned entries are written.
+ * @param[in, out] transport This rank's transport.
+ * @return The size weighted l2 norm and the l_inf norm of the global residual, as compute_residual().
+ */
+template<class _transport>
+std::pair<Scalar, Scalar> distributed_residual(const Distributed_Matrix& distributed, Vector_Dense<Scalar, 0>& x_vector,
+                                               const Vector_Dense<Scalar, 0>& b_vector,
+                                               Vector_Dense<Scalar, 0>& residual, _transport& transport) {
+  distributed_multiply(distributed, x_vector, residual, transport);
+  Scalar l2_norm = 0;
+  Scalar linf_norm = 0;
+  FOR(i_row, distributed.size_owned()) {
+    residual[i_row] = b_vector[i_row] - residual[i_row];
+    l2_norm += residual[i_row] * residual[i_row];
+    linf_norm = std::max(linf_norm, std::abs(residual[i_row]));
+  }
+  l2_norm = all_reduce_sum(transport, l2_norm);
+  return {std::sqrt(l2_norm / static_cast<Scalar>(distributed.size_global)), all_reduce_max(transport, linf_norm)};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Distributed Solvers
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Records an iteration, with the given residual norms, in the convergence data of a distributed solve.
+ * @param[in, out] data The convergence data, its initial residuals are set on the first call.
+ * @param[in] residual The size weighted l2 norm and the l_inf norm of the residual.
+ * @param[in] is_initial True if the residual is of the initial guess, in which case the iteration is not counted.
+ */
+inline void distributed_convergence_update(Convergence_Data& data, const std::pair<Scalar, Scalar> residual,
+                                           const bool is_initial) {
+  std::tie(data.residual, data.residual_max) = residual;
+  if(is_initial) std::tie(data.residual_0, data.residual_max_0) = residual;
+  data.residual_normalised = data.residual / data.residual_0;
+  data.residual_max_normalised = data.residual_max / data.residual_max_0;
+  if(!is_initial) ++data.iteration;
+  data.duration =
+  std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - data.start_time);
+}
+
+/**
+ * @brief Solves a distributed symmetric positive definite system, Ax = b, by the conjugate gradient method.
+ * @tparam _transport Type providing the send, receive, rank and size functions of Transport_Local::Endpoint.
+ * @param[in] distributed The distributed matrix, A, of this rank.
+ * @param[in, out] x_vector The local initial guess on entry, the local solution, x, on exit, including its halo.
+ * @param[in] b_vector The local constant, b, only owned entries are used.
+ * @param[in] criteria The convergence criteria.
+ * @param[in, out] transport This rank's transport.
+ * @return The convergence data, identical on every rank.
+ *
+ * @details Each iteration performs one distributed multiply, overlapped with its halo exchange, and three global
+ * reductions. Convergence is assessed on the recursively updated residual, normalised to that of the initial guess,
+ * rather than recomputing the true residual as the serial solvers do, which would double the communication.
+ */
+template<class _transport>
+Convergence_Data distributed_conjugate_gradient(const Distributed_Matrix& distributed,
+                                                Vector_Dense<Scalar, 0>& x_vector,
+                                                const Vector_Dense<Scalar, 0>& b_vector,
+                                                const Convergence_Criteria& criteria, _transport& transport) {
+  ASSERT_DEBUG(x_vector.size() == distributed.size_local() && b_vector.size() >= distributed.size_owned(),
+               "Local vector size mismatch.");
+  const std::size_t size_owned = distributed.size_owned();
+  Vector_Dense<Scalar, 0> residual;
+  Vector_Dense<Scalar, 0> image;
+  residual.resize(size_owned);
+  image.resize(size_owned);
+
+  Convergence_Data data;
+  distributed_convergence_update(data, distributed_residual(distributed, x_vector, b_vector, residual, transport),
+                                 true);
+  Vector_Dense<Scalar, 0> direction;
+  direction.resize(distributed.size_local(), 0.0);
+  FOR(i_row, size_owned) direction[i_row] = residual[i_row];
+
+  Scalar residual_dot = distributed_dot_product(distributed, residual, residual, transport);
+  while(!criteria.is_converged(data)) {
+    distributed_multiply(distributed, direction, image, transport);
+    const Scalar curvature = distributed_dot_product(distributed, direction, image, transport);
+    if(!(curvature > 0.0) || residual_dot == 0.0) break;  // Exact solution, or A is not positive definite.
+
+    const Scalar alpha = residual_dot / curvature;
+    Scalar linf_norm = 0;
+    FOR(i_row, size_owned) {
+      x_vector[i_row] += alpha * direction[i_row];
+      residual[i_row] -= alpha * image[i_row];
+      linf_norm = std::max(linf_norm, std::abs(residual[i_row]));
+    }
+    const Scalar residual_dot_new = distributed_dot_product(distributed, residual, residual, transport);
+    distributed_convergence_update(data,
+                                   {std::sqrt(residual_dot_new / static_cast<Scalar>(distributed.size_global)),
+                                    all_reduce_max(transport, linf_norm)},
+                                   false);
+
+    const Scalar beta = residual_dot_new / residual_dot;
+    residual_dot = residual_dot_new;
+    FOR(i_row, size_owned) direction[i_row] = residual[i_row] + beta * direction[i_row];
+  }
+  halo_exchange(distributed.plan, x_vector, transport);
+  data.converged = data.residual_normalised <= criteria.tolerance &&
+                   data.residual_max_normalised <= 10.0 * criteria.tolerance;
+  return data;
+}
+
+/**
+ * @brief Solves a distributed system, Ax = b, by Jacobi iteration.
+ * @tparam _transport Type providing the send, receive, rank and size functions of Transport_Local::Endpoint.
+ * @param[in] distributed The distributed matrix, A, of this rank, with a non-zero diagonal.
+ * @param[in, out] x_vector The local initial guess on entry, the local solution, x, on exit, including its halo.
+ * @param[in] b_vector The local constant, b, only owned entries are used.
+ * @param[in] criteria The convergence criteria.
+ * @param[in, out] transport This rank's transport.
+ * @return The convergence data, identical on every rank.
+ *
+ * @details Written as x += D^-1 (b - Ax), so each iteration performs one distributed multiply, which also gives the
+ * residual of the current iterate, and two global reductions.
+ */
+template<class _transport>
+Convergence_Data distributed_jacobi(const Distributed_Matrix& distributed, Vector_Dense<Scalar, 0>& x_vector,
+                                    const Vector_Dense<Scalar, 0>& b_vector, const Convergence_Criteria& criteria,
+                                    _transport& transport) {
+  ASSERT_DEBUG(x_vector.size() == distributed.size_local() && b_vector.size() >= distributed.size_owned(),
+               "Local vector size mismatch.");
+  const std::size_t size_owned = distributed.size_owned();
+  Vector_Dense<Scalar, 0> diagonal_inverse;
+  Vector_Dense<Scalar, 0> residual;
+  diagonal_inverse.resize(size_owned);
+  residual.resize(size_owned);
+  FOR(i_row, size_owned) {
+    const Scalar diagonal = distributed.matrix.contains(i_row, i_row) ? *distributed.matrix.find(i_row, i_row) : 0.0;
+    ASSERT(diagonal != 0.0, "Zero diagonal in global row " + std::to_string(distributed.i_local_global[i_row]) + ".");
+    diagonal_inverse[i_row] = 1.0 / diagonal;
+  }
+
+  Convergence_Data data;
+  distributed_convergence_update(data, distributed_residual(distributed, x_vector, b_vector, residual, transport),
+                                 true);
+  while(!criteria.is_converged(data)) {
+    FOR(i_row, size_owned) x_vector[i_row] += diagonal_inverse[i_row] * residual[i_row];
+    distributed_convergence_update(data, distributed_residual(distributed, x_vector, b_vector, residual, transport),
+                                   false);
+  }
+  data.converged = data.residual_normalised <= criteria.tolerance &&
+                   data.residual_max_normalised <= 10.0 * criteria.tolerance;
+  return data;
+}
+
+}  // namespace Disa
+
+#endif  //DISA_SOLVER_DISTRIBUTED_H
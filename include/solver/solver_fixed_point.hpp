@@ -26,16 +26,43 @@
 
 namespace Disa {
 
-struct Solver_Fixed_Point_Data : public Solver_Data {};
+/**
+ * @struct Level_Schedule
+ * @brief Partitions the rows of a sparse matrix into levels (wavefronts) for a parallel Gauss-Seidel sweep.
+ *
+ * @details Rows within a level have no mutual dependencies in a forward sweep, so may be updated concurrently, while
+ * the levels themselves are processed in order. The schedule depends only on the sparsity pattern of the matrix.
+ */
+struct Level_Schedule {
+  std::size_t signature{std::numeric_limits<std::size_t>::max()};  //!< Pattern signature the schedule was built for.
+  std::vector<std::size_t> level_offset;  //!< Offset of the first row of each level in row, size is levels + 1.
+  std::vector<std::size_t> row;           //!< The rows of the matrix, ordered by level (and ascending within a level).
+};
+
+struct Solver_Fixed_Point_Data : public Solver_Data {
+  bool wavefront{false};    //!< If true, forward sweeps are performed level by level in parallel.
+  Level_Schedule schedule;  //!< The level schedule for wavefront sweeps.
+};
 
 struct Solver_Fixed_Point_Jacobi_Data : public Solver_Data {
   Vector_Dense<Scalar, 0> working;
 };
 
-struct Solver_Fixed_Point_Sor_Data : public Solver_Data {
+struct Solver_Fixed_Point_Sor_Data : public Solver_Fixed_Point_Data {
   Scalar relaxation{1.5};
 };
 
+struct Solver_Fixed_Point_Asynchronous_Data : public Solver_Data {
+  std::size_t block_size{256};  //!< The minimum number of rows owned by each thread.
+};
+
+/**
+ * @brief Constructs the level schedule of the forward sweep of a sparse matrix.
+ * @param[in] a_matrix The sparse matrix, only the pattern is used.
+ * @return The level schedule.
+ */
+Level_Schedule level_schedule(const Matrix_Sparse& a_matrix);
+
 /**
  * @class
  * @brief
@@ -64,6 +91,8 @@ class Solver_Fixed_Point : public Solver_Iterative<Solver_Fixed_Point<_solver_ty
 typedef Solver_Fixed_Point<Solver_Type::jacobi, Solver_Fixed_Point_Jacobi_Data> Solver_Jacobi;
 typedef Solver_Fixed_Point<Solver_Type::gauss_seidel, Solver_Fixed_Point_Data> Solver_Gauss_Seidel;
 typedef Solver_Fixed_Point<Solver_Type::successive_over_relaxation, Solver_Fixed_Point_Sor_Data> Sover_Sor;
+typedef Solver_Fixed_Point<Solver_Type::asynchronous_relaxation, Solver_Fixed_Point_Asynchronous_Data>
+Solver_Asynchronous;
 
 }  // namespace Disa
 
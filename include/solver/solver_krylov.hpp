@@ -0,0 +1,97 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// File Name: solver_krylov.hpp
+// Description: Contains the declarations of the Krylov subspace iterative solvers.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef DISA_SOLVER_KRYLOV_H
+#define DISA_SOLVER_KRYLOV_H
+
+#include "solver_iterative.hpp"
+
+#include <vector>
+
+namespace Disa {
+
+/**
+ * @struct Solver_Krylov_Data
+ * @brief Data for the Krylov solvers, including the subspace recycled between successive solves.
+ */
+struct Solver_Krylov_Data : public Solver_Data {
+  std::size_t recycle_size{0};  //!< Maximum number of deflation vectors retained between solves.
+  std::size_t signature{std::numeric_limits<std::size_t>::max()};  //!< Pattern signature the recycled space is for.
+  std::vector<Vector_Dense<Scalar, 0>> recycle;           //!< The recycled (deflation) basis, W.
+  std::vector<Vector_Dense<Scalar, 0>> direction;         //!< Search directions retained from the last solve, P.
+  std::vector<Vector_Dense<Scalar, 0>> direction_image;   //!< The image of the retained search directions, AP.
+};
+
+/**
+ * @class Solver_Krylov
+ * @brief Krylov subspace solvers for sparse linear systems, with optional subspace recycling between solves.
+ * @tparam _solver_type The Krylov method, e.g. conjugate gradient.
+ * @tparam _solver_data The solver data type.
+ *
+ * @details
+ * For sequences of slowly varying systems (time stepping, non-linear iterations) the solver can retain a small basis,
+ * W, of approximate eigenvectors belonging to the smallest eigenvalues of the previous system. Each subsequent solve is
+ * then deflated by W, which removes the corresponding part of the spectrum and reduces the iteration count. The basis
+ * is refreshed after each solve via a Rayleigh-Ritz procedure over W and the retained search directions, and is
+ * discarded automatically if the sparsity pattern of the system changes.
+ */
+template<Solver_Type _solver_type, class _solver_data>
+class Solver_Krylov : public Solver_Iterative<Solver_Krylov<_solver_type, _solver_data>, _solver_data> {
+
+ public:
+  explicit Solver_Krylov(Solver_Config config)
+      : Solver_Iterative<Solver_Krylov<_solver_type, _solver_data>, _solver_data>(config){};
+
+  /**
+   * @brief Initialises the solver from the parsed configuration.
+   * @param[in] config The solver configuration, the recycle_size is used to size the recycled subspace.
+   */
+  void initialise_solver(Solver_Config config);
+
+  /**
+   * @brief Solves the linear system Ax = b, deflated by any subspace recycled from the previous solve.
+   * @param[in] a_matrix The coefficient matrix, A, must be symmetric positive definite.
+   * @param[in,out] x_vector The initial guess on entry, the solution, x, on exit.
+   * @param[in] b_vector The constant vector, b.
+   * @return The convergence data of the solve.
+   */
+  Convergence_Data solve_system(const Matrix_Sparse& a_matrix, Vector_Dense<Scalar, 0>& x_vector,
+                                const Vector_Dense<Scalar, 0>& b_vector);
+
+  /**
+   * @brief Discards the recycled subspace, the next solve will start from a plain Krylov subspace.
+   */
+  void recycle_clear() {
+    this->data.recycle.clear();
+    this->data.signature = std::numeric_limits<std::size_t>::max();
+  };
+
+  /**
+   * @brief Returns the number of vectors currently held in the recycled subspace.
+   * @return The current size of the recycled subspace.
+   */
+  [[nodiscard]] std::size_t size_recycle() const { return this->data.recycle.size(); };
+};
+
+typedef Solver_Krylov<Solver_Type::conjugate_gradient, Solver_Krylov_Data> Solver_CG;
+
+}  // namespace Disa
+
+#endif  //DISA_SOLVER_KRYLOV_H
@@ -40,11 +40,15 @@ namespace Disa {
  * @brief Enumerated list of all linear solvers in Disa.
  */
 enum class Solver_Type {
-  lower_upper_factorisation,   //!< The Lower Upper Factorisation solver (Dense Systems).
-  jacobi,                      //!< The Jacobi fixed point iterative solver (Sparse Systems).
-  gauss_seidel,                //!< The Gauss Seidel fixed point iterative solver (Sparse Systems).
-  successive_over_relaxation,  //!< The Successive Over Relaxation fixed point iterative solver (Sparse Systems).
-  unknown                      //!< Uninitialised/Unknown solver.
+  lower_upper_factorisation,         //!< The Lower Upper Factorisation solver (Dense Systems).
+  jacobi,                            //!< The Jacobi fixed point iterative solver (Sparse Systems).
+  gauss_seidel,                      //!< The Gauss Seidel fixed point iterative solver (Sparse Systems).
+  successive_over_relaxation,        //!< The Successive Over Relaxation fixed point iterative solver (Sparse Systems).
+  conjugate_gradient,                //!< The (deflated) Conjugate Gradient Krylov solver (Sparse SPD Systems).
+  asynchronous_relaxation,           //!< The asynchronous (chaotic) relaxation iterative solver (Sparse Systems).
+  cholesky_factorisation_sparse,     //!< The supernodal Cholesky factorisation solver (Sparse SPD Systems).
+  lower_upper_factorisation_sparse,  //!< The supernodal Lower Upper Factorisation solver (Sparse Systems).
+  unknown                            //!< Uninitialised/Unknown solver.
 };
 
 /**
@@ -62,6 +66,8 @@ struct Solver_Config {
 
   bool pivot{true};                           //!< For direct solvers, if pivoting of the system is allowed.
   Scalar factor_tolerance{default_relative};  //!< The value below which diagonal entires shoud be considered zero.
+  bool mixed_precision{false};  //!< For LU solvers, factorise in single precision and refine the solution in double.
+  std::size_t refinement_iterations{10};  //!< For mixed precision, the refinement limit before falling back to double.
 
   // -------------------------------------------------------------------------------------------------------------------
   // Iterative Solver Options
@@ -74,6 +80,11 @@ struct Solver_Config {
 
   // Iterative
   Scalar SOR_relaxation{1.5};  //!< The relaxation factor for a  Successive Over Relaxation solver.
+
+  bool wavefront{false};  //!< For Gauss-Seidel type solvers, sweep independent rows in parallel, level by level.
+
+  // Krylov
+  std::size_t recycle_size{0};  //!< The number of deflation vectors a Krylov solver recycles between solves.
 };
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -97,6 +108,7 @@ struct Solver_Config {
 struct Convergence_Data {
 
   bool converged{false};  //!< Is the system converged.
+  bool fallback{false};   //!< Did the solver have to fall back to a more robust (and costly) method to converge.
 
   std::chrono::microseconds duration{0};  //!< The duration of the solve.
   std::chrono::steady_clock::time_point start_time{
@@ -181,6 +193,23 @@ struct Convergence_Criteria {
 template<class _matrix, class _vector>
 std::pair<Scalar, Scalar> compute_residual(const _matrix& coef, const _vector& solution, const _vector& constant);
 
+/**
+ * @brief Computes a signature of the sparsity pattern of a sparse matrix, values are not considered.
+ * @param[in] coef The sparse matrix.
+ * @return Signature of the pattern, used by solvers to detect pattern changes between successive solves.
+ */
+inline std::size_t pattern_signature(const Matrix_Sparse& coef) {
+  std::size_t signature = coef.size_row() ^ (coef.size_column() << 32);
+  const auto combine = [&signature](const std::size_t value) {
+    signature ^= value + 0x9e3779b97f4a7c15 + (signature << 6) + (signature >> 2);
+  };
+  FOR(i_row, coef.size_row()) {
+    FOR_ITER(column_iter, coef[i_row]) combine(column_iter.i_column());
+    combine(std::numeric_limits<std::size_t>::max());  // row separator
+  }
+  return signature;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Template Definitions
 // ---------------------------------------------------------------------------------------------------------------------
@@ -190,14 +219,15 @@ std::pair<Scalar, Scalar> compute_residual(const _matrix& coef, const _vector& s
 /**
  * @details Updates the convergence data for the parsed linear system. First the weighted l-norms are computed for the
  * linear system. These residual norms are further modified to normalised to their values computed on the first
- * iteration. The iteration counter is also incremented and the duration of the solver is updated.
+ * iteration, unless the solver has already set the initial residuals (e.g. to those of the initial guess). The
+ * iteration counter is also incremented and the duration of the solver is updated.
  */
 template<class _matrix, class _vector>
 void Convergence_Data::update(const _matrix& coef, const _vector& solution, const _vector& constant) {
 
   std::tie(residual, residual_max) = compute_residual(coef, solution, constant);
 
-  if(!iteration) {
+  if(!iteration && residual_0 == scalar_max) {
     residual_0 = residual;
     residual_max_0 = residual_max;
   }
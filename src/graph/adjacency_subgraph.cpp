@@ -21,9 +21,12 @@
 
 #include "adjacency_subgraph.hpp"
 #include "graph_utilities.hpp"
+#include "parallel.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
-#include <queue>
+#include <unordered_map>
 
 namespace Disa {
 
@@ -33,17 +36,21 @@ namespace Disa {
 
 /**
  * @details Constructs a new subgraph using the given vertex partitioning of the parent graph. The resulting subgraph
- * will form the primary partition with these vertices. This presently is achieved by copying the parent graph to the
- * internal graph representation, and forming the global-local mappings and deleting vertices not in the subgraph.
- * Finally, should extra levels be requested they are added to the subgraph.
+ * will form the primary partition with these vertices. The local graph is built directly from the parent adjacency of
+ * the partition's vertices, see construct, for which a global to local mapping is needed. If the vertices are sorted it
+ * is a binary search of the vertices themselves, otherwise of a sorted copy, so that no parent sized storage is needed
+ * and the cost is O(local edges log(local vertices)). Finally, should extra levels be requested they are added to the
+ * subgraph.
  */
 Adjacency_Subgraph::Adjacency_Subgraph(const Adjacency_Graph<false>& parent_graph,
                                        const std::vector<std::size_t>& i_partition_local_global,
                                        const std::size_t extra_levels) {
+  const bool is_sorted = std::is_sorted(i_partition_local_global.begin(), i_partition_local_global.end());
 #ifdef DISA_DEBUG
-  std::vector<std::size_t> unique_check;
-  std::unique_copy(i_partition_local_global.begin(), i_partition_local_global.end(), std::back_inserter(unique_check));
-  ASSERT(unique_check.size() == i_partition_local_global.size(), "Partition vertices are not unique.");
+  std::vector<std::size_t> unique_check(i_partition_local_global);
+  if(!is_sorted) std::sort(unique_check.begin(), unique_check.end());
+  ASSERT(std::adjacent_find(unique_check.begin(), unique_check.end()) == unique_check.end(),
+         "Partition vertices are not unique.");
   ASSERT(i_partition_local_global.size() <= parent_graph.size_vertex(),
          "Partition size is bigger than graph vertex size.");
   ASSERT(
@@ -52,28 +59,30 @@ Adjacency_Subgraph::Adjacency_Subgraph(const Adjacency_Graph<false>& parent_grap
   "A global vertex is not in the parsed parent graph range [0, " + std::to_string(parent_graph.size_vertex()) + ").");
 #endif
 
-  hash_parent = std::hash<Adjacency_Graph<false>>{}(parent_graph);
-  graph = parent_graph;
-  reserve(i_partition_local_global.size());
-
-  // Copy the contents of the graph into the sub-graph and set up axillary containers.
-  std::size_t i_local_vertex = 0;
-  std::vector<std::size_t> i_global_local(parent_graph.size_vertex(), std::numeric_limits<std::size_t>::max());
-  FOR_EACH(i_global_vertex, i_partition_local_global) {
-    i_local_global.push_back(i_global_vertex);
-    i_global_local[i_global_vertex] = i_local_vertex;
-    ++i_local_vertex;
+  if(is_sorted) {
+    construct(parent_graph, i_partition_local_global, [&](const std::size_t i_global) {
+      const auto iter = std::lower_bound(i_partition_local_global.begin(), i_partition_local_global.end(), i_global);
+      if(iter == i_partition_local_global.end() || *iter != i_global) return std::numeric_limits<std::size_t>::max();
+      return static_cast<std::size_t>(std::distance(i_partition_local_global.begin(), iter));
+    });
+  } else {
+    std::vector<std::size_t> local_order(i_partition_local_global.size());
+    std::iota(local_order.begin(), local_order.end(), 0);
+    std::sort(local_order.begin(), local_order.end(), [&](const std::size_t i_local, const std::size_t j_local) {
+      return i_partition_local_global[i_local] < i_partition_local_global[j_local];
+    });
+    construct(parent_graph, i_partition_local_global, [&](const std::size_t i_global) {
+      const auto iter = std::lower_bound(
+      local_order.begin(), local_order.end(), i_global,
+      [&](const std::size_t i_local, const std::size_t value) { return i_partition_local_global[i_local] < value; });
+      if(iter == local_order.end() || i_partition_local_global[*iter] != i_global)
+        return std::numeric_limits<std::size_t>::max();
+      return *iter;
+    });
   }
 
-  // Remove vertices not in this subgraph.
-  auto not_in_subgraph = [&](const std::size_t& vertex) {
-    return i_global_local[vertex] == std::numeric_limits<std::size_t>::max();
-  };
-  graph.erase_if(not_in_subgraph);
-
   // Add back additional levels as needed.
-  if(extra_levels != 0)
-    update_levels(parent_graph, extra_levels, std::make_shared<std::vector<std::size_t>>(i_global_local));
+  if(extra_levels != 0) update_levels(parent_graph, extra_levels);
 };
 
 //--------------------------------------------------------------------------------------------------------------------
@@ -83,7 +92,8 @@ Adjacency_Subgraph::Adjacency_Subgraph(const Adjacency_Graph<false>& parent_grap
 /**
  * @details Creates a new subgraph instance that is a reordered version of the current instance. The new subgraph
  * contains the same vertices and edges as the original, but with their local indexes permuted based on the given
- * permutation vector. Finally the new instance and this instance are swapped, with the now old instance returned.
+ * permutation vector, both the graph and the maps being permuted in parallel. Finally the new instance and this instance
+ * are swapped, with the now old instance returned.
  */
 Adjacency_Subgraph Adjacency_Subgraph::reorder(const std::vector<std::size_t>& permutation) {
   Adjacency_Subgraph new_graph;
@@ -91,10 +101,10 @@ Adjacency_Subgraph Adjacency_Subgraph::reorder(const std::vector<std::size_t>& p
   new_graph.i_local_global.resize(permutation.size());
   new_graph.level_set_value.resize(level_set_value.empty() ? 0 : permutation.size());
 
-  FOR(i_old, size_vertex()) {
+  parallel_for(size_vertex(), [&](const std::size_t i_old) {
     new_graph.i_local_global[permutation[i_old]] = i_local_global[i_old];
     if(!level_set_value.empty()) new_graph.level_set_value[permutation[i_old]] = level_set_value[i_old];
-  }
+  });
 
   new_graph.i_local_global.swap(i_local_global);
   new_graph.level_set_value.swap(level_set_value);
@@ -127,54 +137,77 @@ void Adjacency_Subgraph::update_levels(const Adjacency_Graph<false>& parent_grap
 // ---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @details Adds new levels to the subgraph based on the given max_level. To add additional levels a level traversal of
- * the parent graph is performed. The current subgraph vertices are 'loaded' into a vector of visited vertices and a
- * queue formed from the current maximum level vertex set. This data is then used to start the level traversal upto the
- * maximum requested level. The added vertices are then added into the subgraph, with the local-to-global mappings and
- * level stored.
+ * @details Adds new levels to the subgraph based on the given max_level. A hashed global to local map of the current
+ * subgraph vertices marks them as visited, and a breadth first search is advanced, one level at a time, from the
+ * current maximum level vertices, so only the frontier and its parent adjacency are visited. The added vertices are
+ * then numbered in ascending global order after the existing vertices. Finally the local graph is rebuilt once, from
+ * the existing adjacency plus the mapped parent adjacency of the added vertices. The cost is thus proportional to the
+ * size of the subgraph and its new halo, not the parent, unless a parent sized global to local map is requested.
  */
 void Adjacency_Subgraph::add_levels(const Adjacency_Graph<false>& parent_graph, const std::size_t max_level,
                                     const std::size_t current_max,
                                     std::shared_ptr<std::vector<std::size_t>> i_global_local) {
 
-  // Check the global-local vector
-  if(i_global_local == nullptr)
-    i_global_local =
-    std::make_shared<std::vector<std::size_t>>(parent_graph.size_vertex(), std::numeric_limits<std::size_t>::max());
-  if(i_global_local->size() != parent_graph.size_vertex()) i_global_local->resize(parent_graph.size_vertex());
-  std::fill(i_global_local->begin(), i_global_local->end(), std::numeric_limits<std::size_t>::max());
-
-  // Create data for level traversal.
-  std::queue<std::size_t> start_vertices;
-  std::vector<std::size_t> levels(parent_graph.size_vertex(), std::numeric_limits<std::size_t>::max());
-  FOR(i_vertex, size_vertex()) {
-    if(level_set_value[i_vertex] == current_max) start_vertices.push(i_local_global[i_vertex]);
-    levels[i_local_global[i_vertex]] = level_set_value[i_vertex];
-    (*i_global_local)[i_local_global[i_vertex]] = i_vertex;
+  // Map the current vertices, and form the starting frontier.
+  const std::size_t size_current = size_vertex();
+  std::unordered_map<std::size_t, std::size_t> global_local;
+  global_local.reserve(2 * size_current);
+  std::vector<std::size_t> frontier;
+  FOR(i_vertex, size_current) {
+    global_local.emplace(i_local_global[i_vertex], i_vertex);
+    if(level_set_value[i_vertex] == current_max) frontier.push_back(i_local_global[i_vertex]);
   }
 
-  // Perform level traversal to add new vertices.
-  level_traversal(parent_graph, start_vertices, levels, max_level);
+  // Advance the frontier, level by level.
+  std::vector<std::pair<std::size_t, std::size_t>> global_level;
+  std::vector<std::size_t> next;
+  for(std::size_t level = current_max + 1; level <= max_level && !frontier.empty(); ++level) {
+    next.clear();
+    FOR_EACH(i_global, frontier) {
+      FOR_EACH(i_global_adjacent, parent_graph[i_global]) {
+        if(!global_local.emplace(i_global_adjacent, std::numeric_limits<std::size_t>::max()).second) continue;
+        next.push_back(i_global_adjacent);
+        global_level.emplace_back(i_global_adjacent, level);
+      }
+    }
+    frontier.swap(next);
+  }
 
-  // Add new vertices to local-global mapping.
-  FOR(i_vertex, levels.size())
-  if(current_max < levels[i_vertex] && levels[i_vertex] <= max_level) {
-    (*i_global_local)[i_vertex] = i_local_global.size();
-    i_local_global.push_back(i_vertex);
-    level_set_value.push_back(levels[i_vertex]);
+  // Number the new vertices in ascending global order.
+  std::sort(global_level.begin(), global_level.end());
+  i_local_global.reserve(size_current + global_level.size());
+  level_set_value.reserve(size_current + global_level.size());
+  FOR_EACH(vertex_level, global_level) {
+    global_local[vertex_level.first] = i_local_global.size();
+    i_local_global.push_back(vertex_level.first);
+    level_set_value.push_back(vertex_level.second);
   }
 
-  // Insert edge connectivity between newly added vertices.
-  FOR(i_global, levels.size()) {
-    if(current_max < levels[i_global] && levels[i_global] <= max_level) {
-      const std::size_t& i_local = (*i_global_local)[i_global];
-      FOR_EACH(i_global_adjacency, parent_graph[i_global]) {
-        const std::size_t& i_local_adjacency = (*i_global_local)[i_global_adjacency];
-        if(i_local_adjacency != std::numeric_limits<std::size_t>::max()) {
-          graph.insert({i_local, i_local_adjacency});
-        }
+  // Rebuild the graph, once, from the current and the new vertices' mapped adjacency.
+  if(!global_level.empty()) {
+    std::vector<std::size_t> offset(1, 0);
+    std::vector<std::size_t> adjacency;
+    offset.reserve(i_local_global.size() + 1);
+    adjacency.reserve(2 * graph.size_edge());
+    FOR(i_vertex, size_current) {
+      adjacency.insert(adjacency.end(), graph[i_vertex].begin(), graph[i_vertex].end());
+      offset.push_back(adjacency.size());
+    }
+    FOR(i_vertex, size_current, i_local_global.size()) {
+      FOR_EACH(i_global_adjacent, parent_graph[i_local_global[i_vertex]]) {
+        const auto iter = global_local.find(i_global_adjacent);
+        if(iter != global_local.end()) adjacency.push_back(iter->second);
       }
+      offset.push_back(adjacency.size());
     }
+    graph = Adjacency_Graph<false>(offset, adjacency);
+  }
+
+  // If we were parsed a global to local pointer, populate with new data.
+  if(i_global_local != nullptr) {
+    i_global_local->resize(parent_graph.size_vertex());
+    std::fill(i_global_local->begin(), i_global_local->end(), std::numeric_limits<std::size_t>::max());
+    FOR(i_local, size_vertex())(*i_global_local)[local_global(i_local)] = i_local;
   }
 }
 
@@ -208,6 +241,99 @@ void Adjacency_Subgraph::remove_levels(const Adjacency_Graph<false>& parent_grap
   }
 }
 
+/**
+ * @details Walks the parent adjacency of each local vertex, mapping each neighbour to its local index and keeping only
+ * those in the subgraph. Only the neighbours above the vertex are kept, as the graph's compressed constructor inserts
+ * both directions of each edge, so no duplicates need to be removed. The cost is O(local edges) mapping calls.
+ */
+template<class _global_local>
+void Adjacency_Subgraph::construct(const Adjacency_Graph<false>& parent_graph,
+                                   std::span<const std::size_t> i_partition_local_global,
+                                   const _global_local& global_local) {
+  hash_parent = std::hash<Adjacency_Graph<false>>{}(parent_graph);
+  i_local_global.assign(i_partition_local_global.begin(), i_partition_local_global.end());
+  level_set_value.clear();
+
+  std::vector<std::size_t> offset(1, 0);
+  std::vector<std::size_t> adjacency;
+  offset.reserve(i_local_global.size() + 1);
+  FOR(i_local, i_local_global.size()) {
+    FOR_EACH(i_global_adjacent, parent_graph[i_local_global[i_local]]) {
+      const std::size_t i_local_adjacent = global_local(i_global_adjacent);
+      if(i_local_adjacent != std::numeric_limits<std::size_t>::max() && i_local_adjacent > i_local)
+        adjacency.push_back(i_local_adjacent);
+    }
+    offset.push_back(adjacency.size());
+  }
+  graph = Adjacency_Graph<false>(offset, adjacency);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Batch Construction
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details The vertices are bucketed by subgraph with a counting sort, which leaves each subgraph's vertices in
+ * ascending global order and gives each vertex its local index in its subgraph. This single global to local mapping is
+ * shared by all subgraphs, each of which is then built in parallel in O(local edges), see construct. The parent graph
+ * is therefore neither copied nor scanned once per subgraph.
+ */
+std::vector<Adjacency_Subgraph> create_subgraph_list(const Adjacency_Graph<false>& parent_graph,
+                                                     const std::vector<std::size_t>& vertex_subgraph,
+                                                     std::size_t number_subgraph, const std::size_t extra_levels) {
+  ASSERT(vertex_subgraph.size() == parent_graph.size_vertex(),
+         "Vertex subgraph size " + std::to_string(vertex_subgraph.size()) + " does not match the graph size " +
+         std::to_string(parent_graph.size_vertex()) + ".");
+  if(number_subgraph == 0 && !vertex_subgraph.empty())
+    number_subgraph = *std::max_element(vertex_subgraph.begin(), vertex_subgraph.end()) + 1;
+  ASSERT(std::all_of(vertex_subgraph.begin(), vertex_subgraph.end(),
+                     [&](const std::size_t i_subgraph) { return i_subgraph < number_subgraph; }),
+         "A vertex subgraph is not in the range [0, " + std::to_string(number_subgraph) + ").");
+
+  // Bucket the vertices, forming the local to global and global to local maps.
+  std::vector<std::size_t> subgraph_offset(number_subgraph + 1, 0);
+  FOR_EACH(i_subgraph, vertex_subgraph) ++subgraph_offset[i_subgraph + 1];
+  std::partial_sum(subgraph_offset.begin(), subgraph_offset.end(), subgraph_offset.begin());
+  std::vector<std::size_t> subgraph_vertex(vertex_subgraph.size());
+  std::vector<std::size_t> i_global_local(vertex_subgraph.size());
+  std::vector<std::size_t> position(subgraph_offset.begin(), subgraph_offset.end() - 1);
+  FOR(i_vertex, vertex_subgraph.size()) {
+    const std::size_t i_subgraph = vertex_subgraph[i_vertex];
+    i_global_local[i_vertex] = position[i_subgraph] - subgraph_offset[i_subgraph];
+    subgraph_vertex[position[i_subgraph]++] = i_vertex;
+  }
+
+  // Hash the parent once, rather than in each subgraph.
+  static_cast<void>(parent_graph.hash());
+
+  std::vector<Adjacency_Subgraph> subgraph(number_subgraph);
+  parallel_for(
+  number_subgraph,
+  [&](const std::size_t i_subgraph) {
+    const std::span<const std::size_t> vertex(subgraph_vertex.data() + subgraph_offset[i_subgraph],
+                                              subgraph_offset[i_subgraph + 1] - subgraph_offset[i_subgraph]);
+    subgraph[i_subgraph].construct(parent_graph, vertex, [&](const std::size_t i_global) {
+      if(vertex_subgraph[i_global] != i_subgraph) return std::numeric_limits<std::size_t>::max();
+      return i_global_local[i_global];
+    });
+    if(extra_levels != 0) subgraph[i_subgraph].update_levels(parent_graph, extra_levels);
+  },
+  1);
+  return subgraph;
+}
+
+/**
+ * @details Each subgraph's halo growth only reads the parent, and no longer needs parent sized storage, so the
+ * subgraphs are updated in parallel, one per task. The parent is hashed once up front, rather than in each subgraph.
+ */
+void update_levels(const Adjacency_Graph<false>& parent_graph, std::vector<Adjacency_Subgraph>& subgraph_list,
+                   const std::size_t max_level) {
+  static_cast<void>(parent_graph.hash());
+  parallel_for(
+  subgraph_list.size(),
+  [&](const std::size_t i_subgraph) { subgraph_list[i_subgraph].update_levels(parent_graph, max_level); }, 1);
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Operator Overloading
 // ---------------------------------------------------------------------------------------------------------------------
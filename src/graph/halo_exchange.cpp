@@ -0,0 +1,424 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ---------------------------------------------------------------------------------------------------------------------
+// File Name: halo_exchange.cpp
+// Description: Contains the definitions for halo exchange plans between subgraphs, and their execution.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#include "halo_exchange.hpp"
+#include "adjacency_graph.hpp"
+#include "adjacency_subgraph.hpp"
+#include "parallel.hpp"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Halo Exchange Plan
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details The owner, and owner local index, of each parent vertex is first recorded from the primary vertices. Then,
+ * in parallel, each subgraph's halo vertices are sorted by owner and global index, giving its receive lists. Finally
+ * the receive lists are transposed, in subgraph order, into the owners' send lists, which therefore have their
+ * neighbours in ascending order and the same entry order as the matching receive lists.
+ */
+std::vector<Halo_Exchange_Plan> create_halo_exchange_plan(const Adjacency_Graph<false>& parent_graph,
+                                                          const std::vector<Adjacency_Subgraph>& subgraph_list) {
+
+  // Record the owner of each vertex.
+  const std::size_t unowned = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> owner_subgraph(parent_graph.size_vertex(), unowned);
+  std::vector<std::size_t> owner_local(parent_graph.size_vertex(), unowned);
+  FOR(i_subgraph, subgraph_list.size()) {
+    const Adjacency_Subgraph& subgraph = subgraph_list[i_subgraph];
+    ASSERT(subgraph.is_parent(parent_graph),
+           "Subgraph " + std::to_string(i_subgraph) + " is not a subgraph of the graph.");
+    FOR(i_local, subgraph.size_vertex()) {
+      if(subgraph.vertex_level(i_local) != 0) continue;
+      const std::size_t i_global = subgraph.local_global(i_local);
+      ASSERT(owner_subgraph[i_global] == unowned,
+             "Vertex " + std::to_string(i_global) + " is in more than one subgraph.");
+      owner_subgraph[i_global] = i_subgraph;
+      owner_local[i_global] = i_local;
+    }
+  }
+
+  // Sort each subgraph's halo by owner then global index, forming the receive lists.
+  std::vector<Halo_Exchange_Plan> plan_list(subgraph_list.size());
+  std::vector<std::vector<std::tuple<std::size_t, std::size_t, std::size_t>>> halo_list(subgraph_list.size());
+  parallel_for(
+  subgraph_list.size(),
+  [&](const std::size_t i_subgraph) {
+    const Adjacency_Subgraph& subgraph = subgraph_list[i_subgraph];
+    auto& halo = halo_list[i_subgraph];
+    FOR(i_local, subgraph.size_vertex()) {
+      if(subgraph.vertex_level(i_local) == 0) continue;
+      const std::size_t i_global = subgraph.local_global(i_local);
+      ASSERT(owner_subgraph[i_global] != unowned,
+             "Halo vertex " + std::to_string(i_global) + " is not a primary vertex of any subgraph.");
+      halo.emplace_back(owner_subgraph[i_global], i_global, i_local);
+    }
+    std::sort(halo.begin(), halo.end());
+
+    Halo_Exchange_Plan& plan = plan_list[i_subgraph];
+    plan.i_subgraph = i_subgraph;
+    plan.receive_index.reserve(halo.size());
+    FOR(i_halo, halo.size()) {
+      const auto& [i_owner, i_global, i_local] = halo[i_halo];
+      if(i_halo == 0 || i_owner != std::get<0>(halo[i_halo - 1])) {
+        if(i_halo != 0) plan.receive_offset.push_back(i_halo);
+        plan.receive_neighbour.push_back(i_owner);
+      }
+      plan.receive_index.push_back(i_local);
+    }
+    if(!halo.empty()) plan.receive_offset.push_back(halo.size());
+  },
+  1);
+
+  // Transpose into the send lists.
+  FOR(i_subgraph, subgraph_list.size()) {
+    FOR_EACH(halo, halo_list[i_subgraph]) {
+      Halo_Exchange_Plan& plan_owner = plan_list[std::get<0>(halo)];
+      if(plan_owner.send_neighbour.empty() || plan_owner.send_neighbour.back() != i_subgraph) {
+        if(!plan_owner.send_neighbour.empty()) plan_owner.send_offset.push_back(plan_owner.send_index.size());
+        plan_owner.send_neighbour.push_back(i_subgraph);
+      }
+      plan_owner.send_index.push_back(owner_local[std::get<1>(halo)]);
+    }
+  }
+  FOR_EACH_REF(plan, plan_list) if(!plan.send_neighbour.empty()) plan.send_offset.push_back(plan.send_index.size());
+  return plan_list;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Shared Memory Execution
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details Each subgraph, in parallel, copies its halo entries from each owner's vector using the owner's matching send
+ * list. Only halo entries are written and only owned entries are read, so there are no races between subgraphs.
+ */
+void halo_exchange(const std::vector<Halo_Exchange_Plan>& plan_list,
+                   std::vector<Vector_Dense<Scalar, 0>>& vector_list) {
+  ASSERT(plan_list.size() == vector_list.size(), "Number of plans " + std::to_string(plan_list.size()) +
+                                                 " does not match the number of vectors " +
+                                                 std::to_string(vector_list.size()) + ".");
+  parallel_for(
+  plan_list.size(),
+  [&](const std::size_t i_subgraph) {
+    const Halo_Exchange_Plan& plan = plan_list[i_subgraph];
+    Vector_Dense<Scalar, 0>& vector = vector_list[i_subgraph];
+    FOR(i_neighbour, plan.receive_neighbour.size()) {
+      const Halo_Exchange_Plan& plan_owner = plan_list[plan.receive_neighbour[i_neighbour]];
+      const Vector_Dense<Scalar, 0>& vector_owner = vector_list[plan.receive_neighbour[i_neighbour]];
+      const auto iter = std::lower_bound(plan_owner.send_neighbour.begin(), plan_owner.send_neighbour.end(),
+                                         i_subgraph);
+      const std::span<const std::size_t> send =
+      plan_owner.send(static_cast<std::size_t>(std::distance(plan_owner.send_neighbour.begin(), iter)));
+      const std::span<const std::size_t> receive = plan.receive(i_neighbour);
+      FOR(i_entry, receive.size()) vector[receive[i_entry]] = vector_owner[send[i_entry]];
+    }
+  },
+  1);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Transport Execution
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details Copies the message into the destination's queue for this rank, then wakes the destination.
+ */
+void Transport_Local::Endpoint::send(const std::size_t i_destination, std::span<const Scalar> data) {
+  ASSERT(i_destination < transport->size(), "Rank " + std::to_string(i_destination) + " not in range [0, " +
+                                            std::to_string(transport->size()) + ").");
+  Mailbox& mailbox = transport->mailbox[i_destination];
+  {
+    std::lock_guard lock(mailbox.mutex);
+    mailbox.message[i_rank].emplace_back(data.begin(), data.end());
+  }
+  mailbox.arrived.notify_all();
+}
+
+/**
+ * @details Waits on this rank's mailbox until a message from the source is queued, then moves it out.
+ */
+void Transport_Local::Endpoint::receive(const std::size_t i_source, std::span<Scalar> data) {
+  ASSERT(i_source < transport->size(),
+         "Rank " + std::to_string(i_source) + " not in range [0, " + std::to_string(transport->size()) + ").");
+  Mailbox& mailbox = transport->mailbox[i_rank];
+  std::vector<Scalar> message;
+  {
+    std::unique_lock lock(mailbox.mutex);
+    mailbox.arrived.wait(lock, [&]() { return !mailbox.message[i_source].empty(); });
+    message = std::move(mailbox.message[i_source].front());
+    mailbox.message[i_source].pop_front();
+  }
+  ASSERT(message.size() == data.size(), "Message from rank " + std::to_string(i_source) + " has " +
+                                        std::to_string(message.size()) + " entries, expected " +
+                                        std::to_string(data.size()) + ".");
+  std::copy(message.begin(), message.end(), data.begin());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Socket Transport
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details A socket pair is created for every pair of ranks before forking, so each process inherits its end of each
+ * pair, and closes the rest. Output buffers are flushed before forking, so are not duplicated by the children, which
+ * leave via _exit() to skip the parent's exit handlers and static destructors.
+ */
+bool Transport_Socket::run(const std::size_t number_rank, const std::function<void(Transport_Socket&)>& function) {
+  ASSERT(number_rank > 0, "Number of ranks must be positive.");
+  std::vector<std::vector<int>> socket_rank(number_rank, std::vector<int>(number_rank, -1));
+  FOR(i_rank, number_rank) {
+    FOR(i_other, i_rank + 1, number_rank) {
+      int socket_pair[2];
+      ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, socket_pair) == 0,
+             "Failed to create a socket pair, " + std::string(std::strerror(errno)) + ".");
+      socket_rank[i_rank][i_other] = socket_pair[0];
+      socket_rank[i_other][i_rank] = socket_pair[1];
+    }
+  }
+
+  const auto close_other = [&](const std::size_t i_keep) {
+    FOR(i_rank, number_rank) {
+      if(i_rank == i_keep) continue;
+      FOR_EACH(file, socket_rank[i_rank]) if(file != -1) close(file);
+    }
+  };
+  const auto execute = [&](const std::size_t i_rank) {
+    try {
+      Transport_Socket transport(i_rank, socket_rank[i_rank]);
+      function(transport);
+    } catch(...) {
+      return false;
+    }
+    return true;
+  };
+
+  std::fflush(nullptr);
+  std::vector<pid_t> process;
+  FOR(i_rank, std::size_t{1}, number_rank) {
+    const pid_t i_process = fork();
+    ASSERT(i_process >= 0, "Failed to fork rank " + std::to_string(i_rank) + ", " + std::strerror(errno) + ".");
+    if(i_process == 0) {
+      close_other(i_rank);
+      const bool success = execute(i_rank);
+      std::fflush(nullptr);
+      _exit(success ? 0 : 1);
+    }
+    process.push_back(i_process);
+  }
+
+  close_other(0);
+  bool success = execute(0);
+  FOR_EACH(i_process, process) {
+    int status = 0;
+    while(waitpid(i_process, &status, 0) < 0 && errno == EINTR) {}
+    success &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  }
+  return success;
+}
+
+/**
+ * @details Sockets of other ranks are used exclusively in non-blocking mode, via MSG_DONTWAIT, and written with
+ * MSG_NOSIGNAL so a failed peer surfaces as an error rather than SIGPIPE.
+ */
+Transport_Socket::Transport_Socket(const std::size_t i_rank_, std::vector<int> socket_)
+    : i_rank(i_rank_), socket(std::move(socket_)), pending(socket.size()), pending_begin(socket.size(), 0) {}
+
+/**
+ * @details Blocks, polling for writability, until every pending byte has been handed to the kernel, which delivers
+ * them even once the socket is closed.
+ */
+Transport_Socket::~Transport_Socket() {
+  std::vector<pollfd> poll_list;
+  while(true) {
+    progress();
+    poll_list.clear();
+    FOR(i_other, socket.size()) if(!pending[i_other].empty()) poll_list.push_back({socket[i_other], POLLOUT, 0});
+    if(poll_list.empty()) break;
+    poll(poll_list.data(), poll_list.size(), -1);
+  }
+  FOR_EACH(file, socket) if(file != -1) close(file);
+}
+
+/**
+ * @details Frames the message with its entry count, appends it to the pending buffer of the destination, then writes
+ * what the socket accepts.
+ */
+void Transport_Socket::send(const std::size_t i_destination, std::span<const Scalar> data) {
+  ASSERT(i_destination < size() && i_destination != i_rank,
+         "Rank " + std::to_string(i_destination) + " not a peer of rank " + std::to_string(i_rank) + ".");
+  const std::uint64_t header = data.size();
+  const std::span<const std::byte> header_byte = std::as_bytes(std::span(&header, 1));
+  const std::span<const std::byte> data_byte = std::as_bytes(data);
+  std::vector<std::byte>& buffer = pending[i_destination];
+  buffer.insert(buffer.end(), header_byte.begin(), header_byte.end());
+  buffer.insert(buffer.end(), data_byte.begin(), data_byte.end());
+  progress();
+}
+
+/**
+ * @details Reads the entry count of the next message, checks it against the expected size, then reads the entries.
+ */
+void Transport_Socket::receive(const std::size_t i_source, std::span<Scalar> data) {
+  ASSERT(i_source < size() && i_source != i_rank,
+         "Rank " + std::to_string(i_source) + " not a peer of rank " + std::to_string(i_rank) + ".");
+  std::uint64_t header = 0;
+  read(i_source, std::as_writable_bytes(std::span(&header, 1)));
+  ASSERT(header == data.size(), "Message from rank " + std::to_string(i_source) + " has " + std::to_string(header) +
+                                " entries, expected " + std::to_string(data.size()) + ".");
+  read(i_source, std::as_writable_bytes(data));
+}
+
+/**
+ * @details Buffers are cleared, rather than trimmed, once fully written, so the common case of a message fitting the
+ * socket buffer never moves data.
+ */
+void Transport_Socket::progress() {
+  FOR(i_other, socket.size()) {
+    std::vector<std::byte>& buffer = pending[i_other];
+    std::size_t& begin = pending_begin[i_other];
+    while(begin < buffer.size()) {
+      const ssize_t count = ::send(socket[i_other], buffer.data() + begin, buffer.size() - begin,
+                                   MSG_DONTWAIT | MSG_NOSIGNAL);
+      if(count > 0) {
+        begin += static_cast<std::size_t>(count);
+        continue;
+      }
+      if(errno == EINTR) continue;
+      ASSERT(errno == EAGAIN || errno == EWOULDBLOCK,
+             "Failed to send to rank " + std::to_string(i_other) + ", " + std::strerror(errno) + ".");
+      break;
+    }
+    if(begin == buffer.size()) {
+      buffer.clear();
+      begin = 0;
+    }
+  }
+}
+
+/**
+ * @details Exactly the requested bytes are read, so following messages stay in the socket. While waiting for them the
+ * pending writes to every peer are progressed, as the source may itself be waiting on one of them.
+ */
+void Transport_Socket::read(const std::size_t i_source, std::span<std::byte> data) {
+  std::size_t offset = 0;
+  std::vector<pollfd> poll_list;
+  while(offset < data.size()) {
+    const ssize_t count = recv(socket[i_source], data.data() + offset, data.size() - offset, MSG_DONTWAIT);
+    if(count > 0) {
+      offset += static_cast<std::size_t>(count);
+      continue;
+    }
+    ASSERT(count != 0, "Rank " + std::to_string(i_source) + " closed its connection to rank " +
+                       std::to_string(i_rank) + ".");
+    if(errno == EINTR) continue;
+    ASSERT(errno == EAGAIN || errno == EWOULDBLOCK,
+           "Failed to receive from rank " + std::to_string(i_source) + ", " + std::strerror(errno) + ".");
+
+    progress();
+    poll_list.clear();
+    poll_list.push_back({socket[i_source], POLLIN, 0});
+    FOR(i_other, socket.size()) if(!pending[i_other].empty()) poll_list.push_back({socket[i_other], POLLOUT, 0});
+    poll(poll_list.data(), poll_list.size(), -1);
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// MPI Transport
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifdef DISA_MPI
+static_assert(std::is_same_v<Scalar, double>, "Transport_MPI sends Scalar as MPI_DOUBLE.");
+
+Transport_MPI::Transport_MPI(MPI_Comm communicator_) : communicator(communicator_) {
+  int rank_mpi = 0;
+  int size_mpi = 0;
+  MPI_Comm_rank(communicator, &rank_mpi);
+  MPI_Comm_size(communicator, &size_mpi);
+  i_rank = static_cast<std::size_t>(rank_mpi);
+  number_rank = static_cast<std::size_t>(size_mpi);
+}
+
+Transport_MPI::~Transport_MPI() {
+  FOR_EACH_REF(send_request, request) MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+}
+
+/**
+ * @details Copies the message to a retained buffer and starts a non-blocking send from it. Completed sends at the front
+ * of the queue are released.
+ */
+void Transport_MPI::send(const std::size_t i_destination, std::span<const Scalar> data) {
+  ASSERT(i_destination < number_rank,
+         "Rank " + std::to_string(i_destination) + " not in range [0, " + std::to_string(number_rank) + ").");
+  request_data.emplace_back(data.begin(), data.end());
+  request.emplace_back();
+  MPI_Isend(request_data.back().data(), static_cast<int>(data.size()), MPI_DOUBLE, static_cast<int>(i_destination), 0,
+            communicator, &request.back());
+  while(!request.empty()) {
+    int complete = 0;
+    MPI_Test(&request.front(), &complete, MPI_STATUS_IGNORE);
+    if(!complete) break;
+    request.pop_front();
+    request_data.pop_front();
+  }
+}
+
+void Transport_MPI::receive(const std::size_t i_source, std::span<Scalar> data) {
+  ASSERT(i_source < number_rank,
+         "Rank " + std::to_string(i_source) + " not in range [0, " + std::to_string(number_rank) + ").");
+  MPI_Status status;
+  MPI_Recv(data.data(), static_cast<int>(data.size()), MPI_DOUBLE, static_cast<int>(i_source), 0, communicator,
+           &status);
+  int count = 0;
+  MPI_Get_count(&status, MPI_DOUBLE, &count);
+  ASSERT(static_cast<std::size_t>(count) == data.size(), "Message from rank " + std::to_string(i_source) + " has " +
+                                                         std::to_string(count) + " entries, expected " +
+                                                         std::to_string(data.size()) + ".");
+}
+
+Scalar Transport_MPI::all_reduce_sum(Scalar value) {
+  MPI_Allreduce(MPI_IN_PLACE, &value, 1, MPI_DOUBLE, MPI_SUM, communicator);
+  return value;
+}
+
+Scalar Transport_MPI::all_reduce_max(Scalar value) {
+  MPI_Allreduce(MPI_IN_PLACE, &value, 1, MPI_DOUBLE, MPI_MAX, communicator);
+  return value;
+}
+#endif
+
+}  // namespace Disa
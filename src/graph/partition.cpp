@@ -23,9 +23,16 @@
 #include "adjacency_graph.hpp"
 #include "adjacency_subgraph.hpp"
 #include "graph_utilities.hpp"
+#include "parallel.hpp"
+#include "reorder.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <numeric>
+#include <queue>
+#include <random>
 #include <vector>
 
 namespace Disa {
@@ -37,11 +44,11 @@ namespace Disa {
 /**
  * @details This function performs multinode level set expansion on a set of input subgraphs to 'improve' partition
  * topology. The number of output subgraphs is thus the same as the number of input subgraphs. The method works by first
- * computing the global eccentricity of the input graph. Nucleation seed vertices are then selected for each subgraph by
- * finding the vertex with the minimum maximal eccentricity in each subgraph. From the nucleation sites a level set
- * expansion is performed to create the next iteration of partitions. The process is repeated for the given number of
- * iterations or until the seed vertices do not change between iterations. Once the function returns the update
- * partition will be contained within the subgraph_list.
+ * selecting a nucleation seed vertex for each subgraph, its (approximate) centre, found from a few breadth first sweeps
+ * of the subgraph, see pseudo_centre_vertex. Each iteration thus costs O(E), and the subgraphs are processed in
+ * parallel. From the nucleation sites a level set expansion is performed to create the next iteration of partitions.
+ * The process is repeated for the given number of iterations or until the seed vertices do not change between
+ * iterations. Once the function returns the update partition will be contained within the subgraph_list.
  */
 void multinode_level_set_expansion(const Adjacency_Graph<false>& graph, const std::size_t max_iter,
                                    std::vector<Adjacency_Subgraph>& subgraph_list) {
@@ -49,6 +56,8 @@ void multinode_level_set_expansion(const Adjacency_Graph<false>& graph, const st
   ASSERT(
   std::all_of(subgraph_list.begin(), subgraph_list.end(), [&](auto& subgraph) { return subgraph.is_parent(graph); }),
   "The parsed graph is not a parent of all subgraphs.");
+  ASSERT(std::none_of(subgraph_list.begin(), subgraph_list.end(), [](auto& subgraph) { return subgraph.empty(); }),
+         "A parsed subgraph is empty.");
 
   if(subgraph_list.size() == 1) return;  // If its only one partition return.
 
@@ -56,38 +65,18 @@ void multinode_level_set_expansion(const Adjacency_Graph<false>& graph, const st
   std::vector<std::size_t> vertex_colors;
   std::vector<std::size_t> seed_previous(subgraph_list.size());
   std::vector<std::size_t> seed(subgraph_list.size());
-  std::vector<std::vector<std::size_t>> vertex_subgraph(subgraph_list.size());
-
-  // compute global eccentricity.
-  std::vector<std::vector<std::size_t>> vertex_eccentricity;
-  eccentricity_graph(graph, vertex_eccentricity);
 
   FOR(iter, max_iter) {
-    // find 'nucleation' seed sites.
-    FOR(i_subgraph, subgraph_list.size()) {
-      // Using the graph eccentricity we search in each graph for central vertices.
+    // find 'nucleation' seed sites, the centre of each subgraph, searching from its highest degree vertex.
+    parallel_for(
+    subgraph_list.size(),
+    [&](const std::size_t i_subgraph) {
       const auto& subgraph = subgraph_list[i_subgraph];
-      seed[i_subgraph] = std::numeric_limits<std::size_t>::max();
-      std::size_t min_eccentricity = std::numeric_limits<std::size_t>::max();
-      FOR(i_vertex_0, subgraph.size_vertex()) {
-        std::size_t i_max_eccentricity = 0;
-
-        FOR(i_vertex_1, subgraph.size_vertex()) {
-          if(i_vertex_0 == i_vertex_1) continue;
-          const bool is_0_low = subgraph.local_global(i_vertex_0) < subgraph.local_global(i_vertex_1);
-          const std::size_t& i_global_lower =
-          is_0_low ? subgraph.local_global(i_vertex_0) : subgraph.local_global(i_vertex_1);
-          const std::size_t& i_global_upper =
-          is_0_low ? subgraph.local_global(i_vertex_1) : subgraph.local_global(i_vertex_0);
-          i_max_eccentricity = std::max(vertex_eccentricity[i_global_upper][i_global_lower], i_max_eccentricity);
-        }
-
-        if(min_eccentricity > i_max_eccentricity) {
-          min_eccentricity = i_max_eccentricity;
-          seed[i_subgraph] = subgraph.local_global(i_vertex_0);
-        }
-      }
-    }
+      std::size_t i_start = 0;
+      FOR(i_vertex, subgraph.size_vertex()) if(subgraph.degree(i_vertex) > subgraph.degree(i_start)) i_start = i_vertex;
+      seed[i_subgraph] = subgraph.local_global(pseudo_centre_vertex(subgraph, i_start));
+    },
+    1);
 
     // Check if the seeds have moved, if not return, we have 'converged'.
     if(std::ranges::equal(seed_previous, seed)) return;
@@ -96,19 +85,16 @@ void multinode_level_set_expansion(const Adjacency_Graph<false>& graph, const st
     // perform level expansion from the 'seeding vertexes'
     level_expansion(graph, seed, vertex_colors);
 
-    FOR_EACH_REF(vertex_sub, vertex_subgraph) vertex_sub.clear();
-    FOR(i_vertex, vertex_colors.size()) vertex_subgraph[vertex_colors[i_vertex]].push_back(i_vertex);
-
-    FOR(i_subgraph, subgraph_list.size()) {
-      subgraph_list[i_subgraph] = Adjacency_Subgraph(graph, vertex_subgraph[i_subgraph]);
-    }
+    subgraph_list = create_subgraph_list(graph, vertex_colors, subgraph_list.size());
   }
 };
 
 /**
  * @details This function performs a recursive bisection of a graph into a specified number of partitions. It uses a
  * level traversal to determine the level at which to split the subgraph with the largest number of vertices, which then
- * forms two new subgraphs. This process is repeated, until the desired number of partitions is achieved.
+ * forms two new subgraphs. This process is repeated, until the desired number of partitions is achieved. A subgraph
+ * which is disjoint, whether the graph itself is or a previous split left it so, is instead split along its connected
+ * components, which a level traversal could not cross.
  */
 std::vector<Adjacency_Subgraph> recursive_graph_bisection(const Adjacency_Graph<false>& graph,
                                                           std::size_t number_partitions) {
@@ -118,6 +104,7 @@ std::vector<Adjacency_Subgraph> recursive_graph_bisection(const Adjacency_Graph<
   std::vector<std::size_t> left_partition;
   std::vector<std::size_t> right_partition;
   std::vector<std::size_t> levels(graph.size_vertex());
+  std::vector<std::size_t> component;
 
   // Tricky: hi-jacking this vector of sub-graph initialisation.
   std::iota(levels.begin(), levels.end(), 0);
@@ -130,14 +117,38 @@ std::vector<Adjacency_Subgraph> recursive_graph_bisection(const Adjacency_Graph<
       return sg0.size_vertex() < sg1.size_vertex();
     });
 
-    // Perform a level traversal and determine level to split at.
-    levels = level_traversal(*split_graph, pseudo_peripheral_vertex(*split_graph));
-    const std::size_t middle_level = std::ceil(*std::max_element(levels.begin(), levels.end()) / 2);
+    // A disjoint domain is split along its components, balancing the halves greedily, largest component first.
+    const std::size_t number_component = connected_components(*split_graph, component);
+    if(number_component > 1) {
+      std::vector<std::size_t> component_size(number_component, 0);
+      FOR_EACH(i_component, component) ++component_size[i_component];
+      std::vector<std::size_t> component_order(number_component);
+      std::iota(component_order.begin(), component_order.end(), 0);
+      std::stable_sort(component_order.begin(), component_order.end(),
+                       [&](const std::size_t i_component_0, const std::size_t i_component_1) {
+                         return component_size[i_component_0] > component_size[i_component_1];
+                       });
+      std::vector<bool> is_left(number_component);
+      std::size_t size_left = 0;
+      std::size_t size_right = 0;
+      FOR_EACH(i_component, component_order) {
+        is_left[i_component] = size_left <= size_right;
+        (is_left[i_component] ? size_left : size_right) += component_size[i_component];
+      }
+      FOR(i_vertex, component.size())
+      (is_left[component[i_vertex]] ? left_partition : right_partition).push_back(split_graph->local_global(i_vertex));
+    } else {
+      // Perform a level traversal and determine level to split at.
+      levels = level_traversal(*split_graph, pseudo_peripheral_vertex(*split_graph));
+      const std::size_t middle_level = std::ceil(*std::max_element(levels.begin(), levels.end()) / 2);
+
+      // Split the graph.
+      FOR(i_vertex, levels.size())
+      if(levels[i_vertex] <= middle_level) left_partition.push_back(split_graph->local_global(i_vertex));
+      else right_partition.push_back(split_graph->local_global(i_vertex));
+    }
 
-    // Split the graph, and form new subgraphs.
-    FOR(i_vertex, levels.size())
-    if(levels[i_vertex] <= middle_level) left_partition.push_back(split_graph->local_global(i_vertex));
-    else right_partition.push_back(split_graph->local_global(i_vertex));
+    // Form the new subgraphs.
     *split_graph = Adjacency_Subgraph(graph, left_partition, 0);
     subgraph.emplace_back(graph, right_partition, 0);
 
@@ -149,4 +160,625 @@ std::vector<Adjacency_Subgraph> recursive_graph_bisection(const Adjacency_Graph<
   return subgraph;
 };
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Multilevel Partitioning
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Weighted_Graph
+ * @brief A compressed, vertex and edge weighted, undirected graph, the working graph of the multilevel partitioner.
+ */
+struct Weighted_Graph {
+  std::vector<std::size_t> offset = {0};    //!< The start of each vertex's adjacency.
+  std::vector<std::size_t> adjacency;       //!< The adjacent vertices of each vertex.
+  std::vector<std::size_t> edge_weight;     //!< The weight of each adjacency entry, equal in both directions.
+  std::vector<std::size_t> vertex_weight;   //!< The weight of each vertex.
+
+  [[nodiscard]] inline std::size_t size_vertex() const noexcept { return vertex_weight.size(); }
+};
+
+/**
+ * @brief Computes the (weighted) edge cut of a partitioning.
+ * @param[in] graph The weighted graph.
+ * @param[in] part The part of each vertex.
+ * @return The sum of the weights of edges joining different parts.
+ */
+inline std::size_t partition_edge_cut(const Weighted_Graph& graph, const std::vector<std::size_t>& part) {
+  std::size_t cut = 0;
+  FOR(i_vertex, graph.size_vertex()) {
+    FOR(i_entry, graph.offset[i_vertex], graph.offset[i_vertex + 1]) {
+      if(part[graph.adjacency[i_entry]] != part[i_vertex]) cut += graph.edge_weight[i_entry];
+    }
+  }
+  return cut / 2;
+}
+
+/**
+ * @brief Coarsens a weighted graph by contracting a heavy edge matching.
+ * @param[in] fine The graph to coarsen.
+ * @param[in] max_vertex_weight The maximum weight of a contracted (coarse) vertex.
+ * @param[in,out] engine The random engine, used to order the matching visits.
+ * @param[out] fine_coarse The coarse vertex of each fine vertex.
+ * @return The coarse graph.
+ *
+ * @details Vertices are visited in a random order, each unmatched vertex being matched to the unmatched neighbour it
+ * shares the heaviest edge with, ties to the lowest index. Matched pairs are then contracted, the weights of the
+ * vertices, and of parallel edges, summed. Edges internal to a pair vanish, i.e. the coarse cut equals the fine cut.
+ */
+inline Weighted_Graph heavy_edge_coarsen(const Weighted_Graph& fine, const std::size_t max_vertex_weight,
+                                         std::mt19937_64& engine, std::vector<std::size_t>& fine_coarse) {
+  constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+  const std::size_t size = fine.size_vertex();
+
+  // Visit order, a Fisher-Yates shuffle written out so the result does not depend on the standard library.
+  std::vector<std::size_t> visit(size);
+  std::iota(visit.begin(), visit.end(), 0);
+  for(std::size_t i_visit = size; i_visit > 1; --i_visit) std::swap(visit[i_visit - 1], visit[engine() % i_visit]);
+
+  // Heavy edge matching.
+  std::vector<std::size_t> match(size, unset);
+  FOR_EACH(i_vertex, visit) {
+    if(match[i_vertex] != unset) continue;
+    std::size_t i_match = i_vertex;
+    std::size_t heaviest = 0;
+    FOR(i_entry, fine.offset[i_vertex], fine.offset[i_vertex + 1]) {
+      const std::size_t i_adjacent = fine.adjacency[i_entry];
+      if(match[i_adjacent] != unset ||
+         fine.vertex_weight[i_vertex] + fine.vertex_weight[i_adjacent] > max_vertex_weight)
+        continue;
+      if(fine.edge_weight[i_entry] > heaviest || (fine.edge_weight[i_entry] == heaviest && i_adjacent < i_match)) {
+        heaviest = fine.edge_weight[i_entry];
+        i_match = i_adjacent;
+      }
+    }
+    match[i_vertex] = i_match;
+    match[i_match] = i_vertex;
+  }
+
+  // Number the coarse vertices, in order of their lowest fine vertex.
+  std::size_t size_coarse = 0;
+  fine_coarse.assign(size, unset);
+  FOR(i_vertex, size) {
+    if(fine_coarse[i_vertex] != unset) continue;
+    fine_coarse[i_vertex] = size_coarse;
+    fine_coarse[match[i_vertex]] = size_coarse++;
+  }
+
+  // Contract, merging parallel edges with a marker per coarse vertex.
+  Weighted_Graph coarse;
+  coarse.vertex_weight.assign(size_coarse, 0);
+  coarse.offset.reserve(size_coarse + 1);
+  coarse.adjacency.reserve(fine.adjacency.size());
+  coarse.edge_weight.reserve(fine.adjacency.size());
+  std::vector<std::size_t> marker(size_coarse, unset);
+  std::size_t i_coarse = 0;
+  FOR(i_vertex, size) {
+    if(fine_coarse[i_vertex] != i_coarse) continue;  // Only visit a pair from its lowest vertex.
+    const std::size_t begin = coarse.adjacency.size();
+    for(const std::size_t i_member : {i_vertex, match[i_vertex]}) {
+      coarse.vertex_weight[i_coarse] += fine.vertex_weight[i_member];
+      FOR(i_entry, fine.offset[i_member], fine.offset[i_member + 1]) {
+        const std::size_t i_adjacent = fine_coarse[fine.adjacency[i_entry]];
+        if(i_adjacent == i_coarse) continue;
+        if(marker[i_adjacent] == unset) {
+          marker[i_adjacent] = coarse.adjacency.size();
+          coarse.adjacency.push_back(i_adjacent);
+          coarse.edge_weight.push_back(fine.edge_weight[i_entry]);
+        } else coarse.edge_weight[marker[i_adjacent]] += fine.edge_weight[i_entry];
+      }
+      if(match[i_vertex] == i_vertex) break;
+    }
+    FOR(i_entry, begin, coarse.adjacency.size()) marker[coarse.adjacency[i_entry]] = unset;
+    coarse.offset.push_back(coarse.adjacency.size());
+    ++i_coarse;
+  }
+  return coarse;
+}
+
+/**
+ * @brief Refines a k-way partitioning with Fiduccia-Mattheyses passes over the boundary vertices.
+ * @param[in] graph The weighted graph.
+ * @param[in] number_part The number of parts.
+ * @param[in] max_part_weight The maximum weight allowed for each part.
+ * @param[in,out] part The part of each vertex.
+ * @param[in] max_pass The maximum number of passes.
+ *
+ * @details Each pass moves boundary vertices, highest gain first, to the neighbouring part that most reduces the cut
+ * and still respects that part's maximum weight. Negative gain moves are allowed, so the pass can climb out of local
+ * minima, but each vertex moves at most once. Moves out of an overweight part are also allowed into any lighter part.
+ * After the pass the moves are rolled back to the best state seen, judged first by the total overweight then by the
+ * cut. Gains are kept in a lazily updated priority queue, stale entries being re-evaluated as they are popped. Passes
+ * stop when one fails to improve.
+ */
+inline void fiduccia_mattheyses_refine(const Weighted_Graph& graph, const std::size_t number_part,
+                                       const std::vector<std::size_t>& max_part_weight, std::vector<std::size_t>& part,
+                                       const std::size_t max_pass = 8) {
+  constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+  const std::size_t size = graph.size_vertex();
+  const std::size_t move_limit = std::max<std::size_t>(32, size / 64);  // Unproductive moves before a pass stops.
+
+  std::vector<std::size_t> part_weight(number_part, 0);
+  FOR(i_vertex, size) part_weight[part[i_vertex]] += graph.vertex_weight[i_vertex];
+  const auto overweight = [&](const std::size_t i_part) {
+    return part_weight[i_part] > max_part_weight[i_part] ? part_weight[i_part] - max_part_weight[i_part] : 0;
+  };
+
+  // The best move of a vertex, [target part, gain], the target unset if the vertex cannot move.
+  std::vector<std::size_t> connection(number_part, 0);
+  std::vector<std::size_t> touched;
+  const auto best_move = [&](const std::size_t i_vertex) {
+    touched.clear();
+    FOR(i_entry, graph.offset[i_vertex], graph.offset[i_vertex + 1]) {
+      const std::size_t i_part = part[graph.adjacency[i_entry]];
+      if(connection[i_part] == 0) touched.push_back(i_part);
+      connection[i_part] += graph.edge_weight[i_entry];
+    }
+    const std::size_t i_source = part[i_vertex];
+    const std::size_t weight = graph.vertex_weight[i_vertex];
+    const s_size_t internal = static_cast<s_size_t>(connection[i_source]);
+    std::pair<std::size_t, s_size_t> move = {unset, std::numeric_limits<s_size_t>::min()};
+    FOR_EACH(i_part, touched) {
+      if(i_part == i_source) continue;
+      const bool is_fit = part_weight[i_part] + weight <= max_part_weight[i_part];
+      const bool is_relief = overweight(i_source) > 0 && part_weight[i_part] + weight < part_weight[i_source];
+      if(!is_fit && !is_relief) continue;
+      const s_size_t gain = static_cast<s_size_t>(connection[i_part]) - internal;
+      if(gain > move.second || (gain == move.second && part_weight[i_part] < part_weight[move.first]))
+        move = {i_part, gain};
+    }
+    FOR_EACH(i_part, touched) connection[i_part] = 0;
+    return move;
+  };
+
+  std::vector<bool> locked(size);
+  std::vector<std::pair<std::size_t, std::size_t>> moves;  // [vertex, source part]
+  std::priority_queue<std::pair<s_size_t, std::size_t>> queue;
+  FOR(i_pass, max_pass) {
+    std::fill(locked.begin(), locked.end(), false);
+    moves.clear();
+    queue = {};
+    FOR(i_vertex, size) {
+      const auto [i_target, gain] = best_move(i_vertex);
+      if(i_target != unset) queue.emplace(gain, i_vertex);
+    }
+
+    std::size_t total_overweight = 0;
+    FOR(i_part, number_part) total_overweight += overweight(i_part);
+    s_size_t cut_change = 0;
+    std::pair<std::size_t, s_size_t> best = {total_overweight, 0};
+    std::size_t best_size = 0;
+    while(!queue.empty() && moves.size() - best_size < move_limit) {
+      const auto [gain_queued, i_vertex] = queue.top();
+      queue.pop();
+      if(locked[i_vertex]) continue;
+      const auto [i_target, gain] = best_move(i_vertex);
+      if(i_target == unset) continue;
+      if(gain != gain_queued) {
+        queue.emplace(gain, i_vertex);
+        continue;
+      }
+
+      // Move, and record the state if it is the best seen.
+      const std::size_t i_source = part[i_vertex];
+      total_overweight -= overweight(i_source) + overweight(i_target);
+      part_weight[i_source] -= graph.vertex_weight[i_vertex];
+      part_weight[i_target] += graph.vertex_weight[i_vertex];
+      total_overweight += overweight(i_source) + overweight(i_target);
+      part[i_vertex] = i_target;
+      locked[i_vertex] = true;
+      moves.emplace_back(i_vertex, i_source);
+      cut_change -= gain;
+      if(std::make_pair(total_overweight, cut_change) < best) {
+        best = {total_overweight, cut_change};
+        best_size = moves.size();
+      }
+
+      FOR(i_entry, graph.offset[i_vertex], graph.offset[i_vertex + 1]) {
+        const std::size_t i_adjacent = graph.adjacency[i_entry];
+        if(locked[i_adjacent]) continue;
+        const auto [i_target_adjacent, gain_adjacent] = best_move(i_adjacent);
+        if(i_target_adjacent != unset) queue.emplace(gain_adjacent, i_adjacent);
+      }
+    }
+
+    // Roll back to the best state.
+    while(moves.size() > best_size) {
+      const auto [i_vertex, i_source] = moves.back();
+      part_weight[part[i_vertex]] -= graph.vertex_weight[i_vertex];
+      part_weight[i_source] += graph.vertex_weight[i_vertex];
+      part[i_vertex] = i_source;
+      moves.pop_back();
+    }
+    if(best_size == 0) break;
+  }
+}
+
+/**
+ * @brief Recursively bisects (a subset of) a weighted graph, by greedy graph growing and FM refinement, into k parts.
+ * @param[in] graph The weighted graph.
+ * @param[in] vertex The vertices of the subset to bisect.
+ * @param[in] number_part The number of parts the subset is to be divided into.
+ * @param[in] i_part_begin The first part index of the subset.
+ * @param[in] imbalance The allowed imbalance of each bisection.
+ * @param[in,out] engine The random engine, used to select growing seeds.
+ * @param[out] part The part of each vertex, only the subset's entries are written.
+ *
+ * @details The subset is split into a left of floor(k / 2) parts and a right of the rest, with weights in the same
+ * ratio. A few trials are made, each growing the left from a seed vertex by repeatedly absorbing the frontier vertex
+ * that least increases the cut (greedy graph growing), restarting from a new seed should a component be exhausted. Each
+ * trial is refined by FM and the lowest cut kept, before each half is bisected in turn.
+ */
+inline void recursive_bisection(const Weighted_Graph& graph, const std::vector<std::size_t>& vertex,
+                                const std::size_t number_part, const std::size_t i_part_begin, const Scalar imbalance,
+                                std::mt19937_64& engine, std::vector<std::size_t>& part) {
+  constexpr std::size_t number_trial = 4;
+  if(number_part == 1 || vertex.size() <= 1) {
+    FOR_EACH(i_vertex, vertex) part[i_vertex] = i_part_begin;
+    return;
+  }
+
+  // Induced subgraph of the subset, using part as the global to local map.
+  Weighted_Graph subgraph;
+  FOR(i_local, vertex.size()) part[vertex[i_local]] = i_local;
+  std::vector<bool> in_subset(graph.size_vertex(), false);
+  FOR_EACH(i_vertex, vertex) in_subset[i_vertex] = true;
+  FOR_EACH(i_vertex, vertex) {
+    FOR(i_entry, graph.offset[i_vertex], graph.offset[i_vertex + 1]) {
+      if(!in_subset[graph.adjacency[i_entry]]) continue;
+      subgraph.adjacency.push_back(part[graph.adjacency[i_entry]]);
+      subgraph.edge_weight.push_back(graph.edge_weight[i_entry]);
+    }
+    subgraph.offset.push_back(subgraph.adjacency.size());
+    subgraph.vertex_weight.push_back(graph.vertex_weight[i_vertex]);
+  }
+  const std::size_t size = subgraph.size_vertex();
+
+  // Target and maximum weights of each half.
+  const std::size_t number_left = number_part / 2;
+  const std::size_t total_weight =
+  std::accumulate(subgraph.vertex_weight.begin(), subgraph.vertex_weight.end(), std::size_t(0));
+  const std::size_t max_weight = *std::max_element(subgraph.vertex_weight.begin(), subgraph.vertex_weight.end());
+  const std::size_t target_left = total_weight * number_left / number_part;
+  std::vector<std::size_t> max_part_weight = {target_left, total_weight - target_left};
+  FOR_EACH_REF(weight, max_part_weight) {
+    weight = std::max(static_cast<std::size_t>(std::ceil((1 + imbalance) * static_cast<Scalar>(weight))),
+                      weight + max_weight);
+  }
+
+  // Greedy graph growing trials, side 0 being the left.
+  std::vector<std::size_t> side(size);
+  std::vector<std::size_t> side_best;
+  std::vector<s_size_t> gain(size);
+  std::size_t cut_best = std::numeric_limits<std::size_t>::max();
+  std::priority_queue<std::pair<s_size_t, std::size_t>> queue;
+  FOR(i_trial, number_trial) {
+    std::fill(side.begin(), side.end(), 1);
+    FOR(i_vertex, size) {
+      gain[i_vertex] = 0;
+      FOR(i_entry, subgraph.offset[i_vertex], subgraph.offset[i_vertex + 1])
+      gain[i_vertex] -= static_cast<s_size_t>(subgraph.edge_weight[i_entry]);
+    }
+    queue = {};
+    const std::size_t seed = engine() % size;
+    queue.emplace(gain[seed], seed);
+    std::size_t weight_left = 0;
+    std::size_t i_next_seed = 0;
+    while(weight_left < target_left) {
+      if(queue.empty()) {
+        while(side[i_next_seed] == 0) ++i_next_seed;
+        queue.emplace(gain[i_next_seed], i_next_seed);
+      }
+      const auto [gain_queued, i_vertex] = queue.top();
+      queue.pop();
+      if(side[i_vertex] == 0 || gain_queued != gain[i_vertex]) continue;
+      side[i_vertex] = 0;
+      weight_left += subgraph.vertex_weight[i_vertex];
+      FOR(i_entry, subgraph.offset[i_vertex], subgraph.offset[i_vertex + 1]) {
+        const std::size_t i_adjacent = subgraph.adjacency[i_entry];
+        if(side[i_adjacent] == 0) continue;
+        gain[i_adjacent] += 2 * static_cast<s_size_t>(subgraph.edge_weight[i_entry]);
+        queue.emplace(gain[i_adjacent], i_adjacent);
+      }
+    }
+    fiduccia_mattheyses_refine(subgraph, 2, max_part_weight, side);
+    const std::size_t cut = partition_edge_cut(subgraph, side);
+    if(cut < cut_best) {
+      cut_best = cut;
+      side_best = side;
+    }
+  }
+
+  // Recurse on each half.
+  std::vector<std::size_t> vertex_left;
+  std::vector<std::size_t> vertex_right;
+  FOR(i_local, size) (side_best[i_local] == 0 ? vertex_left : vertex_right).push_back(vertex[i_local]);
+  recursive_bisection(graph, vertex_left, number_left, i_part_begin, imbalance, engine, part);
+  recursive_bisection(graph, vertex_right, number_part - number_left, i_part_begin + number_left, imbalance, engine,
+                      part);
+}
+
+/**
+ * @details Follows the multilevel scheme of Karypis and Kumar (METIS, SIAM J. Sci. Comput. 20, 1998):
+ *
+ * 1. Coarsening, the graph is repeatedly contracted by heavy edge matching, until it has fewer than about 20 vertices
+ *    per part or stops shrinking. Coarse vertex weights are capped, so that the coarsest graph can still be balanced.
+ * 2. Initial partitioning, the coarsest graph is recursively bisected by greedy graph growing, refined by FM.
+ * 3. Uncoarsening, the partition is projected back level by level, and refined at each by k-way FM boundary
+ *    refinement, which also restores the balance where coarse vertices were too heavy to allow it.
+ *
+ * The maximum weight of a part is (1 + imbalance) times the average, but never less than the average plus the heaviest
+ * vertex of the level, so that each level remains feasible. The algorithm is deterministic, the random engine being
+ * seeded with a fixed value. Subgraphs hold their vertices in ascending global order.
+ */
+std::vector<Adjacency_Subgraph> multilevel_graph_partition(const Adjacency_Graph<false>& graph,
+                                                           const std::size_t number_partitions,
+                                                           const std::vector<std::size_t>& vertex_weight,
+                                                           const Scalar imbalance) {
+  ASSERT(number_partitions > 0, "Cannot split a graph into zero domains.");
+  ASSERT(number_partitions <= graph.size_vertex(), "Cannot split a graph into more domains than it has vertices.");
+  ASSERT(vertex_weight.empty() || vertex_weight.size() == graph.size_vertex(),
+         "Vertex weight size " + std::to_string(vertex_weight.size()) + " does not match the graph size " +
+         std::to_string(graph.size_vertex()) + ".");
+  ASSERT(imbalance >= 0, "The imbalance tolerance cannot be negative.");
+
+  // Finest level.
+  std::vector<Weighted_Graph> level(1);
+  FOR(i_vertex, graph.size_vertex()) {
+    level[0].adjacency.insert(level[0].adjacency.end(), graph[i_vertex].begin(), graph[i_vertex].end());
+    level[0].offset.push_back(level[0].adjacency.size());
+  }
+  level[0].edge_weight.assign(level[0].adjacency.size(), 1);
+  if(vertex_weight.empty()) level[0].vertex_weight.assign(graph.size_vertex(), 1);
+  else level[0].vertex_weight = vertex_weight;
+  const std::size_t total_weight =
+  std::accumulate(level[0].vertex_weight.begin(), level[0].vertex_weight.end(), std::size_t(0));
+
+  // Coarsen.
+  std::mt19937_64 engine(5489u);
+  const std::size_t coarsen_to = std::max<std::size_t>(20 * number_partitions, 64);
+  const std::size_t max_vertex_weight = std::max<std::size_t>(3 * total_weight / (2 * coarsen_to), 1);
+  std::vector<std::vector<std::size_t>> fine_coarse;
+  while(level.back().size_vertex() > coarsen_to) {
+    fine_coarse.emplace_back();
+    Weighted_Graph coarse = heavy_edge_coarsen(level.back(), max_vertex_weight, engine, fine_coarse.back());
+    if(20 * coarse.size_vertex() > 19 * level.back().size_vertex()) {
+      fine_coarse.pop_back();
+      break;
+    }
+    level.push_back(std::move(coarse));
+  }
+
+  // Initial partition.
+  std::vector<std::size_t> part(level.back().size_vertex());
+  std::vector<std::size_t> vertex(level.back().size_vertex());
+  std::iota(vertex.begin(), vertex.end(), 0);
+  recursive_bisection(level.back(), vertex, number_partitions, 0, imbalance, engine, part);
+
+  // Uncoarsen and refine.
+  const std::size_t average_weight = (total_weight + number_partitions - 1) / number_partitions;
+  for(std::size_t i_level = level.size(); i_level-- > 0;) {
+    if(i_level + 1 < level.size()) {
+      std::vector<std::size_t> part_fine(level[i_level].size_vertex());
+      FOR(i_vertex, part_fine.size()) part_fine[i_vertex] = part[fine_coarse[i_level][i_vertex]];
+      part.swap(part_fine);
+    }
+    const std::size_t max_weight =
+    *std::max_element(level[i_level].vertex_weight.begin(), level[i_level].vertex_weight.end());
+    const std::size_t max_part_weight =
+    std::max(static_cast<std::size_t>(std::ceil((1 + imbalance) * static_cast<Scalar>(total_weight) /
+                                                static_cast<Scalar>(number_partitions))),
+             average_weight + max_weight);
+    fiduccia_mattheyses_refine(level[i_level], number_partitions,
+                               std::vector<std::size_t>(number_partitions, max_part_weight), part);
+  }
+
+  return create_subgraph_list(graph, part, number_partitions);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Geometric Partitioning
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details The vertices are ordered along the curve and the ordering cut into number_partitions contiguous chunks, the
+ * first (size % number_partitions) chunks receiving one extra vertex. The locality of the curve keeps each chunk
+ * spatially compact, while the cut itself is O(n log n) and needs no graph traversal. No attempt is made to minimise
+ * the edge cut, the result is a good, cheap, starting point for the graph based partitioners.
+ */
+template<std::size_t _dimension>
+std::vector<Adjacency_Subgraph> space_filling_curve_partition(
+const Adjacency_Graph<false>& graph, const std::vector<Vector_Dense<Scalar, _dimension>>& coordinate,
+std::size_t number_partitions, const Curve_Type curve) {
+  ASSERT(number_partitions > 0, "Cannot split a graph into zero domains.");
+  ASSERT(coordinate.size() == graph.size_vertex(), "Coordinate size " + std::to_string(coordinate.size()) +
+                                                   " does not match the graph size " +
+                                                   std::to_string(graph.size_vertex()) + ".");
+
+  // Cut the curve into contiguous chunks, the first remainder chunks being one larger.
+  std::vector<std::size_t> vertex_part = space_filling_curve(coordinate, curve);
+  const std::size_t chunk = vertex_part.size() / number_partitions;
+  const std::size_t remainder = vertex_part.size() % number_partitions;
+  FOR_EACH_REF(i_position, vertex_part) {
+    i_position = i_position < remainder * (chunk + 1) ? i_position / (chunk + 1)
+                                                       : remainder + (i_position - remainder * (chunk + 1)) / chunk;
+  }
+  return create_subgraph_list(graph, vertex_part, number_partitions);
+}
+
+template std::vector<Adjacency_Subgraph> space_filling_curve_partition(const Adjacency_Graph<false>&,
+                                                                       const std::vector<Vector_Dense<Scalar, 2>>&,
+                                                                       std::size_t, Curve_Type);
+template std::vector<Adjacency_Subgraph> space_filling_curve_partition(const Adjacency_Graph<false>&,
+                                                                       const std::vector<Vector_Dense<Scalar, 3>>&,
+                                                                       std::size_t, Curve_Type);
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Partition Metrics
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Computes the quality metrics of a partitioning, shared by the vertex part and subgraph overloads.
+ * @param[in] graph The partitioned graph.
+ * @param[in] vertex_part The part of each vertex, each less than number_part.
+ * @param[in] number_part The number of parts, some of which may be empty.
+ * @param[in] vertex_weight The weight of each vertex, empty for unit weights.
+ * @return The partition metrics.
+ *
+ * @details Each thread takes a contiguous block of vertices and reduces into its own per part partial results. For
+ * each vertex the distinct other parts among its neighbours are gathered, giving its cut edges, its communication
+ * volume and whether it is a boundary vertex, the parts themselves being recorded as neighbours of the vertex's part.
+ * The components of the parts are then counted by a breadth first search confined to each part, with the parts
+ * processed in parallel.
+ */
+inline Partition_Metrics partition_metrics_part(const Adjacency_Graph<false>& graph,
+                                                const std::vector<std::size_t>& vertex_part,
+                                                const std::size_t number_part,
+                                                const std::vector<std::size_t>& vertex_weight) {
+  ASSERT(vertex_weight.empty() || vertex_weight.size() == graph.size_vertex(),
+         "Vertex weight size " + std::to_string(vertex_weight.size()) + " does not match the graph size " +
+         std::to_string(graph.size_vertex()) + ".");
+  const std::size_t size = graph.size_vertex();
+
+  struct Partial {
+    std::size_t edge_cut = 0;
+    std::vector<std::size_t> weight;
+    std::vector<std::size_t> boundary;
+    std::vector<std::size_t> volume;
+    std::vector<std::vector<std::size_t>> neighbour;
+  };
+  const std::size_t number_thread = std::min(parallel_thread_count(), std::max<std::size_t>(size / 1024, 1));
+  std::vector<Partial> partial(number_thread);
+  parallel_region(number_thread, [&](const std::size_t i_thread, const std::size_t number_thread) {
+    const auto [i_begin, i_end] = parallel_block(size, i_thread, number_thread);
+    Partial& result = partial[i_thread];
+    result.weight.assign(number_part, 0);
+    result.boundary.assign(number_part, 0);
+    result.volume.assign(number_part, 0);
+    result.neighbour.resize(number_part);
+    std::vector<std::size_t> adjacent_part;
+    FOR(i_vertex, i_begin, i_end) {
+      const std::size_t i_part = vertex_part[i_vertex];
+      result.weight[i_part] += vertex_weight.empty() ? 1 : vertex_weight[i_vertex];
+      adjacent_part.clear();
+      FOR_EACH(i_adjacent, graph[i_vertex]) {
+        if(vertex_part[i_adjacent] == i_part) continue;
+        ++result.edge_cut;
+        adjacent_part.push_back(vertex_part[i_adjacent]);
+      }
+      if(adjacent_part.empty()) continue;
+      std::sort(adjacent_part.begin(), adjacent_part.end());
+      adjacent_part.erase(std::unique(adjacent_part.begin(), adjacent_part.end()), adjacent_part.end());
+      ++result.boundary[i_part];
+      result.volume[i_part] += adjacent_part.size();
+      result.neighbour[i_part].insert(result.neighbour[i_part].end(), adjacent_part.begin(), adjacent_part.end());
+    }
+  });
+
+  // Reduce the partials.
+  Partition_Metrics metrics;
+  metrics.part_weight.assign(number_part, 0);
+  metrics.boundary_vertex.assign(number_part, 0);
+  metrics.neighbour_part.assign(number_part, 0);
+  std::vector<std::size_t> volume(number_part, 0);
+  FOR_EACH(result, partial) {
+    metrics.edge_cut += result.edge_cut;
+    FOR(i_part, number_part) {
+      metrics.part_weight[i_part] += result.weight[i_part];
+      metrics.boundary_vertex[i_part] += result.boundary[i_part];
+      volume[i_part] += result.volume[i_part];
+    }
+  }
+  metrics.edge_cut /= 2;
+  parallel_for(
+  number_part,
+  [&](const std::size_t i_part) {
+    std::vector<std::size_t>& neighbour = partial.front().neighbour[i_part];
+    FOR(i_thread, 1, partial.size())
+    neighbour.insert(neighbour.end(), partial[i_thread].neighbour[i_part].begin(),
+                     partial[i_thread].neighbour[i_part].end());
+    std::sort(neighbour.begin(), neighbour.end());
+    metrics.neighbour_part[i_part] = std::unique(neighbour.begin(), neighbour.end()) - neighbour.begin();
+  },
+  1);
+  metrics.communication_volume = std::accumulate(volume.begin(), volume.end(), std::size_t(0));
+  metrics.communication_volume_max = *std::max_element(volume.begin(), volume.end());
+  const std::size_t total_weight =
+  std::accumulate(metrics.part_weight.begin(), metrics.part_weight.end(), std::size_t(0));
+  if(total_weight != 0)
+    metrics.imbalance = static_cast<Scalar>(number_part) *
+                        static_cast<Scalar>(*std::max_element(metrics.part_weight.begin(), metrics.part_weight.end())) /
+                        static_cast<Scalar>(total_weight) -
+                        1;
+
+  // Count the components of each part, by breadth first searches confined to the part.
+  std::vector<std::size_t> part_offset(number_part + 1, 0);
+  FOR_EACH(i_part, vertex_part) ++part_offset[i_part + 1];
+  std::partial_sum(part_offset.begin(), part_offset.end(), part_offset.begin());
+  std::vector<std::size_t> part_vertex(size);
+  std::vector<std::size_t> insert(part_offset.begin(), part_offset.end() - 1);
+  FOR(i_vertex, size) part_vertex[insert[vertex_part[i_vertex]]++] = i_vertex;
+  metrics.component.assign(number_part, 0);
+  std::vector<std::uint8_t> visited(size, false);
+  parallel_for(
+  number_part,
+  [&](const std::size_t i_part) {
+    std::vector<std::size_t> queue;
+    FOR(i_index, part_offset[i_part], part_offset[i_part + 1]) {
+      const std::size_t i_seed = part_vertex[i_index];
+      if(visited[i_seed]) continue;
+      ++metrics.component[i_part];
+      visited[i_seed] = true;
+      queue.assign(1, i_seed);
+      FOR(i_front, queue.size()) {
+        FOR_EACH(i_adjacent, graph[queue[i_front]]) {
+          if(vertex_part[i_adjacent] != i_part || visited[i_adjacent]) continue;
+          visited[i_adjacent] = true;
+          queue.push_back(i_adjacent);
+        }
+      }
+    }
+  },
+  1);
+  return metrics;
+}
+
+/**
+ * @details The number of parts is taken as the largest part plus one, see partition_metrics_part.
+ */
+Partition_Metrics partition_metrics(const Adjacency_Graph<false>& graph, const std::vector<std::size_t>& vertex_part,
+                                    const std::vector<std::size_t>& vertex_weight) {
+  ASSERT(vertex_part.size() == graph.size_vertex(), "Vertex part size " + std::to_string(vertex_part.size()) +
+                                                    " does not match the graph size " +
+                                                    std::to_string(graph.size_vertex()) + ".");
+  if(graph.empty()) return {};
+  return partition_metrics_part(graph, vertex_part, *std::max_element(vertex_part.begin(), vertex_part.end()) + 1,
+                                vertex_weight);
+}
+
+/**
+ * @details Converts the subgraphs to a part per vertex, using only their primary vertices so that halo levels are
+ * ignored. Empty subgraphs are kept as empty parts.
+ */
+Partition_Metrics partition_metrics(const Adjacency_Graph<false>& graph,
+                                    const std::vector<Adjacency_Subgraph>& subgraph_list,
+                                    const std::vector<std::size_t>& vertex_weight) {
+  ASSERT(!subgraph_list.empty(), "The subgraph list is empty.");
+  std::vector<std::size_t> vertex_part(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+  FOR(i_part, subgraph_list.size()) {
+    const Adjacency_Subgraph& subgraph = subgraph_list[i_part];
+    ASSERT(subgraph.is_parent(graph), "Subgraph " + std::to_string(i_part) + " is not a subgraph of the graph.");
+    FOR(i_local, subgraph.size_vertex()) {
+      if(subgraph.vertex_level(i_local) != 0) continue;
+      const std::size_t i_global = subgraph.local_global(i_local);
+      ASSERT(vertex_part[i_global] == std::numeric_limits<std::size_t>::max(),
+             "Vertex " + std::to_string(i_global) + " is in more than one subgraph.");
+      vertex_part[i_global] = i_part;
+    }
+  }
+  ASSERT(std::find(vertex_part.begin(), vertex_part.end(), std::numeric_limits<std::size_t>::max()) ==
+         vertex_part.end(), "Not all vertices are in a subgraph.");
+  return partition_metrics_part(graph, vertex_part, subgraph_list.size(), vertex_weight);
+}
+
 }  // namespace Disa
@@ -20,8 +20,14 @@
 // ---------------------------------------------------------------------------------------------------------------------
 
 #include "reorder.hpp"
+#include "adjacency_subgraph.hpp"
+#include "graph_utilities.hpp"
 #include "macros.hpp"
+#include "parallel.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <map>
 #include <numeric>
 #include <queue>
@@ -33,27 +39,103 @@ namespace Disa {
 // ---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @details The implementation of this breadth first search (BFS) follows pretty standard queue based approach which is
- * readily searchable online (two links below). The algorithm reorders the graph through an 'advancing front' or
- * 'level-set' of unvisited vertices which are adjacent to those already visited. At each iteration the front of the
- * visited vertex queue is added to the permutation vector before it popped off the queue. While vertex's unvisited
- * adjacent neighbours are added to the back of the queue: A 'first-in first-out' queue principle.
+ * @brief Orders each connected component of a graph independently, and concurrently, concatenating the orderings.
+ * @tparam _ordering Function type, std::vector<std::size_t>(const Adjacency_Graph<false>&, std::size_t), ordering a
+ *                   connected graph from a start vertex, or from its own choice of start vertex if given max().
+ * @param[in] graph The graph to reorder, may be disjoint.
+ * @param[in] start_vertex The vertex whose component is numbered first, and ordered from it, or max().
+ * @param[in] ordering The ordering of a single component.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
  *
- * Perhaps some minor differences to note:
- * 1. We are not doing a search here, all vertices are visited. Hence the removal of the 'search' term in the name.
- * 2. Currently this implementation only supports fully joined graphs.
- *
- * References:
- * https://en.wikipedia.org/wiki/Breadth-first_search
- * https://www.geeksforgeeks.org/breadth-first-search-or-bfs-for-a-graph/
+ * @details The components are found by connected_components, and each is copied to its own graph, keeping the
+ * ascending order of its vertices. Components then follow the start vertex's component in order of their lowest
+ * vertex. A connected graph is ordered directly, without a copy.
  */
-[[nodiscard]] std::vector<std::size_t> breadth_first(const Adjacency_Graph<false>& graph, std::size_t start_vertex) {
+template<class _ordering>
+std::vector<std::size_t> order_by_component(const Adjacency_Graph<false>& graph, const std::size_t start_vertex,
+                                            const _ordering& ordering) {
+  std::vector<std::size_t> component;
+  const std::size_t number_component = connected_components(graph, component);
+  if(number_component <= 1) return ordering(graph, start_vertex);
 
-  // Checking
-  if(graph.empty()) return {};
-  ASSERT_DEBUG(
-  start_vertex < graph.size_vertex(),
-  "New root, " + std::to_string(start_vertex) + " no in graph range [0, " + std::to_string(graph.size_vertex()) + ").");
+  // Group the vertices by component, ascending within each, recording their index within the component.
+  std::vector<std::size_t> component_offset(number_component + 1, 0);
+  FOR_EACH(i_component, component) ++component_offset[i_component + 1];
+  std::partial_sum(component_offset.begin(), component_offset.end(), component_offset.begin());
+  std::vector<std::size_t> component_vertex(graph.size_vertex());
+  std::vector<std::size_t> i_component_local(graph.size_vertex());
+  std::vector<std::size_t> position(component_offset.begin(), component_offset.end() - 1);
+  FOR(i_vertex, graph.size_vertex()) {
+    const std::size_t i_component = component[i_vertex];
+    i_component_local[i_vertex] = position[i_component] - component_offset[i_component];
+    component_vertex[position[i_component]++] = i_vertex;
+  }
+
+  // Number the start vertex's component first.
+  const std::size_t i_start_component = start_vertex < graph.size_vertex() ? component[start_vertex] : 0;
+  std::vector<std::size_t> new_offset(number_component);
+  std::size_t offset = component_offset[i_start_component + 1] - component_offset[i_start_component];
+  new_offset[i_start_component] = 0;
+  FOR(i_component, number_component) {
+    if(i_component == i_start_component) continue;
+    new_offset[i_component] = offset;
+    offset += component_offset[i_component + 1] - component_offset[i_component];
+  }
+
+  std::vector<std::size_t> permutation(graph.size_vertex());
+  parallel_for(
+  number_component,
+  [&](const std::size_t i_component) {
+    const std::span<const std::size_t> vertex(component_vertex.data() + component_offset[i_component],
+                                              component_offset[i_component + 1] - component_offset[i_component]);
+    if(vertex.size() == 1) {
+      permutation[vertex.front()] = new_offset[i_component];
+      return;
+    }
+    std::vector<std::size_t> vertex_offset(1, 0);
+    std::vector<std::size_t> vertex_adjacency;
+    FOR_EACH(i_vertex, vertex) {
+      FOR_EACH(i_adjacent, graph[i_vertex]) vertex_adjacency.push_back(i_component_local[i_adjacent]);
+      vertex_offset.push_back(vertex_adjacency.size());
+    }
+    const Adjacency_Graph<false> component_graph(vertex_offset, vertex_adjacency);
+    const std::size_t i_start = i_component == i_start_component && start_vertex < graph.size_vertex() ?
+                                i_component_local[start_vertex] :
+                                std::numeric_limits<std::size_t>::max();
+    const std::vector<std::size_t> component_permutation = ordering(component_graph, i_start);
+    FOR(i_local, vertex.size()) permutation[vertex[i_local]] = new_offset[i_component] + component_permutation[i_local];
+  },
+  1);
+  return permutation;
+}
+
+/**
+ * @brief Constructs the breadth first permutation of a connected graph, see breadth_first.
+ * @param[in] graph The connected graph to reorder.
+ * @param[in] start_vertex The starting vertex.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+inline std::vector<std::size_t> breadth_first_component(const Adjacency_Graph<false>& graph,
+                                                        const std::size_t start_vertex) {
+
+  // Traverse, then number the vertices in visit order.
+  std::vector<std::size_t> level(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+  level[start_vertex] = 0;
+  const std::vector<std::size_t> order = breadth_first_frontier(graph, {start_vertex}, level);
+  ASSERT(order.size() == graph.size_vertex(), "Graph disjointed, queue emptied before all vertices had been visited.");
+
+  std::vector<std::size_t> permutation(graph.size_vertex());
+  parallel_for(order.size(), [&](const std::size_t i_new) { permutation[order[i_new]] = i_new; });
+  return permutation;
+}
+
+/**
+ * @brief Constructs the Cuthill-McKee permutation of a connected graph, see cuthill_mckee.
+ * @param[in] graph The connected graph to reorder.
+ * @param[in] start_vertex The starting vertex, max() to start from a minimum degree vertex.
+ * @return The permutation vector mapping the old to new graph, i.e. new_index = permutation[old_index].
+ */
+inline std::vector<std::size_t> cuthill_mckee_component(const Adjacency_Graph<false>& graph, std::size_t start_vertex) {
 
   // Setup
   std::size_t new_index = 0;
@@ -61,7 +143,17 @@ namespace Disa {
   std::vector<bool> visited(graph.size_vertex(), false);
   std::vector<std::size_t> permutation(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
 
-  // record first vertex
+  // Find first vertex if required.
+  if(start_vertex == std::numeric_limits<std::size_t>::max()) {
+    std::size_t minimum_degree = std::numeric_limits<std::size_t>::max();
+    FOR(i_vertex, graph.size_vertex())
+    if(minimum_degree > graph.degree(i_vertex)) {
+      start_vertex = i_vertex;
+      minimum_degree = graph.degree(i_vertex);
+      ASSERT_DEBUG(static_cast<bool>(minimum_degree), "Graph is disjoint, vertex with zero degree found.");
+    }
+    ASSERT(start_vertex != std::numeric_limits<std::size_t>::max(), "Could not find a vertex with a minimum degree.");
+  }
   queue.push(start_vertex);
   visited[start_vertex] = true;
 
@@ -72,17 +164,54 @@ namespace Disa {
     queue.pop();
 
     // Loop over neighbours and push unvisited vertices onto the queue.
+    std::vector<std::pair<std::size_t, std::size_t>> vertex_adjacent_degree;
     FOR_EACH(vertex, vertex_adjacency) {
       if(!visited[vertex]) {
         visited[vertex] = true;
-        queue.push(vertex);
+        vertex_adjacent_degree.emplace_back(vertex, graph.degree(vertex));
       }
     }
+
+    // Sort and add to the queue.
+    if(!vertex_adjacent_degree.empty()) {
+      std::sort(vertex_adjacent_degree.begin(), vertex_adjacent_degree.end(),
+                [](const auto& pair_0, const auto& pair_1) { return pair_0.second < pair_1.second; });
+      FOR_EACH(mappp, vertex_adjacent_degree) queue.push(mappp.first);
+    }
   }
   ASSERT(new_index == graph.size_vertex(), "Graph disjointed, queue emptied before all vertices had been visited.");
   return permutation;
 }
 
+/**
+ * @details The algorithm reorders the graph through an 'advancing front' or 'level-set' of unvisited vertices which are
+ * adjacent to those already visited, each vertex is numbered in the order it is visited. The traversal itself is the
+ * level synchronous, direction optimising, breadth first search of breadth_first_frontier, which visits vertices in
+ * exactly the order of the classic 'first-in first-out' queue based approach (two links below), so the permutation is
+ * independent of the number of threads.
+ *
+ * Perhaps some minor differences to note:
+ * 1. We are not doing a search here, all vertices are visited. Hence the removal of the 'search' term in the name.
+ * 2. A disjoint graph is ordered component by component, see order_by_component, starting with that of start_vertex.
+ *
+ * References:
+ * https://en.wikipedia.org/wiki/Breadth-first_search
+ * https://www.geeksforgeeks.org/breadth-first-search-or-bfs-for-a-graph/
+ */
+[[nodiscard]] std::vector<std::size_t> breadth_first(const Adjacency_Graph<false>& graph, std::size_t start_vertex) {
+
+  // Checking
+  if(graph.empty()) return {};
+  ASSERT_DEBUG(
+  start_vertex < graph.size_vertex(),
+  "New root, " + std::to_string(start_vertex) + " no in graph range [0, " + std::to_string(graph.size_vertex()) + ").");
+
+  const auto ordering = [](const Adjacency_Graph<false>& component_graph, const std::size_t i_start) {
+    return breadth_first_component(component_graph, i_start < component_graph.size_vertex() ? i_start : 0);
+  };
+  return order_by_component(graph, start_vertex, ordering);
+}
+
 /**
  * @details Similar to the BFS algorithm this function implements a queue based Cuthill McKee (CMK) method. As with
  * other level-set orderings an 'advancing front' of unvisited vertices are created and updated around the already
@@ -90,7 +219,8 @@ namespace Disa {
  * by looking for a/the vertex with the lowest degree in the graph. Technically, this should be a periphery vertex, but
  * this implementation does not check for this. Similarly, no errors will be thrown should the user parse a vertex index
  * that is neither the lowest degree nor that is non-periphery. Finally the queue itself is added to in a manner that
- * 'new vertices' are sorted from lowest to highest degree before being placed in the queue.
+ * 'new vertices' are sorted from lowest to highest degree before being placed in the queue. A disjoint graph is ordered
+ * component by component, see order_by_component, each from its own start vertex.
  *
  * References:
  * https://en.wikipedia.org/wiki/Cuthill%E2%80%93McKee_algorithm
@@ -103,63 +233,557 @@ std::vector<std::size_t> cuthill_mckee(const Adjacency_Graph<false>& graph, std:
   start_vertex < graph.size_vertex() or start_vertex == std::numeric_limits<std::size_t>::max(),
   "New root, " + std::to_string(start_vertex) + " no in graph range [0, " + std::to_string(graph.size_vertex()) + ").");
 
-  // Setup
+  return order_by_component(graph, start_vertex, cuthill_mckee_component);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fill Reducing Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details Minimum degree orderings simulate the elimination of the graph, at each step eliminating the vertex of
+ * least degree, i.e. the vertex creating the least fill. Rather than forming the (filled) elimination graphs, the
+ * elimination is represented by a quotient graph, of uneliminated variables and elements (eliminated vertices), which
+ * requires no more storage than the original graph. Each variable, i, is adjacent to a set of variables, A_i, and
+ * elements, E_i, while each element, e, holds the set of variables, L_e, which form a clique in the elimination graph.
+ * For each step of the algorithm:
+ *
+ * 1. The variable, p, of least (approximate) degree is chosen as the pivot and numbered. Its adjacent elements are
+ *    absorbed into p, which becomes a new element, L_p = A_p U {L_e : e in E_p} \ p.
+ * 2. For each element, e, adjacent to L_p the external size, w(e) = |L_e \ L_p|, is computed. Elements with w(e) = 0
+ *    are entirely covered by p, and are (aggressively) absorbed.
+ * 3. For each variable, i, in L_p, A_i and E_i are pruned, p is added to E_i, and the approximate external degree is
+ *    computed as min(n - k, d_i + |L_p \ i|, |A_i \ i| + |L_p \ i| + sum_e w(e)), an upper bound to the exact degree.
+ * 4. Indistinguishable variables, those with identical A and E sets, are detected by hashing and merged into a single
+ *    supervariable, which are subsequently eliminated together (mass elimination).
+ *
+ * All set sizes are weighted by the number of vertices in each supervariable. Since the algorithm only ever considers
+ * vertices, disjoint graphs are ordered without any special treatment.
+ *
+ * References:
+ * Amestoy, P. R., Davis, T. A., & Duff, I. S. (1996). An approximate minimum degree ordering algorithm. SIAM Journal on
+ * Matrix Analysis and Applications, 17(4), 886-905.
+ */
+std::vector<std::size_t> approximate_minimum_degree(const Adjacency_Graph<false>& graph) {
+
+  // Checking
+  if(graph.empty()) return {};
+
+  enum class State : char { variable, element, absorbed };
+  const std::size_t size = graph.size_vertex();
+  constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+  // Quotient graph.
+  std::vector<State> state(size, State::variable);
+  std::vector<std::vector<std::size_t>> variable_adjacent(size);  // A_i
+  std::vector<std::vector<std::size_t>> element_adjacent(size);   // E_i
+  std::vector<std::vector<std::size_t>> element_variable(size);   // L_e
+  std::vector<std::vector<std::size_t>> member(size);             // Vertices merged into each supervariable.
+  std::vector<std::size_t> weight(size, 1);
+  std::vector<std::size_t> element_weight(size, 0);
+  std::vector<std::size_t> degree(size);
+  std::vector<std::size_t> hash(size);
+
+  // Degree lists, doubly linked.
+  std::vector<std::size_t> head(size, none);
+  std::vector<std::size_t> next(size, none);
+  std::vector<std::size_t> previous(size, none);
+  const auto insert = [&](const std::size_t i_vertex) {
+    next[i_vertex] = head[degree[i_vertex]];
+    previous[i_vertex] = none;
+    if(next[i_vertex] != none) previous[next[i_vertex]] = i_vertex;
+    head[degree[i_vertex]] = i_vertex;
+  };
+  const auto remove = [&](const std::size_t i_vertex) {
+    if(previous[i_vertex] != none) next[previous[i_vertex]] = next[i_vertex];
+    else head[degree[i_vertex]] = next[i_vertex];
+    if(next[i_vertex] != none) previous[next[i_vertex]] = previous[i_vertex];
+  };
+
+  FOR(i_vertex, size) {
+    const std::span<const std::size_t> adjacency = graph[i_vertex];
+    variable_adjacent[i_vertex].assign(adjacency.begin(), adjacency.end());
+    degree[i_vertex] = adjacency.size();
+    insert(i_vertex);
+  }
+
   std::size_t new_index = 0;
-  std::queue<std::size_t> queue;
-  std::vector<bool> visited(graph.size_vertex(), false);
-  std::vector<std::size_t> permutation(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+  std::size_t eliminated = 0;
+  std::size_t minimum_degree = 0;
+  std::size_t stamp = 0;
+  std::vector<std::size_t> mark(size, 0);
+  std::vector<std::size_t> element_mark(size, 0);
+  std::vector<std::size_t> external(size, 0);
+  std::vector<std::size_t> pivot_variable;
+  std::vector<std::size_t> permutation(size, none);
 
-  // Find first vertex if required.
-  if(start_vertex == std::numeric_limits<std::size_t>::max()) {
-    std::size_t minimum_degree = std::numeric_limits<std::size_t>::max();
-    FOR(i_vertex, graph.size_vertex())
-    if(minimum_degree > graph.degree(i_vertex)) {
-      start_vertex = i_vertex;
-      minimum_degree = graph.degree(i_vertex);
-      ASSERT_DEBUG(static_cast<bool>(minimum_degree), "Graph is disjoint, vertex with zero degree found.");
+  while(eliminated < size) {
+
+    // Select and number the pivot (super)variable.
+    while(head[minimum_degree] == none) ++minimum_degree;
+    const std::size_t i_pivot = head[minimum_degree];
+    remove(i_pivot);
+    permutation[i_pivot] = new_index++;
+    FOR_EACH(i_member, member[i_pivot]) permutation[i_member] = new_index++;
+    eliminated += weight[i_pivot];
+
+    // Form the new element, absorbing the adjacent elements.
+    ++stamp;
+    mark[i_pivot] = stamp;
+    pivot_variable.clear();
+    FOR_EACH(i_element, element_adjacent[i_pivot]) {
+      if(state[i_element] != State::element) continue;
+      FOR_EACH(i_variable, element_variable[i_element]) {
+        if(state[i_variable] == State::variable && mark[i_variable] != stamp) {
+          mark[i_variable] = stamp;
+          pivot_variable.push_back(i_variable);
+        }
+      }
+      state[i_element] = State::absorbed;
+      std::vector<std::size_t>().swap(element_variable[i_element]);
+    }
+    FOR_EACH(i_variable, variable_adjacent[i_pivot]) {
+      if(state[i_variable] == State::variable && mark[i_variable] != stamp) {
+        mark[i_variable] = stamp;
+        pivot_variable.push_back(i_variable);
+      }
+    }
+    state[i_pivot] = State::element;
+    std::vector<std::size_t>().swap(element_adjacent[i_pivot]);
+    std::vector<std::size_t>().swap(variable_adjacent[i_pivot]);
+
+    // External element sizes, w(e) = |L_e \ L_p|.
+    std::size_t pivot_weight = 0;
+    FOR_EACH(i_variable, pivot_variable) {
+      remove(i_variable);
+      pivot_weight += weight[i_variable];
+      FOR_EACH(i_element, element_adjacent[i_variable]) {
+        if(state[i_element] != State::element) continue;
+        if(element_mark[i_element] != stamp) {
+          element_mark[i_element] = stamp;
+          external[i_element] = element_weight[i_element];
+        }
+        external[i_element] -= weight[i_variable];
+      }
+    }
+
+    // Prune the adjacency of each variable in L_p and compute the approximate degrees.
+    FOR_EACH(i_variable, pivot_variable) {
+      std::vector<std::size_t>& elements = element_adjacent[i_variable];
+      std::size_t external_weight = 0;
+      hash[i_variable] = i_pivot;
+      elements.erase(std::remove_if(elements.begin(), elements.end(),
+                                    [&](const std::size_t i_element) {
+                                      if(state[i_element] != State::element) return true;
+                                      if(external[i_element] == 0) {
+                                        state[i_element] = State::absorbed;
+                                        std::vector<std::size_t>().swap(element_variable[i_element]);
+                                        return true;
+                                      }
+                                      external_weight += external[i_element];
+                                      hash[i_variable] += i_element;
+                                      return false;
+                                    }),
+                     elements.end());
+      elements.push_back(i_pivot);
+
+      std::vector<std::size_t>& variables = variable_adjacent[i_variable];
+      std::size_t variable_weight = 0;
+      variables.erase(std::remove_if(variables.begin(), variables.end(),
+                                     [&](const std::size_t i_adjacent) {
+                                       if(state[i_adjacent] != State::variable || mark[i_adjacent] == stamp)
+                                         return true;
+                                       variable_weight += weight[i_adjacent];
+                                       hash[i_variable] += i_adjacent;
+                                       return false;
+                                     }),
+                      variables.end());
+
+      const std::size_t pivot_external = pivot_weight - weight[i_variable];
+      degree[i_variable] = std::min({size - eliminated - weight[i_variable], degree[i_variable] + pivot_external,
+                                     variable_weight + pivot_external + external_weight});
+    }
+
+    // Supervariable detection, merge variables with identical adjacency.
+    std::sort(pivot_variable.begin(), pivot_variable.end(), [&](const std::size_t i_first, const std::size_t i_second) {
+      return hash[i_first] != hash[i_second] ? hash[i_first] < hash[i_second] : i_first < i_second;
+    });
+    FOR(i_first, pivot_variable.size()) {
+      const std::size_t i_variable = pivot_variable[i_first];
+      if(state[i_variable] != State::variable) continue;
+      for(std::size_t i_second = i_first + 1;
+          i_second < pivot_variable.size() && hash[pivot_variable[i_second]] == hash[i_variable]; ++i_second) {
+        const std::size_t i_other = pivot_variable[i_second];
+        if(state[i_other] != State::variable) continue;
+        if(element_adjacent[i_variable].size() != element_adjacent[i_other].size() ||
+           variable_adjacent[i_variable].size() != variable_adjacent[i_other].size())
+          continue;
+        std::sort(element_adjacent[i_variable].begin(), element_adjacent[i_variable].end());
+        std::sort(element_adjacent[i_other].begin(), element_adjacent[i_other].end());
+        std::sort(variable_adjacent[i_variable].begin(), variable_adjacent[i_variable].end());
+        std::sort(variable_adjacent[i_other].begin(), variable_adjacent[i_other].end());
+        if(element_adjacent[i_variable] != element_adjacent[i_other] ||
+           variable_adjacent[i_variable] != variable_adjacent[i_other])
+          continue;
+        weight[i_variable] += weight[i_other];
+        degree[i_variable] -= std::min(degree[i_variable], weight[i_other]);
+        member[i_variable].push_back(i_other);
+        member[i_variable].insert(member[i_variable].end(), member[i_other].begin(), member[i_other].end());
+        weight[i_other] = 0;
+        state[i_other] = State::absorbed;
+        std::vector<std::size_t>().swap(member[i_other]);
+        std::vector<std::size_t>().swap(element_adjacent[i_other]);
+        std::vector<std::size_t>().swap(variable_adjacent[i_other]);
+      }
+    }
+
+    // Finalise the new element and reinsert its variables in the degree lists.
+    FOR_EACH(i_variable, pivot_variable) {
+      if(state[i_variable] != State::variable) continue;
+      degree[i_variable] = std::min(degree[i_variable], size - eliminated - weight[i_variable]);
+      insert(i_variable);
+      minimum_degree = std::min(minimum_degree, degree[i_variable]);
+      element_variable[i_pivot].push_back(i_variable);
+      element_weight[i_pivot] += weight[i_variable];
     }
-    ASSERT(start_vertex != std::numeric_limits<std::size_t>::max(), "Could not find a vertex with a minimum degree.");
   }
-  queue.push(start_vertex);
-  visited[start_vertex] = true;
 
-  while(!queue.empty()) {
-    // Get the next vertex from the queue
-    permutation[queue.front()] = new_index++;
-    std::span<const std::size_t> vertex_adjacency = graph[queue.front()];
-    queue.pop();
+  ASSERT(new_index == size, "Not all vertices were ordered, " + std::to_string(new_index) + " of " +
+                            std::to_string(size) + ".");
+  return permutation;
+}
 
-    // Loop over neighbours and push unvisited vertices onto the queue.
-    std::vector<std::pair<std::size_t, std::size_t>> vertex_adjacent_degree;
-    FOR_EACH(vertex, vertex_adjacency) {
-      if(!visited[vertex]) {
-        visited[vertex] = true;
-        vertex_adjacent_degree.emplace_back(vertex, graph.degree(vertex));
+/**
+ * @struct Induced_Graph
+ * @brief A compressed graph induced by a subset of the vertices of a parent graph, in the local indexing of the subset.
+ */
+struct Induced_Graph {
+  std::vector<std::size_t> offset;     //!< The offset into adjacency of each local vertex.
+  std::vector<std::size_t> adjacency;  //!< The local adjacent vertices of each local vertex.
+
+  [[nodiscard]] inline bool empty() const noexcept { return offset.size() < 2; };
+  [[nodiscard]] inline std::size_t size_vertex() const noexcept { return !offset.empty() ? offset.size() - 1 : 0; };
+  [[nodiscard]] inline std::size_t degree(const std::size_t i_vertex) const {
+    return offset[i_vertex + 1] - offset[i_vertex];
+  };
+  [[nodiscard]] inline std::span<const std::size_t> operator[](const std::size_t i_vertex) const {
+    return {adjacency.data() + offset[i_vertex], degree(i_vertex)};
+  };
+};
+
+/**
+ * @brief Splits a part of a graph, into two halves and a vertex separator, using a level-set bisection.
+ * @param[in] graph The graph.
+ * @param[in] vertex The (global) vertices of the part.
+ * @param[in] owner The part of every vertex in the graph.
+ * @param[in] i_part The part to split.
+ * @param[in,out] local Global to local map, only the entries of the part's vertices are written.
+ * @param[out] split The left, right and separator vertices, all are empty if the part could not be split.
+ *
+ * @details Disjoint parts are split by (whole) components into two halves with an empty separator. Otherwise a level
+ * traversal is performed from a pseudo peripheral vertex, and the level which most evenly divides the remaining levels
+ * is taken as the separator. Separator vertices with no neighbours in the right half do not separate anything, and are
+ * moved to the left.
+ */
+inline void level_set_separator(const Adjacency_Graph<false>& graph, const std::vector<std::size_t>& vertex,
+                                const std::vector<std::size_t>& owner, const std::size_t i_part,
+                                std::vector<std::size_t>& local, std::array<std::vector<std::size_t>, 3>& split) {
+
+  // Form the induced graph.
+  Induced_Graph induced;
+  FOR(i_local, vertex.size()) local[vertex[i_local]] = i_local;
+  induced.offset.reserve(vertex.size() + 1);
+  induced.offset.push_back(0);
+  FOR_EACH(i_global, vertex) {
+    FOR_EACH(i_adjacent, graph[i_global]) {
+      if(owner[i_adjacent] == i_part) induced.adjacency.push_back(local[i_adjacent]);
+    }
+    induced.offset.push_back(induced.adjacency.size());
+  }
+
+  // Label components, disjoint parts are split by component.
+  std::size_t number_component = 0;
+  std::vector<std::size_t> component(vertex.size(), std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> component_size;
+  std::vector<std::size_t> stack;
+  FOR(i_root, vertex.size()) {
+    if(component[i_root] != std::numeric_limits<std::size_t>::max()) continue;
+    component_size.push_back(1);
+    component[i_root] = number_component;
+    stack.push_back(i_root);
+    while(!stack.empty()) {
+      const std::size_t i_vertex = stack.back();
+      stack.pop_back();
+      FOR_EACH(i_adjacent, induced[i_vertex]) {
+        if(component[i_adjacent] != std::numeric_limits<std::size_t>::max()) continue;
+        component[i_adjacent] = number_component;
+        ++component_size[number_component];
+        stack.push_back(i_adjacent);
       }
     }
+    ++number_component;
+  }
+  if(number_component > 1) {
+    std::size_t i_split = 0;
+    for(std::size_t size_left = 0; 2 * size_left < vertex.size() && i_split < number_component - 1; ++i_split)
+      size_left += component_size[i_split];
+    FOR(i_local, vertex.size()) split[component[i_local] < i_split ? 0 : 1].push_back(vertex[i_local]);
+    return;
+  }
 
-    // Sort and add to the queue.
-    if(!vertex_adjacent_degree.empty()) {
-      std::sort(vertex_adjacent_degree.begin(), vertex_adjacent_degree.end(),
-                [](const auto& pair_0, const auto& pair_1) { return pair_0.second < pair_1.second; });
-      FOR_EACH(mappp, vertex_adjacent_degree) queue.push(mappp.first);
+  // Level-set split.
+  const std::vector<std::size_t> level = level_traversal(induced, pseudo_peripheral_vertex(induced));
+  const std::size_t max_level = *std::max_element(level.begin(), level.end());
+  if(max_level < 2) return;
+  std::vector<std::size_t> level_count(max_level + 2, 0);
+  FOR_EACH(i_level, level) ++level_count[i_level + 1];
+  std::partial_sum(level_count.begin(), level_count.end(), level_count.begin());
+  std::size_t separator_level = 1;
+  std::size_t imbalance = std::numeric_limits<std::size_t>::max();
+  FOR(i_level, 1, max_level) {
+    const std::size_t below = level_count[i_level];
+    const std::size_t above = vertex.size() - level_count[i_level + 1];
+    if(std::max(below, above) - std::min(below, above) < imbalance) {
+      imbalance = std::max(below, above) - std::min(below, above);
+      separator_level = i_level;
     }
   }
-  ASSERT(new_index == graph.size_vertex(), "Graph disjointed, queue emptied before all vertices had been visited.");
+
+  FOR(i_local, vertex.size()) {
+    if(level[i_local] < separator_level) split[0].push_back(vertex[i_local]);
+    else if(level[i_local] > separator_level) split[1].push_back(vertex[i_local]);
+    else if(std::any_of(induced[i_local].begin(), induced[i_local].end(), [&](const std::size_t i_adjacent) {
+              return level[i_adjacent] > separator_level;
+            }))
+      split[2].push_back(vertex[i_local]);
+    else split[0].push_back(vertex[i_local]);
+  }
+}
+
+/**
+ * @details Nested dissection recursively splits the graph into two independent halves and a vertex separator, which is
+ * numbered after both halves. Since no edge connects the halves, no fill can occur between them, and the fill is
+ * confined to the separators (and within the leaves). Separators are found with the level-set bisection also used by
+ * recursive_graph_bisection, refined such that only vertices adjacent to both halves are retained.
+ *
+ * The dissection proceeds level by level through the separator tree, with all parts of a level being split in parallel.
+ * As the new indices of each part are fixed by the sizes of the halves and separator, the result does not depend on
+ * the number of threads. Leaves retain the (relative) order of their vertices.
+ *
+ * References:
+ * George, A. (1973). Nested dissection of a regular finite element mesh. SIAM Journal on Numerical Analysis, 10(2),
+ * 345-363.
+ */
+std::vector<std::size_t> nested_dissection(const Adjacency_Graph<false>& graph, Separator_Tree& separator_tree,
+                                           const std::size_t leaf_size) {
+
+  // Checking
+  separator_tree.node.clear();
+  if(graph.empty()) return {};
+
+  // Setup
+  const std::size_t size = graph.size_vertex();
+  std::vector<std::size_t> permutation(size, std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> owner(size, 0);
+  std::vector<std::size_t> local(size);
+  std::vector<std::vector<std::size_t>> part_vertex(1, std::vector<std::size_t>(size));
+  std::iota(part_vertex[0].begin(), part_vertex[0].end(), 0);
+  std::vector<std::size_t> part_node(1, 0);
+  separator_tree.node.push_back({std::numeric_limits<std::size_t>::max(), std::numeric_limits<std::size_t>::max(),
+                                 std::numeric_limits<std::size_t>::max(), 0, 0, size});
+
+  std::vector<std::vector<std::size_t>> next_part_vertex;
+  std::vector<std::size_t> next_part_node;
+  while(!part_vertex.empty()) {
+
+    // Split all parts of this level in parallel.
+    std::vector<std::array<std::vector<std::size_t>, 3>> split(part_vertex.size());
+    parallel_for(
+    part_vertex.size(),
+    [&](const std::size_t i_part) {
+      if(part_vertex[i_part].size() > leaf_size)
+        level_set_separator(graph, part_vertex[i_part], owner, i_part, local, split[i_part]);
+    },
+    1);
+
+    // Number separators and leaves, and create the next level of parts.
+    next_part_vertex.clear();
+    next_part_node.clear();
+    FOR(i_part, part_vertex.size()) {
+      const std::size_t i_node = part_node[i_part];
+      auto& [left, right, separator] = split[i_part];
+      if(left.empty()) {
+        separator_tree.node[i_node].separator = separator_tree.node[i_node].begin;
+        FOR(i_vertex, part_vertex[i_part].size()) {
+          permutation[part_vertex[i_part][i_vertex]] = separator_tree.node[i_node].begin + i_vertex;
+          owner[part_vertex[i_part][i_vertex]] = std::numeric_limits<std::size_t>::max();
+        }
+        continue;
+      }
+
+      const std::size_t begin = separator_tree.node[i_node].begin;
+      const std::size_t end = separator_tree.node[i_node].end;
+      separator_tree.node[i_node].separator = end - separator.size();
+      separator_tree.node[i_node].child_left = separator_tree.node.size();
+      separator_tree.node[i_node].child_right = separator_tree.node.size() + 1;
+      separator_tree.node.push_back({i_node, std::numeric_limits<std::size_t>::max(),
+                                     std::numeric_limits<std::size_t>::max(), begin, begin, begin + left.size()});
+      separator_tree.node.push_back({i_node, std::numeric_limits<std::size_t>::max(),
+                                     std::numeric_limits<std::size_t>::max(), begin + left.size(),
+                                     begin + left.size(), begin + left.size() + right.size()});
+      FOR(i_vertex, separator.size()) {
+        permutation[separator[i_vertex]] = end - separator.size() + i_vertex;
+        owner[separator[i_vertex]] = std::numeric_limits<std::size_t>::max();
+      }
+      next_part_node.push_back(separator_tree.node[i_node].child_left);
+      next_part_node.push_back(separator_tree.node[i_node].child_right);
+      next_part_vertex.push_back(std::move(left));
+      next_part_vertex.push_back(std::move(right));
+    }
+    FOR(i_part, next_part_vertex.size()) FOR_EACH(i_vertex, next_part_vertex[i_part]) owner[i_vertex] = i_part;
+    std::swap(part_vertex, next_part_vertex);
+    std::swap(part_node, next_part_node);
+  }
   return permutation;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Geometric Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Converts quantised axis coordinates to the 'transposed' Hilbert index, in place.
+ * @param[in, out] axis The quantised coordinates, on exit the Hilbert index with its bits transposed across the axes.
+ * @param[in] bits The number of bits used per axis.
+ *
+ * @details Follows J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 381 (2004). The transposed form
+ * stores bit b of the index for axis d in bit b of axis[d], interleaving then recovers the scalar index.
+ */
+template<std::size_t _dimension>
+inline void hilbert_transpose(std::array<std::uint64_t, _dimension>& axis, const std::size_t bits) {
+  const std::uint64_t high_bit = std::uint64_t(1) << (bits - 1);
+
+  // Inverse undo excess work.
+  for(std::uint64_t q_bit = high_bit; q_bit > 1; q_bit >>= 1) {
+    const std::uint64_t mask = q_bit - 1;
+    FOR(i_axis, _dimension) {
+      if(axis[i_axis] & q_bit) axis[0] ^= mask;
+      else {
+        const std::uint64_t swap = (axis[0] ^ axis[i_axis]) & mask;
+        axis[0] ^= swap;
+        axis[i_axis] ^= swap;
+      }
+    }
+  }
+
+  // Gray encode.
+  FOR(i_axis, 1, _dimension) axis[i_axis] ^= axis[i_axis - 1];
+  std::uint64_t flip = 0;
+  for(std::uint64_t q_bit = high_bit; q_bit > 1; q_bit >>= 1)
+    if(axis[_dimension - 1] & q_bit) flip ^= q_bit - 1;
+  FOR_EACH_REF(value, axis) value ^= flip;
+}
+
+/**
+ * @details Coordinates are first quantised onto a 2^b grid per axis, with b = 32 in 2D and 21 in 3D so that the key
+ * fits 64 bits, using a single scale for all axes so the aspect ratio of the domain is preserved. For the Morton curve
+ * the quantised coordinates are bit interleaved directly, for the Hilbert curve they are first transformed with
+ * Skilling's algorithm. Keys are independent, so they are computed in parallel.
+ */
+template<std::size_t _dimension>
+std::vector<std::uint64_t> space_filling_curve_key(const std::vector<Vector_Dense<Scalar, _dimension>>& coordinate,
+                                                   const Curve_Type curve) {
+  static_assert(_dimension == 2 || _dimension == 3, "Space filling curves are only supported in 2D and 3D.");
+  constexpr std::size_t bits = 64 / _dimension;
+  constexpr Scalar max_quantised = static_cast<Scalar>((std::uint64_t(1) << bits) - 1);
+
+  if(coordinate.empty()) return {};
+
+  // Bounding box, and a single scale for all axes.
+  Vector_Dense<Scalar, _dimension> minimum = coordinate.front();
+  Vector_Dense<Scalar, _dimension> maximum = coordinate.front();
+  FOR_EACH(point, coordinate) {
+    FOR(i_axis, _dimension) {
+      minimum[i_axis] = std::min(minimum[i_axis], point[i_axis]);
+      maximum[i_axis] = std::max(maximum[i_axis], point[i_axis]);
+    }
+  }
+  Scalar extent = 0;
+  FOR(i_axis, _dimension) extent = std::max(extent, maximum[i_axis] - minimum[i_axis]);
+  const Scalar scale = extent > 0 ? max_quantised / extent : 0;
+
+  std::vector<std::uint64_t> key(coordinate.size());
+  parallel_for(coordinate.size(), [&](const std::size_t i_vertex) {
+    std::array<std::uint64_t, _dimension> axis;
+    FOR(i_axis, _dimension) {
+      const Scalar quantised = (coordinate[i_vertex][i_axis] - minimum[i_axis]) * scale;
+      axis[i_axis] = static_cast<std::uint64_t>(std::clamp(quantised, Scalar(0), max_quantised));
+    }
+    if(curve == Curve_Type::hilbert) hilbert_transpose(axis, bits);
+
+    // Interleave, most significant bit first, axis 0 leading.
+    std::uint64_t value = 0;
+    for(std::size_t i_bit = bits; i_bit-- > 0;)
+      FOR(i_axis, _dimension) value = (value << 1) | ((axis[i_axis] >> i_bit) & 1);
+    key[i_vertex] = value;
+  });
+  return key;
+}
+
+/**
+ * @details Vertices are sorted by their curve key, ties (coincident or near coincident points) are broken by the
+ * original index so the ordering is deterministic.
+ */
+template<std::size_t _dimension>
+std::vector<std::size_t> space_filling_curve(const std::vector<Vector_Dense<Scalar, _dimension>>& coordinate,
+                                             const Curve_Type curve) {
+  const std::vector<std::uint64_t> key = space_filling_curve_key(coordinate, curve);
+  std::vector<std::size_t> order(coordinate.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](const std::size_t i_vertex_0, const std::size_t i_vertex_1) {
+    return key[i_vertex_0] < key[i_vertex_1] || (key[i_vertex_0] == key[i_vertex_1] && i_vertex_0 < i_vertex_1);
+  });
+
+  std::vector<std::size_t> permutation(coordinate.size());
+  FOR(i_new, order.size()) permutation[order[i_new]] = i_new;
+  return permutation;
+}
+
+template std::vector<std::uint64_t> space_filling_curve_key(const std::vector<Vector_Dense<Scalar, 2>>&, Curve_Type);
+template std::vector<std::uint64_t> space_filling_curve_key(const std::vector<Vector_Dense<Scalar, 3>>&, Curve_Type);
+template std::vector<std::size_t> space_filling_curve(const std::vector<Vector_Dense<Scalar, 2>>&, Curve_Type);
+template std::vector<std::size_t> space_filling_curve(const std::vector<Vector_Dense<Scalar, 3>>&, Curve_Type);
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Multicolor Ordering
 // ---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Finds the lowest colour not used by any coloured neighbour of a vertex.
+ * @param[in] graph The graph being coloured.
+ * @param[in] i_vertex The vertex to colour.
+ * @param[in] colour The colour of each vertex, std::numeric_limits<std::size_t>::max() if not yet coloured.
+ * @param[in, out] forbidden Working vector, marking the colours of the neighbours with the vertex index. Must be
+ *                           reused between calls for distinct vertices, or be empty.
+ * @return The lowest free colour, at most the degree of the vertex.
+ */
+inline std::size_t first_free_colour(const Adjacency_Graph<false>& graph, const std::size_t i_vertex,
+                                     const std::vector<std::size_t>& colour, std::vector<std::size_t>& forbidden) {
+  const auto adjacent = graph[i_vertex];
+  if(forbidden.size() <= adjacent.size())
+    forbidden.resize(adjacent.size() + 1, std::numeric_limits<std::size_t>::max());
+  FOR_EACH(i_adjacent, adjacent) if(colour[i_adjacent] < forbidden.size()) forbidden[colour[i_adjacent]] = i_vertex;
+  std::size_t i_colour = 0;
+  while(forbidden[i_colour] == i_vertex) ++i_colour;
+  return i_colour;
+}
+
 /**
  * @details A greedy method for multicolouring (sometimes just colouring) of a graph. First, the vertices in the graph
- * are iterated through. At each iteration a vertex is coloured by finding the first/lowest unique colour not present in
- * the colours of adjacent vertices. Here the colours are represented by positive integers, with zero representing
- * unassigned. Once all vertices have been colour the permutation vector is creating by looping over the colours and
- * adding any vertices of that colour to the vector. Note: this means that the resulting permutation is essentially
- * sorted first by colour, and then by vertex index (of the original graph).
+ * are iterated through. At each iteration a vertex is coloured with the lowest colour not present in the colours of
+ * adjacent vertices, found in O(degree) by marking the adjacent colours. Once all vertices have been coloured the
+ * permutation vector is created by a counting sort of the colours, see colour_permutation. Note: this means that the
+ * resulting permutation is essentially sorted first by colour, and then by vertex index (of the original graph).
  *
  * References:
  * https://en.wikipedia.org/wiki/Greedy_coloring#
@@ -170,49 +794,334 @@ std::vector<std::size_t> greedy_multicolouring(const Adjacency_Graph<false>& gra
   // Checking
   if(graph.empty()) return {};
 
-  // Setup initial variables
-  std::size_t max_color = 0;
-  std::vector<std::size_t> permutation(graph.size_vertex());
-  std::vector<std::size_t> colour(graph.size_vertex(), 0);
-  std::vector<std::size_t> adjacent_color;
+  std::vector<std::size_t> colour(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> forbidden;
+  FOR(i_vertex, graph.size_vertex()) colour[i_vertex] = first_free_colour(graph, i_vertex, colour, forbidden);
+  return colour_permutation(colour);
+}
 
-  FOR(i_vertex, graph.size_vertex()) {
+/**
+ * @brief Evens the sizes of the colours of a colouring, without adding colours.
+ * @param[in] graph The coloured graph.
+ * @param[in, out] colour The colour of each vertex, on exit rebalanced.
+ *
+ * @details Each colour larger than the average, rounded up, is visited in turn, and its vertices moved to the lowest
+ * colour that is below the average and not used by any of their neighbours. The vertices of one colour are not
+ * adjacent, so their moves never conflict, and each vertex finds its new colour in parallel. The moves are then made
+ * in vertex order while the new colours have room, vertices finding their colour full trying again, so the result is
+ * independent of the number of threads. A vertex is left in place if no colour can take it.
+ *
+ * Reference: Lu, H., et al. (2017). Algorithms for balanced graph colorings with applications in parallel computing.
+ * IEEE Transactions on Parallel and Distributed Systems, 28(5), 1240-1256.
+ */
+inline void balance_colouring(const Adjacency_Graph<false>& graph, std::vector<std::size_t>& colour) {
+  const std::size_t number_colour = *std::max_element(colour.begin(), colour.end()) + 1;
+  const std::size_t target_size = (colour.size() + number_colour - 1) / number_colour;
+
+  // Bucket the vertices by colour.
+  std::vector<std::size_t> colour_offset(number_colour + 1, 0);
+  FOR_EACH(i_colour, colour) ++colour_offset[i_colour + 1];
+  std::partial_sum(colour_offset.begin(), colour_offset.end(), colour_offset.begin());
+  std::vector<std::size_t> colour_size(number_colour);
+  FOR(i_colour, number_colour) colour_size[i_colour] = colour_offset[i_colour + 1] - colour_offset[i_colour];
+  std::vector<std::size_t> colour_vertex(colour.size());
+  std::vector<std::size_t> position(colour_offset.begin(), colour_offset.end() - 1);
+  FOR(i_vertex, colour.size()) colour_vertex[position[colour[i_vertex]]++] = i_vertex;
+
+  std::vector<std::size_t> candidate;
+  std::vector<std::size_t> candidate_colour;
+  FOR(i_colour, number_colour) {
+    if(colour_size[i_colour] <= target_size) continue;
+    candidate.assign(colour_vertex.begin() + static_cast<s_size_t>(colour_offset[i_colour]),
+                     colour_vertex.begin() + static_cast<s_size_t>(colour_offset[i_colour + 1]));
+    while(!candidate.empty()) {
 
-    // Fetch and sort the colours of the adjacency graph for the vertex.
-    adjacent_color.clear();
-    const auto adjacent = graph[i_vertex];
-    if(adjacent.size() > adjacent_color.capacity()) adjacent_color.reserve(adjacent.size());
-    FOR_EACH(i_adjacent, adjacent) if(colour[i_adjacent] != 0) adjacent_color.push_back(colour[i_adjacent]);
-    std::sort(adjacent_color.begin(), adjacent_color.end());
-
-    // If nothing is coloured assign colour 1 and continue (no need to search).
-    if(adjacent_color.empty()) {
-      colour[i_vertex] = 1;
-      continue;
-    }
-
-    // Search for the next color.
-    FOR(i_color, adjacent_color.size() - 1) {
-      const std::size_t& current = adjacent_color[i_color];
-      const std::size_t& next = adjacent_color[i_color + 1];
-      if(current != next and (current + 1) != next) {
-        colour[i_vertex] = adjacent_color[i_color] + 1;
-        break;
+      // Find each candidate's lowest under full colour, free of its neighbours.
+      candidate_colour.resize(candidate.size());
+      parallel_for_block(candidate.size(), [&](const std::size_t i_begin, const std::size_t i_end) {
+        std::vector<std::size_t> forbidden(number_colour, std::numeric_limits<std::size_t>::max());
+        FOR(i_candidate, i_begin, i_end) {
+          const std::size_t i_vertex = candidate[i_candidate];
+          FOR_EACH(i_adjacent, graph[i_vertex]) forbidden[colour[i_adjacent]] = i_vertex;
+          candidate_colour[i_candidate] = std::numeric_limits<std::size_t>::max();
+          FOR(i_new, number_colour) {
+            if(colour_size[i_new] < target_size && forbidden[i_new] != i_vertex) {
+              candidate_colour[i_candidate] = i_new;
+              break;
+            }
+          }
+        }
+      });
+
+      // Move in vertex order while there is room, retrying those whose colour filled.
+      std::size_t i_retry = 0;
+      FOR(i_candidate, candidate.size()) {
+        if(colour_size[i_colour] <= target_size) break;
+        const std::size_t i_new = candidate_colour[i_candidate];
+        if(i_new == std::numeric_limits<std::size_t>::max()) continue;
+        if(colour_size[i_new] < target_size) {
+          colour[candidate[i_candidate]] = i_new;
+          ++colour_size[i_new];
+          --colour_size[i_colour];
+        } else candidate[i_retry++] = candidate[i_candidate];
       }
+      candidate.resize(colour_size[i_colour] <= target_size ? 0 : i_retry);
     }
-    if(colour[i_vertex] == 0) colour[i_vertex] = adjacent_color.back() + 1;
-    max_color = std::max(max_color, colour[i_vertex]);
   }
+}
 
-  // Create permutation vector.
-  std::size_t new_index = 0;
-  FOR(i_colour, max_color + 1) {
-    FOR(i_vertex, colour.size()) {
-      if(colour[i_vertex] == i_colour) permutation[i_vertex] = new_index++;
-    }
+/**
+ * @details The Jones-Plassmann algorithm, each vertex is given a pseudo-random priority, a hash of its index, and the
+ * graph is coloured in rounds. In each round every uncoloured vertex whose priority exceeds that of all its uncoloured
+ * neighbours is selected, the selected vertices forming an independent set. Each selected vertex then takes the lowest
+ * colour free of its (previously coloured) neighbours, both steps running in parallel over the uncoloured vertices.
+ * The expected number of rounds is O(log(V) / log(log(V))) for bounded degree graphs. Since the priorities are fixed,
+ * the colouring is identical for any number of threads, and it uses at most max degree + 1 colours. Optionally the
+ * colours are then rebalanced, see balance_colouring.
+ *
+ * Reference: Jones, M. T., & Plassmann, P. E. (1993). A parallel graph coloring heuristic. SIAM Journal on Scientific
+ * Computing, 14(3), 654-669.
+ */
+std::vector<std::size_t> jones_plassmann_colouring(const Adjacency_Graph<false>& graph, const bool is_balanced) {
+  if(graph.empty()) return {};
+
+  // Random priorities, from the splitmix64 finaliser.
+  std::vector<std::uint64_t> priority(graph.size_vertex());
+  parallel_for(graph.size_vertex(), [&](const std::size_t i_vertex) {
+    std::uint64_t hash = static_cast<std::uint64_t>(i_vertex) + 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    priority[i_vertex] = hash ^ (hash >> 31);
+  });
+  const auto is_higher = [&](const std::size_t i_vertex, const std::size_t j_vertex) {
+    return priority[i_vertex] != priority[j_vertex] ? priority[i_vertex] > priority[j_vertex] : i_vertex > j_vertex;
+  };
+
+  std::vector<std::size_t> colour(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+  std::vector<std::uint8_t> is_selected(graph.size_vertex(), false);
+  std::vector<std::size_t> uncoloured(graph.size_vertex());
+  std::iota(uncoloured.begin(), uncoloured.end(), 0);
+  while(!uncoloured.empty()) {
+
+    // Select the local priority maxima among the uncoloured vertices.
+    parallel_for(uncoloured.size(), [&](const std::size_t i_index) {
+      const std::size_t i_vertex = uncoloured[i_index];
+      const auto adjacent = graph[i_vertex];
+      is_selected[i_vertex] = std::none_of(adjacent.begin(), adjacent.end(), [&](const std::size_t i_adjacent) {
+        return colour[i_adjacent] == std::numeric_limits<std::size_t>::max() && is_higher(i_adjacent, i_vertex);
+      });
+    });
+
+    // Colour them, no two being adjacent each only sees colours from previous rounds.
+    parallel_for_block(uncoloured.size(), [&](const std::size_t i_begin, const std::size_t i_end) {
+      std::vector<std::size_t> forbidden;
+      FOR(i_index, i_begin, i_end) {
+        const std::size_t i_vertex = uncoloured[i_index];
+        if(is_selected[i_vertex]) colour[i_vertex] = first_free_colour(graph, i_vertex, colour, forbidden);
+      }
+    });
+    std::erase_if(uncoloured, [&](const std::size_t i_vertex) { return is_selected[i_vertex]; });
   }
 
+  if(is_balanced) balance_colouring(graph, colour);
+  return colour;
+}
+
+/**
+ * @details Colours the graph with jones_plassmann_colouring and groups the vertices by colour with colour_permutation.
+ */
+std::vector<std::size_t> jones_plassmann_multicolouring(const Adjacency_Graph<false>& graph, const bool is_balanced) {
+  return colour_permutation(jones_plassmann_colouring(graph, is_balanced));
+}
+
+/**
+ * @details A counting sort, the colour sizes are counted and prefix summed into the first new index of each colour,
+ * after which the vertices are numbered in order within their colour. O(V + number of colours).
+ */
+std::vector<std::size_t> colour_permutation(const std::vector<std::size_t>& colour) {
+  if(colour.empty()) return {};
+  std::vector<std::size_t> colour_offset(*std::max_element(colour.begin(), colour.end()) + 2, 0);
+  FOR_EACH(i_colour, colour) ++colour_offset[i_colour + 1];
+  std::partial_sum(colour_offset.begin(), colour_offset.end(), colour_offset.begin());
+  std::vector<std::size_t> permutation(colour.size());
+  FOR(i_vertex, colour.size()) permutation[i_vertex] = colour_offset[colour[i_vertex]]++;
   return permutation;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Subgraph Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details Each vertex is classified in parallel, a primary vertex being boundary if any neighbour has a non-zero level.
+ * The vertices are then visited in the order of the given permutation and numbered consecutively within their class,
+ * a stable counting sort, so each class keeps the given ordering. O(V + E).
+ */
+Interior_Boundary_Split interior_boundary_split(const Adjacency_Subgraph& subgraph,
+                                                const std::vector<std::size_t>& permutation) {
+  const std::size_t size = subgraph.size_vertex();
+  ASSERT(permutation.empty() || permutation.size() == size,
+         "Permutation size " + std::to_string(permutation.size()) + " does not match the subgraph size " +
+         std::to_string(size) + ".");
+
+  // Classify, 0 interior, 1 boundary and 2 halo.
+  std::vector<std::size_t> vertex_class(size);
+  parallel_for(size, [&](const std::size_t i_vertex) {
+    if(subgraph.vertex_level(i_vertex) != 0) vertex_class[i_vertex] = 2;
+    else {
+      const auto adjacency = subgraph[i_vertex];
+      vertex_class[i_vertex] = std::any_of(adjacency.begin(), adjacency.end(), [&](const std::size_t i_adjacent) {
+        return subgraph.vertex_level(i_adjacent) != 0;
+      });
+    }
+  });
+
+  Interior_Boundary_Split split;
+  FOR_EACH(i_class, vertex_class) {
+    if(i_class == 0) ++split.size_interior;
+    else if(i_class == 1) ++split.size_boundary;
+    else ++split.size_halo;
+  }
+
+  // Number each class in the given order.
+  std::vector<std::size_t> order(size);
+  if(permutation.empty()) std::iota(order.begin(), order.end(), 0);
+  else FOR(i_old, size) order[permutation[i_old]] = i_old;
+  std::array<std::size_t, 3> class_offset = {0, split.size_interior, split.size_interior + split.size_boundary};
+  split.permutation.resize(size);
+  FOR_EACH(i_old, order) split.permutation[i_old] = class_offset[vertex_class[i_old]]++;
+  return split;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Ordering Metrics
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Computes the ordering metrics of any row-wise structure, shared by the graph and matrix overloads.
+ * @tparam _row_column Callable with signature void(std::size_t i_row, auto function), calling function(i_column) for
+ * each (old indexed) column of the row.
+ * @param[in] size The number of rows.
+ * @param[in] row_column The row column visitor.
+ * @param[in] permutation The candidate ordering, new_index = permutation[old_index]. Empty for the current ordering.
+ * @param[in] line_size The number of vector entries per cache line.
+ * @return The ordering metrics.
+ *
+ * @details Rows are visited in the new order, each thread taking a contiguous block of new rows and reducing into its
+ * own partial result. For the cache line estimate each row gathers the lines of its (new) columns and its diagonal, a
+ * gather is counted as reused if the line was already touched in the same row or in the previous row, i.e. a cache
+ * able to hold roughly two rows of the gathered vector.
+ */
+template<class _row_column>
+Ordering_Metrics ordering_metrics_rows(const std::size_t size, const _row_column& row_column,
+                                       const std::vector<std::size_t>& permutation, const std::size_t line_size) {
+  ASSERT(line_size > 0, "Cache line size must be greater than zero.");
+  ASSERT(permutation.empty() || permutation.size() == size, "Permutation size " + std::to_string(permutation.size()) +
+                                                            " does not match " + std::to_string(size) + ".");
+  if(size == 0) return {};
+
+  // Old to new and new to old maps, the identity if no permutation is given.
+  const bool is_identity = permutation.empty();
+  std::vector<std::size_t> old_index;
+  if(!is_identity) {
+    old_index.resize(size);
+    parallel_for(size, [&](const std::size_t i_old) { old_index[permutation[i_old]] = i_old; });
+  }
+
+  struct Partial {
+    std::size_t bandwidth = 0;
+    std::size_t profile = 0;
+    std::size_t distance = 0;
+    std::size_t off_diagonal = 0;
+    std::size_t reused = 0;
+    std::size_t gather = 0;
+  };
+  const std::size_t number_thread = std::min(parallel_thread_count(), std::max<std::size_t>(size / 1024, 1));
+  std::vector<Partial> partial(number_thread);
+  parallel_region(number_thread, [&](const std::size_t i_thread, const std::size_t number_thread) {
+    const auto [i_begin, i_end] = parallel_block(size, i_thread, number_thread);
+    Partial& result = partial[i_thread];
+    std::vector<std::size_t> line;
+    std::vector<std::size_t> line_previous;
+
+    // Gathers the sorted cache lines of a new row, updating the metrics if requested.
+    const auto visit_row = [&](const std::size_t i_new, const bool is_counted) {
+      const std::size_t i_old = is_identity ? i_new : old_index[i_new];
+      std::size_t min_column = i_new;
+      line.clear();
+      line.push_back(i_new / line_size);
+      row_column(i_old, [&](const std::size_t i_column_old) {
+        if(i_column_old == i_old) return;
+        const std::size_t i_column = is_identity ? i_column_old : permutation[i_column_old];
+        line.push_back(i_column / line_size);
+        if(!is_counted) return;
+        const std::size_t distance = i_column > i_new ? i_column - i_new : i_new - i_column;
+        result.bandwidth = std::max(result.bandwidth, distance);
+        result.distance += distance;
+        ++result.off_diagonal;
+        min_column = std::min(min_column, i_column);
+      });
+      std::sort(line.begin(), line.end());
+      const std::size_t gather = line.size();
+      line.erase(std::unique(line.begin(), line.end()), line.end());
+      if(!is_counted) return;
+      result.profile += i_new - min_column;
+      result.gather += gather;
+      result.reused += gather - line.size();
+      FOR_EACH(i_line, line) result.reused += std::binary_search(line_previous.begin(), line_previous.end(), i_line);
+    };
+
+    if(i_begin != 0) {
+      visit_row(i_begin - 1, false);
+      std::swap(line, line_previous);
+    }
+    FOR(i_new, i_begin, i_end) {
+      visit_row(i_new, true);
+      std::swap(line, line_previous);
+    }
+  });
+
+  Partial total;
+  FOR_EACH(result, partial) {
+    total.bandwidth = std::max(total.bandwidth, result.bandwidth);
+    total.profile += result.profile;
+    total.distance += result.distance;
+    total.off_diagonal += result.off_diagonal;
+    total.reused += result.reused;
+    total.gather += result.gather;
+  }
+  Ordering_Metrics metrics;
+  metrics.bandwidth = total.bandwidth;
+  metrics.profile = total.profile;
+  metrics.average_distance = total.off_diagonal ? Scalar(total.distance) / Scalar(total.off_diagonal) : 0;
+  metrics.cache_line_reuse = Scalar(total.reused) / Scalar(total.gather);
+  return metrics;
+}
+
+/**
+ * @details Wraps the adjacency of each vertex as the row structure, see ordering_metrics_rows.
+ */
+Ordering_Metrics ordering_metrics(const Adjacency_Graph<false>& graph, const std::vector<std::size_t>& permutation,
+                                  const std::size_t line_size) {
+  const auto row_column = [&](const std::size_t i_vertex, const auto& function) {
+    FOR_EACH(i_adjacent, graph[i_vertex]) function(i_adjacent);
+  };
+  return ordering_metrics_rows(graph.size_vertex(), row_column, permutation, line_size);
+}
+
+/**
+ * @details Wraps the column indices of each row as the row structure, see ordering_metrics_rows. The permutation is
+ * applied to both rows and columns, i.e. the metrics are those of P A P^T.
+ */
+Ordering_Metrics ordering_metrics(const Matrix_Sparse& matrix, const std::vector<std::size_t>& permutation,
+                                  const std::size_t line_size) {
+  ASSERT(matrix.size_row() == matrix.size_column(), "Matrix must be square, but is " +
+                                                    std::to_string(matrix.size_row()) + "x" +
+                                                    std::to_string(matrix.size_column()) + ".");
+  const auto row_column = [&](const std::size_t i_row, const auto& function) {
+    FOR_ITER(iter, matrix[i_row]) function(iter.i_column());
+  };
+  return ordering_metrics_rows(matrix.size_row(), row_column, permutation, line_size);
+}
+
 }  // namespace Disa
@@ -0,0 +1,550 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ---------------------------------------------------------------------------------------------------------------------
+// File Name: direct_sparse_factorisation.cpp
+// Description: Contains the definitions of the supernodal sparse Cholesky and LU direct solvers.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#include "direct_sparse_factorisation.hpp"
+#include "parallel.hpp"
+#include "reorder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Symbolic Factorisation
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details Each supernode stores its full diagonal block, the non-zero count therefore only counts the lower triangle
+ * (including the diagonal) of these blocks, plus the dense rows below them.
+ */
+std::size_t Symbolic_Factorisation::size_non_zero() const noexcept {
+  std::size_t non_zero = 0;
+  FOR(i_supernode, size_supernode()) {
+    const std::size_t size_column = column_offset[i_supernode + 1] - column_offset[i_supernode];
+    const std::size_t size_row = row_offset[i_supernode + 1] - row_offset[i_supernode];
+    non_zero += size_column * (size_column + 1) / 2 + (size_row - size_column) * size_column;
+  }
+  return non_zero;
+}
+
+/**
+ * @details The matrix pattern is copied out row by row and handed to the bulk graph constructor, which drops the
+ * diagonal and symmetrises.
+ */
+Adjacency_Graph<false> pattern_graph(const Matrix_Sparse& a_matrix) {
+  ASSERT(a_matrix.size_row() == a_matrix.size_column(), "Matrix must be square.");
+  std::vector<std::size_t> offset(a_matrix.size_row() + 1, 0);
+  std::vector<std::size_t> adjacency;
+  adjacency.reserve(a_matrix.size_non_zero());
+  FOR(i_row, a_matrix.size_row()) {
+    FOR_ITER(column_iter, a_matrix[i_row]) adjacency.push_back(column_iter.i_column());
+    offset[i_row + 1] = adjacency.size();
+  }
+  return Adjacency_Graph<false>(offset, adjacency);
+}
+
+/**
+ * @brief Constructs the symmetrised, permuted, pattern of a sparse matrix, excluding the diagonal.
+ * @param[in] a_matrix The sparse matrix.
+ * @param[in] permutation The ordering, new_index = permutation[old_index].
+ * @param[out] offset The offset into adjacency for each (permuted) row.
+ * @param[out] adjacency The sorted column indices of each (permuted) row.
+ */
+inline void permuted_pattern(const Matrix_Sparse& a_matrix, const std::vector<std::size_t>& permutation,
+                             std::vector<std::size_t>& offset, std::vector<std::size_t>& adjacency) {
+  const std::size_t size = a_matrix.size_row();
+  offset.assign(size + 1, 0);
+  FOR(i_row, size) {
+    FOR_ITER(column_iter, a_matrix[i_row]) {
+      if(column_iter.i_column() == i_row) continue;
+      ++offset[permutation[i_row] + 1];
+      ++offset[permutation[column_iter.i_column()] + 1];
+    }
+  }
+  std::partial_sum(offset.begin(), offset.end(), offset.begin());
+  adjacency.resize(offset.back());
+  std::vector<std::size_t> insert(offset.begin(), offset.end() - 1);
+  FOR(i_row, size) {
+    FOR_ITER(column_iter, a_matrix[i_row]) {
+      if(column_iter.i_column() == i_row) continue;
+      adjacency[insert[permutation[i_row]]++] = permutation[column_iter.i_column()];
+      adjacency[insert[permutation[column_iter.i_column()]]++] = permutation[i_row];
+    }
+  }
+
+  // Sort and remove duplicates (symmetric entries), compressing in place.
+  std::size_t i_write = 0;
+  FOR(i_row, size) {
+    const auto begin = adjacency.begin() + static_cast<long>(offset[i_row]);
+    const auto end = adjacency.begin() + static_cast<long>(offset[i_row + 1]);
+    std::sort(begin, end);
+    const std::size_t i_row_begin = i_write;
+    for(auto iter = begin; iter != end; ++iter) {
+      if(i_write == i_row_begin || adjacency[i_write - 1] != *iter) adjacency[i_write++] = *iter;
+    }
+    offset[i_row] = i_row_begin;
+  }
+  offset[size] = i_write;
+  adjacency.resize(i_write);
+}
+
+/**
+ * @brief Computes the elimination tree of a symmetric pattern, using Liu's algorithm with path compression.
+ * @param[in] offset The offset into adjacency for each row.
+ * @param[in] adjacency The column indices of each row.
+ * @return The parent of each column in the elimination tree, max() for roots.
+ */
+inline std::vector<std::size_t> elimination_tree(const std::vector<std::size_t>& offset,
+                                                 const std::vector<std::size_t>& adjacency) {
+  const std::size_t size = offset.size() - 1;
+  std::vector<std::size_t> parent(size, std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> ancestor(size, std::numeric_limits<std::size_t>::max());
+  FOR(i_column, size) {
+    for(std::size_t i_entry = offset[i_column]; i_entry < offset[i_column + 1] && adjacency[i_entry] < i_column;
+        ++i_entry) {
+      std::size_t i_root = adjacency[i_entry];
+      while(ancestor[i_root] != std::numeric_limits<std::size_t>::max() && ancestor[i_root] != i_column) {
+        const std::size_t i_next = ancestor[i_root];
+        ancestor[i_root] = i_column;
+        i_root = i_next;
+      }
+      if(ancestor[i_root] == std::numeric_limits<std::size_t>::max()) {
+        ancestor[i_root] = i_column;
+        parent[i_root] = i_column;
+      }
+    }
+  }
+  return parent;
+}
+
+/**
+ * @brief Computes a postordering of a forest, children are visited in ascending order.
+ * @param[in] parent The parent of each vertex, max() for roots.
+ * @return The postorder, new_index = postorder[old_index].
+ */
+inline std::vector<std::size_t> tree_postorder(const std::vector<std::size_t>& parent) {
+  const std::size_t size = parent.size();
+  std::vector<std::size_t> head(size, std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> next(size, std::numeric_limits<std::size_t>::max());
+  for(std::size_t i_vertex = size - 1; i_vertex != std::numeric_limits<std::size_t>::max(); --i_vertex) {
+    if(parent[i_vertex] == std::numeric_limits<std::size_t>::max()) continue;
+    next[i_vertex] = head[parent[i_vertex]];
+    head[parent[i_vertex]] = i_vertex;
+  }
+
+  std::size_t new_index = 0;
+  std::vector<std::size_t> postorder(size);
+  std::vector<std::size_t> stack;
+  FOR(i_root, size) {
+    if(parent[i_root] != std::numeric_limits<std::size_t>::max()) continue;
+    stack.push_back(i_root);
+    while(!stack.empty()) {
+      const std::size_t i_vertex = stack.back();
+      const std::size_t i_child = head[i_vertex];
+      if(i_child == std::numeric_limits<std::size_t>::max()) {
+        postorder[i_vertex] = new_index++;
+        stack.pop_back();
+      } else {
+        head[i_vertex] = next[i_child];
+        stack.push_back(i_child);
+      }
+    }
+  }
+  return postorder;
+}
+
+/**
+ * @details The symbolic factorisation proceeds as follows:
+ *
+ * 1. The symmetrised pattern is permuted and its elimination tree computed. The tree is then postordered, and the
+ *    postorder composed with the parsed permutation, such that every subtree occupies a contiguous range of columns.
+ *    This does not change the fill, but does allow supernodes to be formed from contiguous columns.
+ * 2. The row structure of each column of L is the union of the pattern of A below the diagonal and the structures of
+ *    its children in the elimination tree (less the column itself), which are computed in column order.
+ * 3. Fundamental supernodes are formed, a column is merged into the supernode of the previous column if it is that
+ *    column's parent, only child and their structures are nested.
+ * 4. Each non-zero of the matrix is mapped to its position in the supernodal panels, so numeric factorisations only
+ *    need to scatter the values.
+ */
+Symbolic_Factorisation symbolic_factorisation(const Matrix_Sparse& a_matrix,
+                                              const std::vector<std::size_t>& permutation) {
+  ASSERT(a_matrix.size_row() == a_matrix.size_column(), "Matrix must be square.");
+  ASSERT(permutation.size() == a_matrix.size_row(), "Incorrect sizes, " + std::to_string(permutation.size()) +
+                                                    " vs. " + std::to_string(a_matrix.size_row()) + ".");
+  const std::size_t size = a_matrix.size_row();
+  Symbolic_Factorisation symbolic;
+  symbolic.signature = pattern_signature(a_matrix);
+  symbolic.column_offset.push_back(0);
+  symbolic.row_offset.push_back(0);
+  symbolic.value_offset.push_back(0);
+  if(size == 0) return symbolic;
+
+  // Postorder the elimination tree.
+  std::vector<std::size_t> offset;
+  std::vector<std::size_t> adjacency;
+  permuted_pattern(a_matrix, permutation, offset, adjacency);
+  const std::vector<std::size_t> postorder = tree_postorder(elimination_tree(offset, adjacency));
+  symbolic.permutation.resize(size);
+  FOR(i_old, size) symbolic.permutation[i_old] = postorder[permutation[i_old]];
+  permuted_pattern(a_matrix, symbolic.permutation, offset, adjacency);
+  symbolic.parent = elimination_tree(offset, adjacency);
+
+  // Column structures, children always precede their parents in a postordering.
+  std::vector<std::size_t> structure_offset(size + 1, 0);
+  std::vector<std::size_t> structure;
+  std::vector<std::size_t> child_count(size, 0);
+  std::vector<std::size_t> child_head(size, std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> child_next(size, std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> marker(size, std::numeric_limits<std::size_t>::max());
+  FOR(i_column, size) {
+    marker[i_column] = i_column;
+    for(std::size_t i_entry = offset[i_column]; i_entry < offset[i_column + 1]; ++i_entry) {
+      if(adjacency[i_entry] > i_column && marker[adjacency[i_entry]] != i_column) {
+        marker[adjacency[i_entry]] = i_column;
+        structure.push_back(adjacency[i_entry]);
+      }
+    }
+    for(std::size_t i_child = child_head[i_column]; i_child != std::numeric_limits<std::size_t>::max();
+        i_child = child_next[i_child]) {
+      for(std::size_t i_entry = structure_offset[i_child]; i_entry < structure_offset[i_child + 1]; ++i_entry) {
+        if(marker[structure[i_entry]] != i_column) {
+          marker[structure[i_entry]] = i_column;
+          structure.push_back(structure[i_entry]);
+        }
+      }
+    }
+    std::sort(structure.begin() + static_cast<long>(structure_offset[i_column]), structure.end());
+    structure_offset[i_column + 1] = structure.size();
+
+    const std::size_t i_parent = symbolic.parent[i_column];
+    if(i_parent != std::numeric_limits<std::size_t>::max()) {
+      child_next[i_column] = child_head[i_parent];
+      child_head[i_parent] = i_column;
+      ++child_count[i_parent];
+    }
+  }
+
+  // Fundamental supernodes.
+  symbolic.supernode_of.resize(size);
+  FOR(i_column, size) {
+    const bool merge = i_column != 0 && symbolic.parent[i_column - 1] == i_column && child_count[i_column] == 1 &&
+                       structure_offset[i_column] - structure_offset[i_column - 1] ==
+                       structure_offset[i_column + 1] - structure_offset[i_column] + 1;
+    if(!merge && i_column != 0) symbolic.column_offset.push_back(i_column);
+    symbolic.supernode_of[i_column] = symbolic.column_offset.size() - 1;
+  }
+  symbolic.column_offset.push_back(size);
+
+  FOR(i_supernode, symbolic.size_supernode()) {
+    const std::size_t i_first = symbolic.column_offset[i_supernode];
+    const std::size_t size_column = symbolic.column_offset[i_supernode + 1] - i_first;
+    symbolic.row.push_back(i_first);
+    symbolic.row.insert(symbolic.row.end(), structure.begin() + static_cast<long>(structure_offset[i_first]),
+                        structure.begin() + static_cast<long>(structure_offset[i_first + 1]));
+    symbolic.row_offset.push_back(symbolic.row.size());
+    symbolic.value_offset.push_back(symbolic.value_offset.back() +
+                                    (symbolic.row_offset[i_supernode + 1] - symbolic.row_offset[i_supernode]) *
+                                    size_column);
+  }
+
+  // Scatter map, upper entries outside of the diagonal blocks are offset by the size of the lower values.
+  symbolic.scatter.reserve(a_matrix.size_non_zero());
+  FOR(i_row, size) {
+    FOR_ITER(column_iter, a_matrix[i_row]) {
+      const std::size_t i_new_row = symbolic.permutation[i_row];
+      const std::size_t i_new_column = symbolic.permutation[column_iter.i_column()];
+      const std::size_t i_low = std::min(i_new_row, i_new_column);
+      const std::size_t i_high = std::max(i_new_row, i_new_column);
+      const std::size_t i_supernode = symbolic.supernode_of[i_low];
+      const std::size_t size_column = symbolic.column_offset[i_supernode + 1] - symbolic.column_offset[i_supernode];
+      const auto row_begin = symbolic.row.begin() + static_cast<long>(symbolic.row_offset[i_supernode]);
+      const auto row_end = symbolic.row.begin() + static_cast<long>(symbolic.row_offset[i_supernode + 1]);
+      const std::size_t i_local_row = std::lower_bound(row_begin, row_end, i_high) - row_begin;
+      const std::size_t i_local_column = i_low - symbolic.column_offset[i_supernode];
+      std::size_t i_value = symbolic.value_offset[i_supernode];
+      if(i_new_row >= i_new_column) i_value += i_local_row * size_column + i_local_column;
+      else if(i_local_row < size_column) i_value += i_local_column * size_column + i_local_row;
+      else i_value += symbolic.size_value() + i_local_row * size_column + i_local_column;
+      symbolic.scatter.push_back(i_value);
+    }
+  }
+  return symbolic;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Direct Sparse Factorisation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<Solver_Type _solver_type>
+void Direct_Sparse_Factorisation<_solver_type>::analyse(const Matrix_Sparse& a_matrix) {
+  analyse(a_matrix, approximate_minimum_degree(pattern_graph(a_matrix)));
+}
+
+template<Solver_Type _solver_type>
+void Direct_Sparse_Factorisation<_solver_type>::analyse(const Matrix_Sparse& a_matrix,
+                                                        const std::vector<std::size_t>& permutation) {
+  factorised = false;
+  symbolic_data = symbolic_factorisation(a_matrix, permutation);
+}
+
+/**
+ * @details The matrix values are scattered into the (zeroed) supernodal panels, using the symbolic scatter map, after
+ * which the supernodes are factorised in (post)order. Once a supernode is factorised its contribution to the Schur
+ * complement is immediately applied to its ancestors (right looking), such that each supernode is complete when it is
+ * reached.
+ */
+template<Solver_Type _solver_type>
+bool Direct_Sparse_Factorisation<_solver_type>::factorise(const Matrix_Sparse& a_matrix) {
+  if(symbolic_data.signature != pattern_signature(a_matrix) || symbolic_data.scatter.size() != a_matrix.size_non_zero())
+    analyse(a_matrix);
+  factorised = false;
+
+  lower.assign(symbolic_data.size_value(), 0.0);
+  if constexpr(!is_cholesky) upper.assign(symbolic_data.size_value(), 0.0);
+  std::size_t i_non_zero = 0;
+  FOR(i_row, a_matrix.size_row()) {
+    FOR_ITER(column_iter, a_matrix[i_row]) {
+      const std::size_t i_value = symbolic_data.scatter[i_non_zero++];
+      if(i_value < symbolic_data.size_value()) lower[i_value] = *column_iter;
+      else if constexpr(!is_cholesky) upper[i_value - symbolic_data.size_value()] = *column_iter;
+    }
+  }
+
+  std::vector<std::size_t> position(a_matrix.size_row());
+  FOR(i_supernode, symbolic_data.size_supernode()) {
+    if(!factorise_supernode(i_supernode)) return false;
+    update_ancestors(i_supernode, position);
+  }
+  factorised = true;
+  return true;
+}
+
+/**
+ * @details The dense kernels operate on the row major panel of the supernode, with the diagonal block, D, in the first
+ * rows, and the rows below it, B. For Cholesky D = L_11 L_11^T is factorised, and L_21 = B L_11^-T. For LU D = L_11
+ * U_11 is factorised (packed, without pivoting), and L_21 = B U_11^-1 and U_12^T = B^T L_11^-T, the latter using the
+ * transposed panel stored in upper.
+ */
+template<Solver_Type _solver_type>
+bool Direct_Sparse_Factorisation<_solver_type>::factorise_supernode(const std::size_t i_supernode) {
+  const std::size_t size_column =
+  symbolic_data.column_offset[i_supernode + 1] - symbolic_data.column_offset[i_supernode];
+  const std::size_t size_row = symbolic_data.row_offset[i_supernode + 1] - symbolic_data.row_offset[i_supernode];
+  Scalar* const panel = lower.data() + symbolic_data.value_offset[i_supernode];
+
+  // Diagonal block.
+  FOR(i_pivot, size_column) {
+    Scalar* const pivot_row = panel + i_pivot * size_column;
+    if constexpr(is_cholesky) {
+      Scalar diagonal = pivot_row[i_pivot];
+      FOR(i_inner, i_pivot) diagonal -= pivot_row[i_inner] * pivot_row[i_inner];
+      if(!(diagonal > factorisation_tolerance)) return false;
+      pivot_row[i_pivot] = std::sqrt(diagonal);
+      FOR(i_row, i_pivot + 1, size_column) {
+        Scalar* const row = panel + i_row * size_column;
+        Scalar value = row[i_pivot];
+        FOR(i_inner, i_pivot) value -= row[i_inner] * pivot_row[i_inner];
+        row[i_pivot] = value / pivot_row[i_pivot];
+      }
+    } else {
+      if(std::abs(pivot_row[i_pivot]) < factorisation_tolerance) return false;
+      FOR(i_row, i_pivot + 1, size_column) {
+        Scalar* const row = panel + i_row * size_column;
+        row[i_pivot] /= pivot_row[i_pivot];
+        FOR(i_column, i_pivot + 1, size_column) row[i_column] -= row[i_pivot] * pivot_row[i_column];
+      }
+    }
+  }
+
+  // Off diagonal rows, triangular solves against the diagonal block.
+  parallel_for_block(
+  size_row - size_column,
+  [&](const std::size_t i_begin, const std::size_t i_end) {
+    FOR(i_row, size_column + i_begin, size_column + i_end) {
+      Scalar* const row = panel + i_row * size_column;
+      FOR(i_pivot, size_column) {
+        Scalar value = row[i_pivot];
+        if constexpr(is_cholesky) {
+          const Scalar* const pivot_row = panel + i_pivot * size_column;
+          FOR(i_inner, i_pivot) value -= row[i_inner] * pivot_row[i_inner];
+        } else {
+          FOR(i_inner, i_pivot) value -= row[i_inner] * panel[i_inner * size_column + i_pivot];
+        }
+        row[i_pivot] = value / panel[i_pivot * size_column + i_pivot];
+      }
+      if constexpr(!is_cholesky) {
+        Scalar* const row_upper = upper.data() + symbolic_data.value_offset[i_supernode] + i_row * size_column;
+        FOR(i_pivot, size_column) {
+          const Scalar* const pivot_row = panel + i_pivot * size_column;
+          FOR(i_inner, i_pivot) row_upper[i_pivot] -= row_upper[i_inner] * pivot_row[i_inner];
+        }
+      }
+    }
+  },
+  update_grain);
+  return true;
+}
+
+/**
+ * @details The off diagonal rows of the supernode are grouped into runs belonging to the same target supernode
+ * (contiguous, since supernodes are contiguous columns and the rows are sorted). For each run the update
+ * A_ij -= L_i U_j (U = L^T for Cholesky), for every row i below (or in) the run and each column j in the run, is a
+ * dot product of two contiguous panel rows, which is then scattered into the target panel. For LU the transposed
+ * update, to U, is applied at the same time. Rows of a run are split across threads, since each thread then writes to
+ * distinct rows of the target.
+ */
+template<Solver_Type _solver_type>
+void Direct_Sparse_Factorisation<_solver_type>::update_ancestors(const std::size_t i_supernode,
+                                                                 std::vector<std::size_t>& position) {
+  const std::size_t size_column =
+  symbolic_data.column_offset[i_supernode + 1] - symbolic_data.column_offset[i_supernode];
+  const std::size_t size_row = symbolic_data.row_offset[i_supernode + 1] - symbolic_data.row_offset[i_supernode];
+  const std::size_t* const rows = symbolic_data.row.data() + symbolic_data.row_offset[i_supernode];
+  const Scalar* const panel = lower.data() + symbolic_data.value_offset[i_supernode];
+  const Scalar* const panel_upper =
+  is_cholesky ? panel : upper.data() + symbolic_data.value_offset[i_supernode];
+
+  std::size_t i_run = size_column;
+  while(i_run < size_row) {
+
+    // Find the run of rows in the target supernode and map the target's rows.
+    const std::size_t i_target = symbolic_data.supernode_of[rows[i_run]];
+    const std::size_t target_first = symbolic_data.column_offset[i_target];
+    const std::size_t target_size_column = symbolic_data.column_offset[i_target + 1] - target_first;
+    std::size_t i_run_end = i_run;
+    while(i_run_end < size_row && rows[i_run_end] < target_first + target_size_column) ++i_run_end;
+    FOR(i_local, symbolic_data.row_offset[i_target + 1] - symbolic_data.row_offset[i_target])
+    position[symbolic_data.row[symbolic_data.row_offset[i_target] + i_local]] = i_local;
+    Scalar* const target = lower.data() + symbolic_data.value_offset[i_target];
+    Scalar* const target_upper = is_cholesky ? nullptr : upper.data() + symbolic_data.value_offset[i_target];
+
+    parallel_for_block(
+    size_row - i_run,
+    [&](const std::size_t i_begin, const std::size_t i_end) {
+      FOR(i_row, i_run + i_begin, i_run + i_end) {
+        const Scalar* const row_lower = panel + i_row * size_column;
+        const Scalar* const row_upper = panel_upper + i_row * size_column;
+        const std::size_t i_target_row = position[rows[i_row]];
+        for(std::size_t i_column = i_run; i_column < i_run_end && i_column <= i_row; ++i_column) {
+          const Scalar* const column_lower = panel + i_column * size_column;
+          const Scalar* const column_upper = panel_upper + i_column * size_column;
+          const std::size_t i_target_column = rows[i_column] - target_first;
+          Scalar value = 0.0;
+          FOR(i_inner, size_column) value += row_lower[i_inner] * column_upper[i_inner];
+          target[i_target_row * target_size_column + i_target_column] -= value;
+          if constexpr(!is_cholesky) {
+            if(i_column == i_row) continue;
+            value = 0.0;
+            FOR(i_inner, size_column) value += column_lower[i_inner] * row_upper[i_inner];
+            if(i_target_row < target_size_column) target[i_target_column * target_size_column + i_target_row] -= value;
+            else target_upper[i_target_row * target_size_column + i_target_column] -= value;
+          }
+        }
+      }
+    },
+    update_grain);
+    i_run = i_run_end;
+  }
+}
+
+/**
+ * @details Forward substitution, L y = P b, supernode by supernode, followed by the backward substitution U z = y
+ * (U = L^T for Cholesky) in reverse, and finally x = P^T z.
+ */
+template<Solver_Type _solver_type>
+Convergence_Data Direct_Sparse_Factorisation<_solver_type>::solve_system(Vector_Dense<Scalar, 0>& x_vector,
+                                                                          const Vector_Dense<Scalar, 0>& b_vector) {
+  ASSERT_DEBUG(b_vector.size() == symbolic_data.permutation.size(), "Constant vector not of the correct size.");
+
+  Convergence_Data convergence_data = Convergence_Data();
+  if(!factorised) return convergence_data;
+
+  const std::size_t size = b_vector.size();
+  work.resize(size);
+  FOR(i_row, size) work[symbolic_data.permutation[i_row]] = b_vector[i_row];
+
+  // Forward substitution.
+  FOR(i_supernode, symbolic_data.size_supernode()) {
+    const std::size_t first = symbolic_data.column_offset[i_supernode];
+    const std::size_t size_column = symbolic_data.column_offset[i_supernode + 1] - first;
+    const std::size_t size_row = symbolic_data.row_offset[i_supernode + 1] - symbolic_data.row_offset[i_supernode];
+    const std::size_t* const rows = symbolic_data.row.data() + symbolic_data.row_offset[i_supernode];
+    const Scalar* const panel = lower.data() + symbolic_data.value_offset[i_supernode];
+    FOR(i_pivot, size_column) {
+      Scalar value = work[first + i_pivot];
+      FOR(i_inner, i_pivot) value -= panel[i_pivot * size_column + i_inner] * work[first + i_inner];
+      work[first + i_pivot] = is_cholesky ? value / panel[i_pivot * size_column + i_pivot] : value;
+    }
+    FOR(i_row, size_column, size_row) {
+      Scalar value = 0.0;
+      FOR(i_inner, size_column) value += panel[i_row * size_column + i_inner] * work[first + i_inner];
+      work[rows[i_row]] -= value;
+    }
+  }
+
+  // Backward substitution.
+  for(std::size_t i_supernode = symbolic_data.size_supernode() - 1;
+      i_supernode != std::numeric_limits<std::size_t>::max(); --i_supernode) {
+    const std::size_t first = symbolic_data.column_offset[i_supernode];
+    const std::size_t size_column = symbolic_data.column_offset[i_supernode + 1] - first;
+    const std::size_t size_row = symbolic_data.row_offset[i_supernode + 1] - symbolic_data.row_offset[i_supernode];
+    const std::size_t* const rows = symbolic_data.row.data() + symbolic_data.row_offset[i_supernode];
+    const Scalar* const panel = lower.data() + symbolic_data.value_offset[i_supernode];
+    const Scalar* const panel_upper = is_cholesky ? panel : upper.data() + symbolic_data.value_offset[i_supernode];
+    FOR(i_row, size_column, size_row) {
+      const Scalar value = work[rows[i_row]];
+      FOR(i_inner, size_column) work[first + i_inner] -= panel_upper[i_row * size_column + i_inner] * value;
+    }
+    for(std::size_t i_pivot = size_column - 1; i_pivot != std::numeric_limits<std::size_t>::max(); --i_pivot) {
+      Scalar value = work[first + i_pivot];
+      if constexpr(is_cholesky) {
+        FOR(i_inner, i_pivot + 1, size_column) value -= panel[i_inner * size_column + i_pivot] * work[first + i_inner];
+      } else {
+        FOR(i_inner, i_pivot + 1, size_column) value -= panel[i_pivot * size_column + i_inner] * work[first + i_inner];
+      }
+      work[first + i_pivot] = value / panel[i_pivot * size_column + i_pivot];
+    }
+  }
+
+  x_vector.resize(size);
+  FOR(i_row, size) x_vector[i_row] = work[symbolic_data.permutation[i_row]];
+
+  ++convergence_data.iteration;
+  convergence_data.converged = true;
+  convergence_data.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                    convergence_data.start_time);
+  return convergence_data;
+}
+
+template<Solver_Type _solver_type>
+Convergence_Data Direct_Sparse_Factorisation<_solver_type>::solve_system(const Matrix_Sparse& a_matrix,
+                                                                          Vector_Dense<Scalar, 0>& x_vector,
+                                                                          const Vector_Dense<Scalar, 0>& b_vector) {
+  if(!factorise(a_matrix)) return Convergence_Data();
+  return solve_system(x_vector, b_vector);
+}
+
+template class Direct_Sparse_Factorisation<Solver_Type::cholesky_factorisation_sparse>;
+template class Direct_Sparse_Factorisation<Solver_Type::lower_upper_factorisation_sparse>;
+
+}  // namespace Disa
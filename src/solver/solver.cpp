@@ -39,6 +39,18 @@ Solver build_solver(Solver_Config config) {
     case Solver_Type::successive_over_relaxation:
       solver.solver = std::make_unique<Sover_Sor>(config);
       break;
+    case Solver_Type::conjugate_gradient:
+      solver.solver = std::make_unique<Solver_CG>(config);
+      break;
+    case Solver_Type::asynchronous_relaxation:
+      solver.solver = std::make_unique<Solver_Asynchronous>(config);
+      break;
+    case Solver_Type::cholesky_factorisation_sparse:
+      solver.solver = std::make_unique<Solver_Cholesky_Sparse>(config);
+      break;
+    case Solver_Type::lower_upper_factorisation_sparse:
+      solver.solver = std::make_unique<Solver_LU_Sparse>(config);
+      break;
     default:
       ERROR("Undefined.");
       exit(0);
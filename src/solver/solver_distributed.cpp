@@ -0,0 +1,115 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// File Name: solver_krylov.cpp
+// File Name: solver_distributed.cpp
+// Description: Contains the definitions of distributed sparse matrices.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#include "solver_distributed.hpp"
+#include "adjacency_graph.hpp"
+#include "adjacency_subgraph.hpp"
+#include "direct_sparse_factorisation.hpp"
+#include "parallel.hpp"
+#include "partition.hpp"
+#include "reorder.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Distributed Matrix
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @details The matrix graph is bisected recursively into the partitions, which are grown by a single halo level, the
+ * extent of a matrix-vector product's dependencies. Each partition is then ordered interior, boundary, halo (keeping
+ * the ascending global order within each) and its plan is derived. Finally, the owned rows are copied to the local
+ * matrix, the columns of each row being mapped to local indices through the row's local neighbours, which, with the
+ * row itself, are exactly its columns.
+ */
+std::vector<Distributed_Matrix> distribute_matrix(const Matrix_Sparse& matrix, const std::size_t number_partition) {
+  ASSERT(matrix.size_row() == matrix.size_column(), "Matrix must be square, " + std::to_string(matrix.size_row()) +
+                                                    "," + std::to_string(matrix.size_column()) + ".");
+  ASSERT(number_partition > 0, "Cannot distribute a matrix over zero partitions.");
+
+  const Adjacency_Graph<false> graph = pattern_graph(matrix);
+  std::vector<Adjacency_Subgraph> subgraph_list = recursive_graph_bisection(graph, number_partition);
+  update_levels(graph, subgraph_list, 1);
+  std::vector<Interior_Boundary_Split> split_list(subgraph_list.size());
+  parallel_for(
+  subgraph_list.size(),
+  [&](const std::size_t i_subgraph) {
+    split_list[i_subgraph] = interior_boundary_split(subgraph_list[i_subgraph]);
+    static_cast<void>(subgraph_list[i_subgraph].reorder(split_list[i_subgraph].permutation));
+  },
+  1);
+  const std::vector<Halo_Exchange_Plan> plan_list = create_halo_exchange_plan(graph, subgraph_list);
+
+  std::vector<Distributed_Matrix> distributed_list(subgraph_list.size());
+  parallel_for(
+  subgraph_list.size(),
+  [&](const std::size_t i_subgraph) {
+    const Adjacency_Subgraph& subgraph = subgraph_list[i_subgraph];
+    const Interior_Boundary_Split& split = split_list[i_subgraph];
+    Distributed_Matrix& distributed = distributed_list[i_subgraph];
+    distributed.size_global = matrix.size_row();
+    distributed.plan = plan_list[i_subgraph];
+    distributed.interior = split.interior();
+    distributed.boundary = split.boundary();
+    distributed.i_local_global.resize(subgraph.size_vertex());
+    FOR(i_local, subgraph.size_vertex()) distributed.i_local_global[i_local] = subgraph.local_global(i_local);
+
+    const std::size_t size_owned = split.size_interior + split.size_boundary;
+    distributed.matrix = Matrix_Sparse(size_owned, subgraph.size_vertex());
+    std::vector<std::pair<std::size_t, std::size_t>> column_global_local;
+    std::vector<std::pair<std::size_t, Scalar>> row_entry;
+    FOR(i_row, size_owned) {
+      column_global_local.clear();
+      column_global_local.emplace_back(distributed.i_local_global[i_row], i_row);
+      FOR_EACH(i_local, subgraph[i_row]) column_global_local.emplace_back(distributed.i_local_global[i_local], i_local);
+      std::sort(column_global_local.begin(), column_global_local.end());
+
+      row_entry.clear();
+      FOR_ITER(iter, matrix[distributed.i_local_global[i_row]]) {
+        const auto column = std::lower_bound(column_global_local.begin(), column_global_local.end(),
+                                             std::make_pair(iter.i_column(), std::size_t{0}));
+        row_entry.emplace_back(column->second, *iter);
+      }
+      std::sort(row_entry.begin(), row_entry.end());
+      FOR_EACH(entry, row_entry) distributed.matrix.insert(i_row, entry.first, entry.second);
+    }
+  },
+  1);
+  return distributed_list;
+}
+
+Vector_Dense<Scalar, 0> distribute_vector(const Distributed_Matrix& distributed,
+                                          const Vector_Dense<Scalar, 0>& vector) {
+  Vector_Dense<Scalar, 0> vector_local;
+  vector_local.resize(distributed.size_local());
+  FOR(i_local, distributed.size_local()) vector_local[i_local] = vector[distributed.i_local_global[i_local]];
+  return vector_local;
+}
+
+void collect_vector(const Distributed_Matrix& distributed, const Vector_Dense<Scalar, 0>& vector_local,
+                    Vector_Dense<Scalar, 0>& vector) {
+  FOR(i_row, distributed.size_owned()) vector[distributed.i_local_global[i_row]] = vector_local[i_row];
+}
+
+}  // namespace Disa
@@ -21,9 +21,13 @@
 
 #include "solver_fixed_point.hpp"
 #include "matrix_sparse.hpp"
+#include "parallel.hpp"
 #include "scalar.hpp"
 #include "vector_dense.hpp"
 
+#include <atomic>
+#include <barrier>
+
 namespace Disa {
 
 inline void forward_sweep(const Matrix_Sparse& a_matrix, const Vector_Dense<Scalar, 0>& x_vector,
@@ -52,6 +56,102 @@ inline void backward_sweep(const Matrix_Sparse& a_matrix, const Vector_Dense<Sca
   }
 }
 
+/**
+ * @details A row i in a forward sweep reads the updated values of its lower neighbours (j < i) and the old values of
+ * its upper neighbours (j > i). To reproduce the serial sweep exactly, a row must therefore be placed in a later level
+ * than its lower neighbours (true dependencies) and in an earlier level than its upper neighbours (anti-dependencies).
+ * The latter is only distinct for non-symmetric patterns. Levels are found in a single pass over the rows, in O(nnz),
+ * and the rows bucketed by level via a counting sort.
+ */
+Level_Schedule level_schedule(const Matrix_Sparse& a_matrix) {
+  const std::size_t size = a_matrix.size_row();
+  std::vector<std::size_t> level(size, 0);
+  FOR(i_row, size) {
+    FOR_ITER(column_iter, a_matrix[i_row]) {
+      if(column_iter.i_column() < i_row) level[i_row] = std::max(level[i_row], level[column_iter.i_column()] + 1);
+    }
+    FOR_ITER(column_iter, a_matrix[i_row]) {
+      if(column_iter.i_column() > i_row)
+        level[column_iter.i_column()] = std::max(level[column_iter.i_column()], level[i_row] + 1);
+    }
+  }
+
+  Level_Schedule schedule;
+  schedule.signature = pattern_signature(a_matrix);
+  schedule.level_offset.resize((size ? *std::max_element(level.begin(), level.end()) + 1 : 0) + 1, 0);
+  FOR(i_row, size) ++schedule.level_offset[level[i_row] + 1];
+  FOR(i_level, std::size_t{1}, schedule.level_offset.size()) {
+    schedule.level_offset[i_level] += schedule.level_offset[i_level - 1];
+  }
+  schedule.row.resize(size);
+  std::vector<std::size_t> insert = schedule.level_offset;
+  FOR(i_row, size) schedule.row[insert[level[i_row]]++] = i_row;
+  return schedule;
+}
+
+/**
+ * @brief Performs an in-place forward (Gauss-Seidel/SOR) sweep level by level, rows within a level in parallel.
+ * @param[in] a_matrix The coefficient matrix.
+ * @param[in] schedule The level schedule of the coefficient matrix.
+ * @param[in,out] x_vector The solution vector, updated in place.
+ * @param[in] b_vector The constant vector.
+ * @param[in] omega The relaxation factor.
+ *
+ * @details Each row is evaluated with exactly the same operations, in the same order, as forward_sweep(), and reads the
+ * same (old or updated) neighbour values. The result is therefore bitwise identical to the serial sweep.
+ */
+inline void forward_sweep_wavefront(const Matrix_Sparse& a_matrix, const Level_Schedule& schedule,
+                                    Vector_Dense<Scalar, 0>& x_vector, const Vector_Dense<Scalar, 0>& b_vector,
+                                    const Scalar omega = 1) {
+  const auto sweep_row = [&](const std::size_t i_row) {
+    Scalar offs_row_dot = 0;
+    FOR_ITER(column_iter, a_matrix[i_row])
+    if(column_iter.i_column() != i_row) offs_row_dot += *column_iter * x_vector[column_iter.i_column()];
+    x_vector[i_row] =
+    omega * (b_vector[i_row] - offs_row_dot) / a_matrix[i_row][i_row] + (1.0 - omega) * x_vector[i_row];
+  };
+
+  // Threads synchronise after each level, so only use as many as the average level width can keep busy.
+  const std::size_t number_level = schedule.level_offset.size() - 1;
+  const std::size_t level_width = schedule.row.size() / std::max<std::size_t>(number_level, 1);
+  const std::size_t number_thread = std::min(parallel_thread_count(), std::max<std::size_t>(level_width / 16, 1));
+  std::barrier barrier(static_cast<std::ptrdiff_t>(number_thread));
+  parallel_region(number_thread, [&](const std::size_t i_thread, const std::size_t number_thread) {
+    FOR(i_level, number_level) {
+      const std::size_t level_size = schedule.level_offset[i_level + 1] - schedule.level_offset[i_level];
+      const auto [i_begin, i_end] = parallel_block(level_size, i_thread, number_thread);
+      FOR(i_row, schedule.level_offset[i_level] + i_begin, schedule.level_offset[i_level] + i_end) {
+        sweep_row(schedule.row[i_row]);
+      }
+      if(number_thread > 1) barrier.arrive_and_wait();
+    }
+  });
+}
+
+/**
+ * @brief Performs an in-place forward sweep, using the wavefront sweep if requested by the solver data.
+ * @param[in] a_matrix The coefficient matrix.
+ * @param[in] data The solver data, holding the wavefront flag and level schedule.
+ * @param[in,out] x_vector The solution vector, updated in place.
+ * @param[in] b_vector The constant vector.
+ * @param[in] omega The relaxation factor.
+ */
+inline void forward_sweep_in_place(const Matrix_Sparse& a_matrix, const Solver_Fixed_Point_Data& data,
+                                   Vector_Dense<Scalar, 0>& x_vector, const Vector_Dense<Scalar, 0>& b_vector,
+                                   const Scalar omega = 1) {
+  if(data.wavefront) forward_sweep_wavefront(a_matrix, data.schedule, x_vector, b_vector, omega);
+  else forward_sweep(a_matrix, x_vector, x_vector, b_vector, omega);
+}
+
+/**
+ * @brief Rebuilds the level schedule of the solver data, if wavefront sweeps are used and the pattern has changed.
+ * @param[in] a_matrix The coefficient matrix.
+ * @param[in,out] data The solver data.
+ */
+inline void update_schedule(const Matrix_Sparse& a_matrix, Solver_Fixed_Point_Data& data) {
+  if(data.wavefront && data.schedule.signature != pattern_signature(a_matrix)) data.schedule = level_schedule(a_matrix);
+}
+
 template<>
 void Solver_Fixed_Point<Solver_Type::jacobi, Solver_Fixed_Point_Jacobi_Data>::initialise_solver(Solver_Config config) {
   //tpdo assert
@@ -79,14 +179,18 @@ void Solver_Fixed_Point<Solver_Type::gauss_seidel, Solver_Fixed_Point_Data>::ini
   data.limits.min_iterations = config.minimum_iterations;
   data.limits.max_iteration = config.maximum_iterations;
   data.limits.tolerance = config.convergence_tolerance;
+
+  data.wavefront = config.wavefront;
+  data.schedule = Level_Schedule();
 }
 
 template<>
 Convergence_Data Solver_Fixed_Point<Solver_Type::gauss_seidel, Solver_Fixed_Point_Data>::solve_system(
 const Matrix_Sparse& a_matrix, Vector_Dense<Scalar, 0>& x_vector, const Vector_Dense<Scalar, 0>& b_vector) {
+  update_schedule(a_matrix, data);
   Convergence_Data convergence_data = Convergence_Data();
   while(!data.limits.is_converged(convergence_data)) {
-    forward_sweep(a_matrix, x_vector, x_vector, b_vector, 1.0);
+    forward_sweep_in_place(a_matrix, data, x_vector, b_vector, 1.0);
     convergence_data.update(a_matrix, x_vector, b_vector);
   }
   return convergence_data;
@@ -101,18 +205,107 @@ Solver_Config config) {
   data.limits.tolerance = config.convergence_tolerance;
 
   data.relaxation = config.SOR_relaxation;
+  data.wavefront = config.wavefront;
+  data.schedule = Level_Schedule();
 }
 
 template<>
 Convergence_Data Solver_Fixed_Point<Solver_Type::successive_over_relaxation, Solver_Fixed_Point_Sor_Data>::solve_system(
 const Matrix_Sparse& a_matrix, Vector_Dense<Scalar, 0>& x_vector, const Vector_Dense<Scalar, 0>& b_vector) {
+  update_schedule(a_matrix, data);
   Convergence_Data convergence_data = Convergence_Data();
   while(!data.limits.is_converged(convergence_data)) {
-    forward_sweep(a_matrix, x_vector, x_vector, b_vector, 1.5);
+    forward_sweep_in_place(a_matrix, data, x_vector, b_vector, 1.5);
     convergence_data.update(a_matrix, x_vector, b_vector);
   }
 
   return convergence_data;
 }
 
+template<>
+void Solver_Fixed_Point<Solver_Type::asynchronous_relaxation, Solver_Fixed_Point_Asynchronous_Data>::initialise_solver(
+Solver_Config config) {
+  data.limits.min_iterations = config.minimum_iterations;
+  data.limits.max_iteration = config.maximum_iterations;
+  data.limits.tolerance = config.convergence_tolerance;
+}
+
+/**
+ * @details Asynchronous (chaotic) relaxation. The rows are split into contiguous blocks, one per thread, and each thread
+ * sweeps its block repeatedly, Gauss-Seidel like within the block, without ever waiting on the other threads. Values of
+ * rows owned by other threads are read through relaxed atomics, i.e. whatever value is latest visible, so no barrier or
+ * lock is required. For the usual class of systems (e.g. diagonally dominant M-matrices) the iteration converges
+ * regardless of the order in which the updates become visible.
+ *
+ * After each sweep a thread publishes the squared residual of its block (evaluated during the sweep) to its own slot.
+ * Summing the slots gives a lock-free, slightly stale, estimate of the global residual, which any thread may use to
+ * raise the stop flag. Once all threads have stopped the residuals are recomputed exactly, normalised to the residual of
+ * the initial guess, and if the stale estimate stopped the threads early the sweeps resume. The iteration count
+ * reported is the largest number of sweeps of any block.
+ */
+template<>
+Convergence_Data Solver_Fixed_Point<Solver_Type::asynchronous_relaxation, Solver_Fixed_Point_Asynchronous_Data>::
+solve_system(const Matrix_Sparse& a_matrix, Vector_Dense<Scalar, 0>& x_vector, const Vector_Dense<Scalar, 0>& b_vector) {
+
+  Convergence_Data convergence_data = Convergence_Data();
+  std::tie(convergence_data.residual_0, convergence_data.residual_max_0) =
+  compute_residual(a_matrix, x_vector, b_vector);
+  const std::size_t size = a_matrix.size_row();
+  const Scalar tolerance_squared = std::pow(data.limits.tolerance * convergence_data.residual_0, 2) * size;
+  const std::size_t number_thread =
+  std::min(parallel_thread_count(), std::max<std::size_t>(size / std::max<std::size_t>(data.block_size, 1), 1));
+
+  // One cache line per slot, to avoid false sharing of the published residuals.
+  struct alignas(64) Residual_Slot {
+    std::atomic<Scalar> value{scalar_max};
+  };
+  std::vector<Residual_Slot> block_residual(number_thread);
+  std::vector<std::size_t> block_iteration(number_thread, 0);
+  std::atomic<bool> stop{false};
+
+  // The estimate is stale, so is verified against the exact residual once all threads have joined, resuming if needed.
+  while(true) {
+    parallel_region(number_thread, [&](const std::size_t i_thread, const std::size_t number_thread) {
+      const auto [i_begin, i_end] = parallel_block(size, i_thread, number_thread);
+      std::size_t& iteration = block_iteration[i_thread];
+      while(!stop.load(std::memory_order_relaxed) && iteration < data.limits.max_iteration) {
+        Scalar residual_squared = 0;
+        FOR(i_row, i_begin, i_end) {
+          Scalar offs_row_dot = 0;
+          FOR_ITER(column_iter, a_matrix[i_row]) {
+            if(column_iter.i_column() == i_row) continue;
+            offs_row_dot +=
+            *column_iter * std::atomic_ref<Scalar>(x_vector[column_iter.i_column()]).load(std::memory_order_relaxed);
+          }
+          std::atomic_ref<Scalar> x_row(x_vector[i_row]);
+          const Scalar diagonal = a_matrix[i_row][i_row];
+          const Scalar x_update = (b_vector[i_row] - offs_row_dot) / diagonal;
+          residual_squared += std::pow(diagonal * (x_update - x_row.load(std::memory_order_relaxed)), 2);
+          x_row.store(x_update, std::memory_order_relaxed);
+        }
+        ++iteration;
+        block_residual[i_thread].value.store(residual_squared, std::memory_order_relaxed);
+
+        if(iteration < data.limits.min_iterations) continue;
+        Scalar estimate = 0;
+        FOR_EACH_REF(slot, block_residual) estimate += slot.value.load(std::memory_order_relaxed);
+        if(estimate <= tolerance_squared) stop.store(true, std::memory_order_relaxed);
+      }
+    });
+
+    std::tie(convergence_data.residual, convergence_data.residual_max) = compute_residual(a_matrix, x_vector, b_vector);
+    convergence_data.residual_normalised = convergence_data.residual / convergence_data.residual_0;
+    convergence_data.residual_max_normalised = convergence_data.residual_max / convergence_data.residual_max_0;
+    convergence_data.iteration = *std::max_element(block_iteration.begin(), block_iteration.end());
+    convergence_data.converged = convergence_data.residual_normalised <= data.limits.tolerance &&
+                                 convergence_data.residual_max_normalised <= 10.0 * data.limits.tolerance;
+    if(convergence_data.converged || convergence_data.iteration >= data.limits.max_iteration) break;
+    stop.store(false, std::memory_order_relaxed);
+    FOR_EACH_REF(slot, block_residual) slot.value.store(scalar_max, std::memory_order_relaxed);
+  }
+  convergence_data.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                    convergence_data.start_time);
+  return convergence_data;
+}
+
 }  // namespace Disa
@@ -0,0 +1,377 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// File Name: solver_krylov.cpp
+// Description: Contains the definitions of the Krylov subspace iterative solvers.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#include "solver_krylov.hpp"
+#include "matrix_dense.hpp"
+#include "matrix_sparse.hpp"
+#include "scalar.hpp"
+#include "vector_dense.hpp"
+#include "vector_operators.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Disa {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Dense Kernels
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Computes y = Ax, for a sparse matrix A, without allocating y.
+ * @param[in] a_matrix The sparse matrix, A.
+ * @param[in] x_vector The vector, x.
+ * @param[out] y_vector The result, y, must be pre-sized.
+ */
+inline void multiply(const Matrix_Sparse& a_matrix, const Vector_Dense<Scalar, 0>& x_vector,
+                     Vector_Dense<Scalar, 0>& y_vector) {
+  FOR(i_row, a_matrix.size_row()) {
+    Scalar value = 0;
+    FOR_ITER(column_iter, a_matrix[i_row]) value += *column_iter * x_vector[column_iter.i_column()];
+    y_vector[i_row] = value;
+  }
+}
+
+/**
+ * @brief In place Cholesky factorisation, A = LL^T, of a small dense symmetric positive definite matrix.
+ * @param[in,out] matrix The matrix, A, on entry, the lower triangular factor L on exit (upper part is untouched).
+ * @return The index of the first column with a non-positive pivot, or the size of the matrix if successful.
+ */
+inline std::size_t cholesky_factorise(Matrix_Dense<Scalar, 0, 0>& matrix) {
+  Scalar scale = default_absolute;
+  FOR(i_row, matrix.size_row()) scale = std::max(scale, std::abs(matrix[i_row][i_row]));
+  FOR(i_column, matrix.size_row()) {
+    Scalar diagonal = matrix[i_column][i_column];
+    FOR(i_inner, i_column) diagonal -= matrix[i_column][i_inner] * matrix[i_column][i_inner];
+    if(diagonal <= default_relative * scale) return i_column;
+    diagonal = std::sqrt(diagonal);
+    matrix[i_column][i_column] = diagonal;
+    FOR(i_row, i_column + 1, matrix.size_row()) {
+      Scalar value = matrix[i_row][i_column];
+      FOR(i_inner, i_column) value -= matrix[i_row][i_inner] * matrix[i_column][i_inner];
+      matrix[i_row][i_column] = value / diagonal;
+    }
+  }
+  return matrix.size_row();
+}
+
+/**
+ * @brief Solves LL^T x = b in place, given the Cholesky factor L.
+ * @param[in] factor The lower triangular factor, L.
+ * @param[in,out] vector The constant, b, on entry, the solution, x, on exit.
+ */
+inline void cholesky_solve(const Matrix_Dense<Scalar, 0, 0>& factor, Vector_Dense<Scalar, 0>& vector) {
+  FOR(i_row, factor.size_row()) {
+    FOR(i_column, i_row) vector[i_row] -= factor[i_row][i_column] * vector[i_column];
+    vector[i_row] /= factor[i_row][i_row];
+  }
+  for(std::size_t i_row = factor.size_row(); i_row-- > 0;) {
+    FOR(i_column, i_row + 1, factor.size_row()) vector[i_row] -= factor[i_column][i_row] * vector[i_column];
+    vector[i_row] /= factor[i_row][i_row];
+  }
+}
+
+/**
+ * @brief Computes the eigen-decomposition of a small dense symmetric matrix using cyclic Jacobi rotations.
+ * @param[in,out] matrix The symmetric matrix on entry, on exit its diagonal holds the eigenvalues.
+ * @param[out] eigen_vector The eigenvectors, stored column wise.
+ */
+inline void symmetric_eigen(Matrix_Dense<Scalar, 0, 0>& matrix, Matrix_Dense<Scalar, 0, 0>& eigen_vector) {
+  const std::size_t size = matrix.size_row();
+  eigen_vector.resize(size, size);
+  FOR(i_row, size) FOR(i_column, size) eigen_vector[i_row][i_column] = i_row == i_column ? 1.0 : 0.0;
+
+  FOR(i_sweep, 64) {
+    Scalar off_diagonal = 0;
+    Scalar diagonal = 0;
+    FOR(i_row, size) {
+      diagonal += matrix[i_row][i_row] * matrix[i_row][i_row];
+      FOR(i_column, i_row + 1, size) off_diagonal += matrix[i_row][i_column] * matrix[i_row][i_column];
+    }
+    if(off_diagonal <= default_absolute * default_absolute * diagonal) break;
+
+    FOR(i_p, size) {
+      FOR(i_q, i_p + 1, size) {
+        if(matrix[i_p][i_q] == 0.0) continue;
+        const Scalar theta = (matrix[i_q][i_q] - matrix[i_p][i_p]) / (2.0 * matrix[i_p][i_q]);
+        const Scalar tangent = std::copysign(1.0, theta) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        const Scalar cosine = 1.0 / std::sqrt(tangent * tangent + 1.0);
+        const Scalar sine = tangent * cosine;
+        FOR(i_k, size) {
+          const Scalar kp = matrix[i_k][i_p];
+          const Scalar kq = matrix[i_k][i_q];
+          matrix[i_k][i_p] = cosine * kp - sine * kq;
+          matrix[i_k][i_q] = sine * kp + cosine * kq;
+        }
+        FOR(i_k, size) {
+          const Scalar pk = matrix[i_p][i_k];
+          const Scalar qk = matrix[i_q][i_k];
+          matrix[i_p][i_k] = cosine * pk - sine * qk;
+          matrix[i_q][i_k] = sine * pk + cosine * qk;
+        }
+        FOR(i_k, size) {
+          const Scalar kp = eigen_vector[i_k][i_p];
+          const Scalar kq = eigen_vector[i_k][i_q];
+          eigen_vector[i_k][i_p] = cosine * kp - sine * kq;
+          eigen_vector[i_k][i_q] = sine * kp + cosine * kq;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Forms the Gram matrix G_ij = u_i . v_j of two sets of vectors.
+ * @param[in] vector_u The first set of vectors, u.
+ * @param[in] vector_v The second set of vectors, v.
+ * @return The symmetrised Gram matrix.
+ */
+inline Matrix_Dense<Scalar, 0, 0> gram_matrix(const std::vector<Vector_Dense<Scalar, 0>>& vector_u,
+                                              const std::vector<Vector_Dense<Scalar, 0>>& vector_v) {
+  Matrix_Dense<Scalar, 0, 0> gram;
+  gram.resize(vector_u.size(), vector_u.size());
+  FOR(i_row, vector_u.size()) FOR(i_column, i_row, vector_u.size()) {
+    const Scalar value =
+    0.5 * (dot_product(vector_u[i_row], vector_v[i_column]) + dot_product(vector_u[i_column], vector_v[i_row]));
+    gram[i_row][i_column] = value;
+    gram[i_column][i_row] = value;
+  }
+  return gram;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Subspace Recycling
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Builds the A-Gram matrix, W^T A W, of the recycled space and factorises it, dropping dependent vectors.
+ * @param[in] a_matrix The coefficient matrix, A.
+ * @param[in,out] recycle The recycled basis, W, vectors which are (numerically) dependent are removed.
+ * @param[out] recycle_image The image of the recycled basis, AW.
+ * @param[out] factor The Cholesky factor of W^T A W.
+ */
+inline void recycle_factorise(const Matrix_Sparse& a_matrix, std::vector<Vector_Dense<Scalar, 0>>& recycle,
+                              std::vector<Vector_Dense<Scalar, 0>>& recycle_image, Matrix_Dense<Scalar, 0, 0>& factor) {
+  recycle_image.resize(recycle.size());
+  FOR(i_recycle, recycle.size()) {
+    recycle_image[i_recycle].resize(a_matrix.size_row());
+    multiply(a_matrix, recycle[i_recycle], recycle_image[i_recycle]);
+  }
+
+  while(!recycle.empty()) {
+    factor = gram_matrix(recycle, recycle_image);
+    const std::size_t i_fail = cholesky_factorise(factor);
+    if(i_fail == recycle.size()) return;
+    recycle.erase(recycle.begin() + static_cast<long>(i_fail));
+    recycle_image.erase(recycle_image.begin() + static_cast<long>(i_fail));
+  }
+}
+
+/**
+ * @brief Computes mu = (W^T A W)^-1 (AW)^T v, the coefficients of the A-orthogonal projection of v onto W.
+ * @param[in] recycle_image The image of the recycled basis, AW.
+ * @param[in] factor The Cholesky factor of W^T A W.
+ * @param[in] vector The vector to project, v.
+ * @return The projection coefficients, mu.
+ */
+inline Vector_Dense<Scalar, 0> recycle_coefficient(const std::vector<Vector_Dense<Scalar, 0>>& recycle_image,
+                                                   const Matrix_Dense<Scalar, 0, 0>& factor,
+                                                   const Vector_Dense<Scalar, 0>& vector) {
+  Vector_Dense<Scalar, 0> coefficient;
+  coefficient.resize(recycle_image.size());
+  FOR(i_recycle, recycle_image.size()) coefficient[i_recycle] = dot_product(recycle_image[i_recycle], vector);
+  cholesky_solve(factor, coefficient);
+  return coefficient;
+}
+
+/**
+ * @details Refreshes the recycled basis using a Rayleigh-Ritz procedure over Z = [W, P], where P are the search
+ * directions retained from the last solve. The generalised eigen-problem (Z^T A Z) y = theta (Z^T Z) y is reduced to a
+ * standard one via the Cholesky factor L of Z^T A Z, the columns of Z being (close to) A-orthogonal this is well
+ * conditioned. The Ritz vectors for the smallest theta (largest 1/theta) form the new, A-orthonormal, basis.
+ */
+inline void recycle_update(std::vector<Vector_Dense<Scalar, 0>>& recycle,
+                           std::vector<Vector_Dense<Scalar, 0>>& recycle_image, Solver_Krylov_Data& data) {
+
+  // Assemble Z and AZ, removing dependent columns until Z^T A Z is positive definite.
+  std::vector<Vector_Dense<Scalar, 0>> basis = std::move(recycle);
+  std::vector<Vector_Dense<Scalar, 0>> basis_image = std::move(recycle_image);
+  std::move(data.direction.begin(), data.direction.end(), std::back_inserter(basis));
+  std::move(data.direction_image.begin(), data.direction_image.end(), std::back_inserter(basis_image));
+  data.direction.clear();
+  data.direction_image.clear();
+  recycle.clear();
+  recycle_image.clear();
+
+  Matrix_Dense<Scalar, 0, 0> factor;
+  while(!basis.empty()) {
+    factor = gram_matrix(basis, basis_image);
+    const std::size_t i_fail = cholesky_factorise(factor);
+    if(i_fail == basis.size()) break;
+    basis.erase(basis.begin() + static_cast<long>(i_fail));
+    basis_image.erase(basis_image.begin() + static_cast<long>(i_fail));
+  }
+  if(basis.empty()) return;
+  const std::size_t size = basis.size();
+
+  // M = L^-1 (Z^T Z) L^-T, formed column wise via two triangular solves.
+  Matrix_Dense<Scalar, 0, 0> reduced = gram_matrix(basis, basis);
+  const auto lower_solve = [&](Matrix_Dense<Scalar, 0, 0>& matrix) {
+    FOR(i_column, size) FOR(i_row, size) {
+      FOR(i_inner, i_row) matrix[i_row][i_column] -= factor[i_row][i_inner] * matrix[i_inner][i_column];
+      matrix[i_row][i_column] /= factor[i_row][i_row];
+    }
+  };
+  lower_solve(reduced);
+  FOR(i_row, size) FOR(i_column, i_row + 1, size) std::swap(reduced[i_row][i_column], reduced[i_column][i_row]);
+  lower_solve(reduced);
+
+  Matrix_Dense<Scalar, 0, 0> eigen_vector;
+  symmetric_eigen(reduced, eigen_vector);
+  std::vector<std::size_t> order(size);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](std::size_t i_0, std::size_t i_1) { return reduced[i_0][i_0] > reduced[i_1][i_1]; });
+
+  // Ritz vectors, w = Z L^-T v.
+  FOR(i_recycle, std::min(data.recycle_size, size)) {
+    Vector_Dense<Scalar, 0> coefficient;
+    coefficient.resize(size);
+    FOR(i_row, size) coefficient[i_row] = eigen_vector[i_row][order[i_recycle]];
+    for(std::size_t i_row = size; i_row-- > 0;) {
+      FOR(i_column, i_row + 1, size) coefficient[i_row] -= factor[i_column][i_row] * coefficient[i_column];
+      coefficient[i_row] /= factor[i_row][i_row];
+    }
+    recycle.emplace_back();
+    recycle.back().resize(basis.front().size(), 0.0);
+    FOR(i_basis, size) FOR(i_row, basis[i_basis].size()) {
+      recycle.back()[i_row] += coefficient[i_basis] * basis[i_basis][i_row];
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Conjugate Gradient
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<>
+void Solver_Krylov<Solver_Type::conjugate_gradient, Solver_Krylov_Data>::initialise_solver(Solver_Config config) {
+  data.limits.min_iterations = config.minimum_iterations;
+  data.limits.max_iteration = config.maximum_iterations;
+  data.limits.tolerance = config.convergence_tolerance;
+
+  data.recycle_size = config.recycle_size;
+  recycle_clear();
+}
+
+/**
+ * @details Deflated conjugate gradient (Saad, Yeung, Erhel and Guyomarc'h). With W the recycled basis, the initial
+ * guess is corrected such that the residual is orthogonal to W, and each search direction is made A-orthogonal to W,
+ *
+ * p_{j+1} = beta_j p_j + r_{j+1} - W (W^T A W)^-1 (AW)^T r_{j+1}.
+ *
+ * Without a recycled basis this reduces to the standard method. The first recycle_size search directions are retained
+ * and used, once converged, to refresh the recycled basis for the next solve.
+ */
+template<>
+Convergence_Data Solver_Krylov<Solver_Type::conjugate_gradient, Solver_Krylov_Data>::solve_system(
+const Matrix_Sparse& a_matrix, Vector_Dense<Scalar, 0>& x_vector, const Vector_Dense<Scalar, 0>& b_vector) {
+
+  ASSERT_DEBUG(a_matrix.size_row() == a_matrix.size_column(), "Matrix must be square.");
+  ASSERT_DEBUG(a_matrix.size_row() == x_vector.size() && a_matrix.size_row() == b_vector.size(),
+               "Matrix-vector size mismatch.");
+  const std::size_t size = a_matrix.size_row();
+
+  // Invalidate the recycled space if the pattern has changed, it was built for a different system.
+  const std::size_t signature = pattern_signature(a_matrix);
+  if(signature != data.signature) {
+    recycle_clear();
+    data.signature = signature;
+  }
+
+  // Setup the deflation space for this system.
+  std::vector<Vector_Dense<Scalar, 0>> recycle_image;
+  Matrix_Dense<Scalar, 0, 0> factor;
+  recycle_factorise(a_matrix, data.recycle, recycle_image, factor);
+
+  // Initial residual, corrected such that W^T r = 0.
+  const Vector_Dense<Scalar, 0> x_guess = x_vector;
+  Vector_Dense<Scalar, 0> residual;
+  Vector_Dense<Scalar, 0> image;
+  residual.resize(size);
+  image.resize(size);
+  multiply(a_matrix, x_vector, image);
+  FOR(i_row, size) residual[i_row] = b_vector[i_row] - image[i_row];
+  if(!data.recycle.empty()) {
+    Vector_Dense<Scalar, 0> coefficient;
+    coefficient.resize(data.recycle.size());
+    FOR(i_recycle, data.recycle.size()) coefficient[i_recycle] = dot_product(data.recycle[i_recycle], residual);
+    cholesky_solve(factor, coefficient);
+    FOR(i_recycle, data.recycle.size()) FOR(i_row, size) {
+      x_vector[i_row] += coefficient[i_recycle] * data.recycle[i_recycle][i_row];
+      residual[i_row] -= coefficient[i_recycle] * recycle_image[i_recycle][i_row];
+    }
+  }
+
+  // The first direction, A-orthogonal to W.
+  Vector_Dense<Scalar, 0> direction = residual;
+  const auto deflate = [&]() {
+    if(data.recycle.empty()) return;
+    const Vector_Dense<Scalar, 0> mu = recycle_coefficient(recycle_image, factor, residual);
+    FOR(i_recycle, data.recycle.size()) FOR(i_row, size) {
+      direction[i_row] -= mu[i_recycle] * data.recycle[i_recycle][i_row];
+    }
+  };
+  deflate();
+  data.direction.clear();
+  data.direction_image.clear();
+
+  // Normalise against the initial guess, so a deflated (better) start is not penalised.
+  Scalar residual_dot = dot_product(residual, residual);
+  Convergence_Data convergence_data = Convergence_Data();
+  std::tie(convergence_data.residual_0, convergence_data.residual_max_0) = compute_residual(a_matrix, x_guess, b_vector);
+  while(!data.limits.is_converged(convergence_data)) {
+    multiply(a_matrix, direction, image);
+    const Scalar curvature = dot_product(direction, image);
+    if(!(curvature > 0.0) || residual_dot == 0.0) break;  // Exact solution, or A is not positive definite.
+
+    const Scalar alpha = residual_dot / curvature;
+    FOR(i_row, size) {
+      x_vector[i_row] += alpha * direction[i_row];
+      residual[i_row] -= alpha * image[i_row];
+    }
+    if(data.direction.size() < data.recycle_size) {
+      data.direction.push_back(direction);
+      data.direction_image.push_back(image);
+    }
+    convergence_data.update(a_matrix, x_vector, b_vector);
+
+    const Scalar residual_dot_new = dot_product(residual, residual);
+    const Scalar beta = residual_dot_new / residual_dot;
+    residual_dot = residual_dot_new;
+    FOR(i_row, size) direction[i_row] = beta * direction[i_row] + residual[i_row];
+    deflate();
+  }
+
+  if(data.recycle_size) recycle_update(data.recycle, recycle_image, data);
+  return convergence_data;
+}
+
+}  // namespace Disa
@@ -687,6 +687,26 @@ TEST(test_matrix_sparse, matrix_vector_multiplication) {
   EXPECT_DEATH(matrix * static_vector_incorrect, "./*");
 }
 
+TEST(test_matrix_sparse, multiply_row_range) {
+  Matrix_Sparse matrix({0, 1, 4, 5}, {1, 0, 1, 2, 2}, {3.0, -4.0, 5.0, -2.0, 7.0}, 3);
+  Vector_Dense<Scalar, 0> vector = {-1.0, 2.0, 3.0};
+  Vector_Dense<Scalar, 0> result = {1.0, 1.0, 1.0};
+
+  // Only the rows in range are written, and the parts combine to the full product.
+  multiply_row_range(matrix, vector, result, {1, 3});
+  EXPECT_DOUBLE_EQ(result[0], 1.0);
+  EXPECT_DOUBLE_EQ(result[1], 8.0);
+  EXPECT_DOUBLE_EQ(result[2], 21.0);
+  multiply_row_range(matrix, vector, result, {0, 1});
+  const Vector_Dense<Scalar, 0> product = matrix * vector;
+  FOR(i_row, product.size()) EXPECT_DOUBLE_EQ(result[i_row], product[i_row]);
+  multiply_row_range(matrix, vector, result, {2, 2});
+  EXPECT_DOUBLE_EQ(result[2], 21.0);
+
+  EXPECT_DEATH(multiply_row_range(matrix, vector, result, {2, 4}), "./*");
+  EXPECT_DEATH(multiply_row_range(matrix, Vector_Dense<Scalar, 2>(), result, {0, 1}), "./*");
+}
+
 TEST(test_matrix_sparse, matrix_matrix_addition) {
   Matrix_Sparse identity({0, 1, 2, 3}, {0, 1, 2}, {1.0, 1.0, 1.0}, 3);
   Matrix_Sparse matrix({0, 1, 2, 3}, {2, 1, 0}, {3.0, -4.0, 5.0}, 3);
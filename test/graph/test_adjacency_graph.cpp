@@ -21,8 +21,12 @@
 
 #include "adjacency_graph.hpp"
 #include "generator.hpp"
+#include "parallel.hpp"
 #include "gtest/gtest.h"
 
+#include <numeric>
+#include <random>
+
 using namespace Disa;
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -80,6 +84,63 @@ TEST(test_adjacency_graph, edge_list_construction) {
   EXPECT_EQ(graph[7][2], 6);
 }
 
+TEST(test_adjacency_graph, bulk_construction) {
+
+  // Compares two graphs vertex by vertex, there is no equality operator.
+  const auto expect_equal = [](const auto& graph_0, const auto& graph_1) {
+    ASSERT_EQ(graph_0.size_vertex(), graph_1.size_vertex());
+    EXPECT_EQ(graph_0.size_edge(), graph_1.size_edge());
+    FOR(i_vertex, graph_0.size_vertex()) {
+      EXPECT_TRUE(std::ranges::equal(graph_0[i_vertex], graph_1[i_vertex])) << "vertex " << i_vertex;
+    }
+  };
+
+  // Shuffled, reversed and repeated edges give the same graph as inserting one at a time.
+  std::vector<Edge> edge;
+  FOR(i_vertex, 20) FOR(i_step, 1, 4) edge.emplace_back((i_vertex * 7) % 23, (i_vertex * 7 + i_step * 5) % 23);
+  std::vector<Edge> edge_repeated(edge);
+  FOR_EACH(pair, edge) edge_repeated.emplace_back(pair.second, pair.first);
+  Adjacency_Graph<false> inserted;
+  Adjacency_Graph<true> inserted_directed;
+  FOR_EACH(pair, edge) {
+    inserted.insert(pair);
+    inserted_directed.insert(pair);
+  }
+  expect_equal(Adjacency_Graph<false>(edge_repeated), inserted);
+  expect_equal(Adjacency_Graph<true>(edge), inserted_directed);
+  expect_equal(Adjacency_Graph<false>({{0, 1}, {2, 1}, {1, 0}, {2, 1}}), Adjacency_Graph<false>({{0, 1}, {1, 2}}));
+
+  // The minimum number of vertices pads isolated vertices, but never truncates.
+  EXPECT_EQ(Adjacency_Graph<false>(edge, 30).size_vertex(), 30);
+  EXPECT_EQ(Adjacency_Graph<false>(edge, 2).size_vertex(), inserted.size_vertex());
+  EXPECT_TRUE(Adjacency_Graph<false>(std::span<const Edge>()).empty());
+
+  // CSR input, with an asymmetric pattern, a diagonal and a repeated entry.
+  const std::vector<std::size_t> offset = {0, 2, 4, 5, 5};
+  const std::vector<std::size_t> adjacency = {0, 1, 1, 2, 3};
+  const Adjacency_Graph<false> graph(offset, adjacency);
+  expect_equal(graph, Adjacency_Graph<false>({{0, 1}, {1, 2}, {2, 3}}));
+  const Adjacency_Graph<true> graph_directed(offset, adjacency);
+  expect_equal(graph_directed, Adjacency_Graph<true>({{0, 1}, {1, 2}, {2, 3}}));
+
+  // Generated graphs match their insertion built equivalent, and the thread count has no effect.
+  const std::size_t number_thread = parallel_thread_count();
+  parallel_thread_count_set(4);
+  const Adjacency_Graph<false> structured = create_graph_structured<false>(48);
+  parallel_thread_count_set(number_thread);
+  Adjacency_Graph<false> structured_inserted;
+  FOR(i_vertex, structured.size_vertex()) {
+    FOR_EACH(i_adjacent, structured[i_vertex]) structured_inserted.insert({i_vertex, i_adjacent});
+  }
+  expect_equal(structured, structured_inserted);
+  EXPECT_EQ(structured.size_edge(), 2 * 48 * 47);
+
+  // death tests.
+  EXPECT_DEATH(Adjacency_Graph<false>(std::vector<std::size_t>{}, adjacency), "./*");
+  EXPECT_DEATH(Adjacency_Graph<false>(std::vector<std::size_t>{0, 2}, adjacency), "./*");
+  EXPECT_DEATH(Adjacency_Graph<false>(std::vector<std::size_t>{0, 1}, std::vector<std::size_t>{1}), "./*");
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Element Access
 // ---------------------------------------------------------------------------------------------------------------------
@@ -653,3 +714,89 @@ TEST(test_adjacency_graph, reorder_undirected) {
   EXPECT_EQ(graph[1][0], 0);
   EXPECT_EQ(graph[1][1], 2);
 }
+
+TEST(test_adjacency_graph, reorder_parallel) {
+
+  // The parallel prefix sum matches the serial sum.
+  const std::size_t number_thread = parallel_thread_count();
+  parallel_thread_count_set(4);
+  std::vector<std::size_t> value(1001, 1);
+  parallel_partial_sum(value, 16);
+  std::vector<std::size_t> expected(1001);
+  std::iota(expected.begin(), expected.end(), 1);
+  EXPECT_EQ(value, expected);
+
+  // Reordering with any number of threads matches building the permuted graph from its edges.
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(64);
+  std::vector<std::size_t> permutation(graph.size_vertex());
+  std::iota(permutation.begin(), permutation.end(), 0);
+  std::shuffle(permutation.begin(), permutation.end(), std::mt19937_64(42));
+  std::vector<Edge> edge;
+  FOR(i_vertex, graph.size_vertex()) {
+    FOR_EACH(i_adjacent, graph[i_vertex]) edge.emplace_back(permutation[i_vertex], permutation[i_adjacent]);
+  }
+  const Adjacency_Graph<false> expected_graph(edge);
+  const auto expect_equal = [](const Adjacency_Graph<false>& graph_0, const Adjacency_Graph<false>& graph_1) {
+    ASSERT_EQ(graph_0.size_vertex(), graph_1.size_vertex());
+    FOR(i_vertex, graph_0.size_vertex()) EXPECT_TRUE(std::ranges::equal(graph_0[i_vertex], graph_1[i_vertex]));
+  };
+  for(const std::size_t thread : {std::size_t(1), std::size_t(4)}) {
+    parallel_thread_count_set(thread);
+    Adjacency_Graph<false> reordered = graph;
+    const Adjacency_Graph<false> old_graph = reordered.reorder(permutation);
+    expect_equal(reordered, expected_graph);
+    expect_equal(old_graph, graph);
+  }
+  parallel_thread_count_set(number_thread);
+}
+
+TEST(test_adjacency_graph, hash) {
+
+  // Equal content gives equal hashes, all empty graphs hash to zero.
+  const Adjacency_Graph<false> square({{0, 1}, {1, 2}, {2, 3}, {0, 3}});
+  Adjacency_Graph<false> graph({{0, 1}, {1, 2}, {2, 3}, {0, 3}});
+  EXPECT_EQ(graph.hash(), square.hash());
+  EXPECT_EQ(std::hash<Adjacency_Graph<false>>{}(graph), square.hash());
+  EXPECT_EQ(Adjacency_Graph<false>().hash(), 0);
+  EXPECT_NE(Adjacency_Graph<true>({{0, 1}, {1, 0}}).hash(), Adjacency_Graph<false>({{0, 1}}).hash());
+
+  // Same sizes and end degrees, but a flipped edge, which the sizes alone cannot tell apart.
+  const Adjacency_Graph<false> flipped({{0, 1}, {1, 3}, {2, 3}, {0, 2}});
+  EXPECT_NE(flipped.hash(), square.hash());
+
+  // Modifiers invalidate the cached hash.
+  graph.insert({0, 2});
+  EXPECT_EQ(graph.hash(), Adjacency_Graph<false>({{0, 1}, {1, 2}, {2, 3}, {0, 3}, {0, 2}}).hash());
+  graph.erase_if([](const std::size_t i_vertex) { return i_vertex == 3; });
+  EXPECT_EQ(graph.hash(), Adjacency_Graph<false>({{0, 1}, {1, 2}, {0, 2}}).hash());
+  graph.resize(4);
+  Adjacency_Graph<false> expected({{0, 1}, {1, 2}, {0, 2}});
+  expected.resize(4);
+  EXPECT_EQ(graph.hash(), expected.hash());
+  EXPECT_NE(graph.hash(), Adjacency_Graph<false>({{0, 1}, {1, 2}, {0, 2}}).hash());
+  graph[1][0] = 2;  // Non-const access may change the content.
+  EXPECT_NE(graph.hash(), expected.hash());
+  graph.clear();
+  EXPECT_EQ(graph.hash(), 0);
+
+  // Copies keep, swaps exchange and reorders recompute the hash.
+  graph = square;
+  EXPECT_EQ(graph.hash(), square.hash());
+  graph.swap(expected);
+  EXPECT_EQ(expected.hash(), square.hash());
+  EXPECT_NE(graph.hash(), square.hash());
+  Adjacency_Graph<false> old_graph = expected.reorder({1, 0, 3, 2});
+  EXPECT_EQ(old_graph.hash(), square.hash());
+  EXPECT_EQ(expected.hash(), Adjacency_Graph<false>({{1, 0}, {0, 3}, {3, 2}, {1, 2}}).hash());
+  const Adjacency_Graph<false> moved(std::move(old_graph));
+  EXPECT_EQ(moved.hash(), square.hash());
+
+  // Larger graphs hash in several chunks, independent of the thread count.
+  const std::size_t number_thread = parallel_thread_count();
+  parallel_thread_count_set(1);
+  const std::size_t hash_structured = create_graph_structured<false>(48).hash();
+  parallel_thread_count_set(4);
+  EXPECT_EQ(create_graph_structured<false>(48).hash(), hash_structured);
+  parallel_thread_count_set(number_thread);
+  EXPECT_NE(create_graph_structured<false>(47).hash(), hash_structured);
+}
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------------------------------------------------
+//  MIT License
+//  Copyright (c) 2022 Bevan W.S. Jones
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+//  documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+//  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+//  Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+//  WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+//  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+//  OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ----------------------------------------------------------------------------------------------------------------------
+//  File Name: test_adjacency_graph_compressed.cpp
+//  Description: Unit tests for the compressed, read only, adjacency graph.
+// ----------------------------------------------------------------------------------------------------------------------
+
+#include "adjacency_graph_compressed.hpp"
+#include "generator.hpp"
+#include "graph_utilities.hpp"
+#include "gtest/gtest.h"
+
+using namespace Disa;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Adjacency_Graph_Compressed
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(test_adjacency_graph_compressed, construction) {
+
+  // Graphs with small and large (multi-byte) gaps, isolated vertices, and first neighbours both below and above.
+  std::vector<Edge> edge;
+  const std::size_t size = 5000;
+  FOR(i_vertex, std::size_t{1}, size - 10) {
+    edge.emplace_back(i_vertex, i_vertex + 1);
+    if(i_vertex % 3 == 0) edge.emplace_back(i_vertex, (i_vertex * 7919 + 13) % (size - 10));
+  }
+  std::erase_if(edge, [](const Edge& pair) { return pair.first == pair.second; });
+  const Adjacency_Graph<false> graph_undirected(edge, size);
+  const Adjacency_Graph<true> graph_directed(edge, size);
+
+  const auto expect_equal = [](const auto& graph, const auto& compressed) {
+    ASSERT_EQ(compressed.size_vertex(), graph.size_vertex());
+    EXPECT_EQ(compressed.size_edge(), graph.size_edge());
+    FOR(i_vertex, graph.size_vertex()) {
+      EXPECT_EQ(compressed.degree(i_vertex), graph.degree(i_vertex));
+      EXPECT_EQ(compressed[i_vertex].size(), graph[i_vertex].size());
+      EXPECT_EQ(compressed[i_vertex].empty(), graph[i_vertex].empty());
+      std::vector<std::size_t> adjacency;
+      FOR_EACH(i_adjacent, compressed[i_vertex]) adjacency.push_back(i_adjacent);
+      EXPECT_EQ(adjacency, std::vector<std::size_t>(graph[i_vertex].begin(), graph[i_vertex].end()));
+    }
+    EXPECT_EQ(compressed.decompress().hash(), graph.hash());
+  };
+  const Adjacency_Graph_Compressed<false> compressed_undirected(graph_undirected);
+  const Adjacency_Graph_Compressed<true> compressed_directed(graph_directed);
+  expect_equal(graph_undirected, compressed_undirected);
+  expect_equal(graph_directed, compressed_directed);
+  EXPECT_TRUE(compressed_undirected[0].empty());
+  EXPECT_TRUE(compressed_undirected[size - 1].empty());
+
+  // From a compressed row list.
+  std::vector<std::size_t> offset(graph_undirected.size_vertex() + 1, 0);
+  std::vector<std::size_t> adjacency;
+  FOR(i_vertex, graph_undirected.size_vertex()) {
+    adjacency.insert(adjacency.end(), graph_undirected[i_vertex].begin(), graph_undirected[i_vertex].end());
+    offset[i_vertex + 1] = adjacency.size();
+  }
+  expect_equal(graph_undirected, Adjacency_Graph_Compressed<false>(offset, adjacency));
+
+  // Empty graphs.
+  const Adjacency_Graph_Compressed<false> compressed_empty(Adjacency_Graph<false>{});
+  EXPECT_TRUE(compressed_empty.empty());
+  EXPECT_EQ(compressed_empty.size(), std::make_pair(std::size_t(0), std::size_t(0)));
+  EXPECT_TRUE(compressed_empty.decompress().empty());
+  EXPECT_DEATH((void)compressed_empty.at(0), "./*");
+}
+
+TEST(test_adjacency_graph_compressed, contains) {
+  const Adjacency_Graph<false> graph = create_graph_hybrid();
+  const Adjacency_Graph_Compressed<false> compressed(graph);
+  FOR(i_vertex, graph.size_vertex()) {
+    FOR(j_vertex, graph.size_vertex()) {
+      if(i_vertex == j_vertex) continue;
+      EXPECT_EQ(compressed.contains({i_vertex, j_vertex}), graph.contains({i_vertex, j_vertex}));
+    }
+  }
+  EXPECT_FALSE(compressed.contains({0, graph.size_vertex()}));
+}
+
+TEST(test_adjacency_graph_compressed, traversal) {
+
+  // The graph utilities run unchanged on the compressed graph.
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(64);
+  const Adjacency_Graph_Compressed<false> compressed(graph);
+  const std::size_t i_start = graph.size_vertex() / 2 + 5;
+  EXPECT_EQ(level_traversal(compressed, i_start), level_traversal(graph, i_start));
+  std::vector<std::size_t> level(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> level_compressed = level;
+  level[i_start] = level_compressed[i_start] = 0;
+  EXPECT_EQ(breadth_first_frontier(compressed, {i_start}, level_compressed),
+            breadth_first_frontier(graph, {i_start}, level));
+  EXPECT_EQ(level_compressed, level);
+  EXPECT_EQ(pseudo_peripheral_vertex(compressed), pseudo_peripheral_vertex(graph));
+
+  // A grid needs one byte per neighbour, plus the degree and offsets, against 8 bytes per neighbour and vertex.
+  const std::size_t size_uncompressed = sizeof(std::size_t) * (2 * graph.size_edge() + graph.size_vertex() + 1);
+  EXPECT_LT(3 * compressed.size_byte(), size_uncompressed);
+}
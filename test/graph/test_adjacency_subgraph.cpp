@@ -21,6 +21,7 @@
 
 #include "adjacency_subgraph.hpp"
 #include "generator.hpp"
+#include "graph_utilities.hpp"
 #include "gtest/gtest.h"
 
 using namespace Disa;
@@ -159,6 +160,22 @@ TEST(Adjacency_Subgraph, constructor_death) {
   EXPECT_DEATH(Adjacency_Subgraph(graph, {0, 1, 2, 3, 4}), "./*");
   EXPECT_DEATH(Adjacency_Subgraph(graph, {0, 0, 1}), "./*");
   EXPECT_DEATH(Adjacency_Subgraph(graph, {0, 5}), "./*");
+  EXPECT_DEATH(Adjacency_Subgraph(graph, {3, 0, 3}), "./*");
+}
+
+TEST(Adjacency_Subgraph, constructor_unsorted) {
+  Adjacency_Graph<false> graph = create_graph_structured<false>(3);
+
+  // Local vertices follow the given order, with the edges mapped accordingly.
+  Adjacency_Subgraph subgraph(graph, {4, 1, 8, 3});
+  ASSERT_EQ(subgraph.size_vertex(), 4);
+  EXPECT_EQ(subgraph.size_edge(), 2);
+  EXPECT_EQ(subgraph.local_global(0), 4);
+  EXPECT_EQ(subgraph.local_global(2), 8);
+  EXPECT_EQ(std::vector<std::size_t>(subgraph[0].begin(), subgraph[0].end()), (std::vector<std::size_t>{1, 3}));
+  EXPECT_EQ(std::vector<std::size_t>(subgraph[1].begin(), subgraph[1].end()), (std::vector<std::size_t>{0}));
+  EXPECT_TRUE(subgraph[2].empty());
+  EXPECT_EQ(std::vector<std::size_t>(subgraph[3].begin(), subgraph[3].end()), (std::vector<std::size_t>{0}));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -572,3 +589,93 @@ TEST(Adjacency_Subgraph, vertex_level) {
   EXPECT_EQ(subgraph.vertex_level((*i_global_local)[8]), 2);
   EXPECT_DEATH(subgraph.vertex_level(10) == 0, "./*");
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+// Batch Construction
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST(Adjacency_Subgraph, create_subgraph_list) {
+  Adjacency_Graph<false> graph = create_graph_structured<false>(8);
+
+  // Matches the individually constructed subgraphs, including their levels.
+  std::vector<std::size_t> vertex_subgraph(graph.size_vertex());
+  FOR(i_vertex, graph.size_vertex()) vertex_subgraph[i_vertex] = (i_vertex % 8) / 3 + (i_vertex / 32) * 3;
+  for(const std::size_t extra_levels : {0, 2}) {
+    const std::vector<Adjacency_Subgraph> subgraph_list = create_subgraph_list(graph, vertex_subgraph, 0, extra_levels);
+    ASSERT_EQ(subgraph_list.size(), 6);
+    FOR(i_subgraph, subgraph_list.size()) {
+      std::vector<std::size_t> vertex;
+      FOR(i_vertex, graph.size_vertex()) if(vertex_subgraph[i_vertex] == i_subgraph) vertex.push_back(i_vertex);
+      const Adjacency_Subgraph subgraph(graph, vertex, extra_levels);
+      const Adjacency_Subgraph& batch = subgraph_list[i_subgraph];
+      EXPECT_TRUE(batch.is_parent(graph));
+      ASSERT_EQ(batch.size_vertex(), subgraph.size_vertex());
+      EXPECT_EQ(batch.size_edge(), subgraph.size_edge());
+      FOR(i_local, batch.size_vertex()) {
+        EXPECT_EQ(batch.local_global(i_local), subgraph.local_global(i_local));
+        EXPECT_EQ(batch.vertex_level(i_local), subgraph.vertex_level(i_local));
+        EXPECT_TRUE(std::ranges::equal(batch[i_local], subgraph[i_local]));
+      }
+    }
+  }
+
+  // Trailing subgraphs may be empty.
+  const std::vector<Adjacency_Subgraph> subgraph_list = create_subgraph_list(graph, vertex_subgraph, 8);
+  ASSERT_EQ(subgraph_list.size(), 8);
+  EXPECT_TRUE(subgraph_list[7].empty());
+
+  // death tests.
+  EXPECT_DEATH(create_subgraph_list(graph, {0, 1}), "./*");
+  EXPECT_DEATH(create_subgraph_list(graph, vertex_subgraph, 4), "./*");
+}
+
+TEST(Adjacency_Subgraph, update_levels_list) {
+  Adjacency_Graph<false> graph = create_graph_structured<false>(12);
+  std::vector<std::size_t> vertex_subgraph(graph.size_vertex());
+  FOR(i_vertex, graph.size_vertex()) vertex_subgraph[i_vertex] = (i_vertex % 12) / 5 + (i_vertex / 48) * 3;
+  std::vector<Adjacency_Subgraph> subgraph_list = create_subgraph_list(graph, vertex_subgraph, 0, 1);
+
+  // Grows in stages to the same halo as a level traversal from the primary vertices, with all induced edges.
+  update_levels(graph, subgraph_list, 3);
+  FOR(i_subgraph, subgraph_list.size()) {
+    const Adjacency_Subgraph& subgraph = subgraph_list[i_subgraph];
+    std::queue<std::size_t> start;
+    std::vector<std::size_t> level(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+    FOR(i_vertex, graph.size_vertex()) {
+      if(vertex_subgraph[i_vertex] != i_subgraph) continue;
+      start.push(i_vertex);
+      level[i_vertex] = 0;
+    }
+    level_traversal(graph, start, level, 3);
+    std::vector<std::size_t> i_global_local(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+    std::size_t size_halo = 0;
+    FOR(i_vertex, graph.size_vertex()) size_halo += level[i_vertex] <= 3;
+    ASSERT_EQ(subgraph.size_vertex(), size_halo);
+    FOR(i_local, subgraph.size_vertex()) {
+      EXPECT_EQ(subgraph.vertex_level(i_local), level[subgraph.local_global(i_local)]);
+      i_global_local[subgraph.local_global(i_local)] = i_local;
+    }
+    FOR(i_local, subgraph.size_vertex()) {
+      std::vector<std::size_t> adjacency;
+      FOR_EACH(i_global, graph[subgraph.local_global(i_local)])
+      if(i_global_local[i_global] != std::numeric_limits<std::size_t>::max())
+        adjacency.push_back(i_global_local[i_global]);
+      std::sort(adjacency.begin(), adjacency.end());
+      EXPECT_TRUE(std::ranges::equal(subgraph[i_local], adjacency));
+    }
+  }
+
+  // Matches the serial update, and shrinks back.
+  std::vector<Adjacency_Subgraph> subgraph_serial = create_subgraph_list(graph, vertex_subgraph, 0, 1);
+  FOR_EACH_REF(subgraph, subgraph_serial) subgraph.update_levels(graph, 3);
+  FOR(i_subgraph, subgraph_list.size()) {
+    ASSERT_EQ(subgraph_list[i_subgraph].size_vertex(), subgraph_serial[i_subgraph].size_vertex());
+    FOR(i_local, subgraph_list[i_subgraph].size_vertex())
+    EXPECT_EQ(subgraph_list[i_subgraph].local_global(i_local), subgraph_serial[i_subgraph].local_global(i_local));
+  }
+  update_levels(graph, subgraph_list, 0);
+  FOR(i_subgraph, subgraph_list.size()) {
+    const auto size_primary = std::count(vertex_subgraph.begin(), vertex_subgraph.end(), i_subgraph);
+    EXPECT_EQ(subgraph_list[i_subgraph].size_vertex(), static_cast<std::size_t>(size_primary));
+  }
+}
@@ -23,9 +23,95 @@
 
 #include "generator.hpp"
 #include "graph_utilities.hpp"
+#include "parallel.hpp"
 
 using namespace Disa;
 
+TEST(test_graph_utilities, breadth_first_frontier) {
+
+  // Reference first-in first-out queue traversal, returning the visit order and levels.
+  const auto queue_traversal = [](const Adjacency_Graph<false>& graph, const std::size_t i_start) {
+    std::vector<std::size_t> order({i_start});
+    std::vector<std::size_t> level(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+    level[i_start] = 0;
+    FOR(i_order, graph.size_vertex()) {
+      if(i_order == order.size()) break;
+      FOR_EACH(i_adjacent, graph[order[i_order]]) {
+        if(level[i_adjacent] != std::numeric_limits<std::size_t>::max()) continue;
+        level[i_adjacent] = level[order[i_order]] + 1;
+        order.push_back(i_adjacent);
+      }
+    }
+    return std::make_pair(order, level);
+  };
+
+  // A grid (top-down only) and a denser graph with hubs, which switches to bottom-up, on 1 and 4 threads.
+  std::vector<Edge> edge;
+  const std::size_t size = 3000;
+  FOR(i_vertex, size) {
+    edge.emplace_back(i_vertex, (i_vertex * 7 + 1) % size);
+    edge.emplace_back(i_vertex, (i_vertex * 13 + 5) % size);
+    if(i_vertex % 100 != 0) edge.emplace_back(i_vertex, (i_vertex / 100) * 100);
+  }
+  std::erase_if(edge, [](const Edge& pair) { return pair.first == pair.second; });
+  const std::size_t number_thread = parallel_thread_count();
+  for(const auto& graph : {create_graph_structured<false>(48), Adjacency_Graph<false>(edge)}) {
+    for(const std::size_t i_start : {std::size_t(0), graph.size_vertex() / 2 + 3}) {
+      const auto [order, level] = queue_traversal(graph, i_start);
+      for(const std::size_t thread : {std::size_t(1), std::size_t(4)}) {
+        parallel_thread_count_set(thread);
+        std::vector<std::size_t> frontier_level(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+        frontier_level[i_start] = 0;
+        EXPECT_EQ(breadth_first_frontier(graph, {i_start}, frontier_level), order);
+        EXPECT_EQ(frontier_level, level);
+        EXPECT_EQ(level_traversal(graph, i_start), level);
+      }
+    }
+  }
+  parallel_thread_count_set(number_thread);
+
+  // Stopping at a level, and empty frontiers.
+  const Adjacency_Graph<false> line = create_graph_line<false>(6);
+  std::vector<std::size_t> level(line.size_vertex(), std::numeric_limits<std::size_t>::max());
+  level[2] = 0;
+  EXPECT_EQ(breadth_first_frontier(line, {2}, level, 1), std::vector<std::size_t>({2, 1, 3}));
+  EXPECT_TRUE(breadth_first_frontier(line, {}, level).empty());
+}
+
+TEST(test_graph_utilities, connected_components) {
+
+  // Reference labelling, traversing from the lowest unlabelled vertex.
+  const auto traversal_components = [](const Adjacency_Graph<false>& graph) {
+    std::vector<std::size_t> component(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+    std::size_t number_component = 0;
+    FOR(i_vertex, graph.size_vertex()) {
+      if(component[i_vertex] != std::numeric_limits<std::size_t>::max()) continue;
+      const std::vector<std::size_t> level = level_traversal(graph, i_vertex);
+      FOR(i_other, graph.size_vertex())
+      if(level[i_other] != std::numeric_limits<std::size_t>::max()) component[i_other] = number_component;
+      ++number_component;
+    }
+    return std::make_pair(number_component, component);
+  };
+
+  const std::size_t number_thread = parallel_thread_count();
+  for(const auto& graph : {create_graph_structured<false>(20), create_graph_disjoint(20, 7), create_graph_saad()}) {
+    const auto [number_component, component] = traversal_components(graph);
+    for(const std::size_t thread : {std::size_t(1), std::size_t(4)}) {
+      parallel_thread_count_set(thread);
+      std::vector<std::size_t> parallel_component;
+      EXPECT_EQ(connected_components(graph, parallel_component), number_component);
+      EXPECT_EQ(parallel_component, component);
+    }
+  }
+  parallel_thread_count_set(number_thread);
+
+  std::vector<std::size_t> component;
+  EXPECT_EQ(connected_components(create_graph_disjoint(20, 7), component), 2 + 400 - 100 + 7);
+  EXPECT_EQ(connected_components(Adjacency_Graph<false>(), component), 0);
+  EXPECT_TRUE(component.empty());
+}
+
 // Unit test for LevelTraversal using Google Test
 TEST(test_graph_utilities, level_traversal_single_start_vertex) {
   Adjacency_Graph<false> graph_saad = create_graph_saad();
@@ -104,6 +190,17 @@ TEST(test_graph_utilities, level_expansion) {
   std::vector<std::size_t>({1, 1, 2, 2, 2, 1, 1, 1, 2, 2, 1, 1, 1, 1, 2, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1});
   EXPECT_EQ(colors, hand_computed_answer);
 
+  // Disjoint graph, seeded in the first grid only, components without a seed go whole to the smallest color.
+  const Adjacency_Graph<false> disjoint = create_graph_disjoint(6, 2);
+  level_expansion(disjoint, {0, 70}, colors);
+  std::vector<std::size_t> color_size(2, 0);
+  FOR(i_vertex, disjoint.size_vertex()) {
+    ASSERT_LT(colors[i_vertex], 2);
+    ++color_size[colors[i_vertex]];
+    if(i_vertex % 2 == 1) FOR_EACH(i_adjacent, disjoint[i_vertex]) EXPECT_EQ(colors[i_adjacent], colors[i_vertex]);
+  }
+  EXPECT_LE(std::max(color_size[0], color_size[1]) - std::min(color_size[0], color_size[1]), 9);
+
   // Death test.
   EXPECT_DEATH(level_expansion(Adjacency_Graph<false>(), {6, 8, 16, 18}, colors), "./*");
   EXPECT_DEATH(level_expansion(graph, {}, colors), "./*");
@@ -127,6 +224,34 @@ TEST(test_graph_utilities, pseudo_peripheral_vertex) {
   EXPECT_DEATH(pseudo_peripheral_vertex(graph_saad, 16), "./*");
 }
 
+TEST(test_graph_utilities, pseudo_centre_vertex) {
+
+  // Exact centres of a path and a grid.
+  EXPECT_EQ(pseudo_centre_vertex(create_graph_line<false>(9)), 4);
+  EXPECT_EQ(pseudo_centre_vertex(create_graph_line<false>(9), 8), 4);
+  EXPECT_EQ(pseudo_centre_vertex(create_graph_structured<false>(5)), 12);
+
+  // On the Saad graph, the result is within one of the true minimum eccentricity.
+  const Adjacency_Graph<false> graph_saad = create_graph_saad();
+  std::vector<std::size_t> eccentricity(graph_saad.size_vertex());
+  FOR(i_vertex, graph_saad.size_vertex()) {
+    const std::vector<std::size_t> level = level_traversal(graph_saad, i_vertex);
+    eccentricity[i_vertex] = *std::max_element(level.begin(), level.end());
+  }
+  const std::size_t centre = pseudo_centre_vertex(graph_saad);
+  EXPECT_LE(eccentricity[centre], *std::min_element(eccentricity.begin(), eccentricity.end()) + 1);
+
+  // Only the component of the start vertex is searched, and isolated vertices are their own centre.
+  const Adjacency_Graph<false> disjoint({{0, 1}, {1, 2}, {4, 5}, {5, 6}, {6, 7}, {7, 8}});
+  EXPECT_EQ(pseudo_centre_vertex(disjoint, 0), 1);
+  EXPECT_EQ(pseudo_centre_vertex(disjoint, 8), 6);
+  EXPECT_EQ(pseudo_centre_vertex(disjoint, 3), 3);
+
+  // Death test.
+  EXPECT_DEATH(pseudo_centre_vertex(Adjacency_Graph<false>()), "./*");
+  EXPECT_DEATH(pseudo_centre_vertex(graph_saad, 16), "./*");
+}
+
 TEST(test_graph_utilities, eccentricity_graph) {
   Adjacency_Graph graph = create_graph_structured<false>(5);
   std::vector<std::vector<std::size_t>> eccentricity;
@@ -157,6 +282,10 @@ TEST(test_graph_utilities, eccentricity_vertex_breadth_first) {
   hand_computed_answer = std::vector<std::size_t>({4, 3, 2, 3, 4, 3, 2, 1, 2, 3, 2, 1, 0, 1, 2});
   EXPECT_EQ(distances, hand_computed_answer);
 
+  // Vertices from the stop vertex on are neither searched nor stored.
+  eccentricity_vertex_breadth_first(create_graph_line<false>(6), 0, distances, 3);
+  EXPECT_EQ(distances, std::vector<std::size_t>({0, 1, 2}));
+
   // Death test.
   EXPECT_DEATH(eccentricity_vertex_breadth_first(Adjacency_Graph<false>(), 0, distances), "./*");
   EXPECT_DEATH(eccentricity_vertex_breadth_first(subgraph, 1500, distances), "./*");
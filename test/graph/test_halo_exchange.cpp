@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------------------------------------------------------
+//  MIT License
+//  Copyright (c) 2022 Bevan W.S. Jones
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+//  documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+//  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+//  Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+//  WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+//  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+//  OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ----------------------------------------------------------------------------------------------------------------------
+//  File Name: test_halo_exchange.cpp
+//  Description: Unit tests for halo exchange plans between subgraphs, and their execution.
+// ----------------------------------------------------------------------------------------------------------------------
+
+#include "adjacency_subgraph.hpp"
+#include "generator.hpp"
+#include "halo_exchange.hpp"
+#include "parallel.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Disa;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Halo Exchange Plan
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(test_halo_exchange, create_halo_exchange_plan) {
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(12);
+  std::vector<std::size_t> vertex_subgraph(graph.size_vertex());
+  FOR(i_vertex, graph.size_vertex()) vertex_subgraph[i_vertex] = (i_vertex % 12) / 5 + (i_vertex / 48) * 3;
+  const std::vector<Adjacency_Subgraph> subgraph_list = create_subgraph_list(graph, vertex_subgraph, 0, 2);
+  const std::vector<Halo_Exchange_Plan> plan_list = create_halo_exchange_plan(graph, subgraph_list);
+  ASSERT_EQ(plan_list.size(), subgraph_list.size());
+
+  FOR(i_subgraph, plan_list.size()) {
+    const Halo_Exchange_Plan& plan = plan_list[i_subgraph];
+    const Adjacency_Subgraph& subgraph = subgraph_list[i_subgraph];
+    EXPECT_EQ(plan.i_subgraph, i_subgraph);
+    EXPECT_TRUE(std::is_sorted(plan.send_neighbour.begin(), plan.send_neighbour.end()));
+    EXPECT_TRUE(std::is_sorted(plan.receive_neighbour.begin(), plan.receive_neighbour.end()));
+    EXPECT_EQ(plan.send_offset.size(), plan.send_neighbour.size() + 1);
+    EXPECT_EQ(plan.receive_offset.size(), plan.receive_neighbour.size() + 1);
+
+    // Every halo vertex is received exactly once, from its owner, and only halo vertices are received.
+    std::size_t size_halo = 0;
+    FOR(i_local, subgraph.size_vertex()) size_halo += subgraph.vertex_level(i_local) != 0;
+    EXPECT_EQ(plan.receive_index.size(), size_halo);
+    FOR(i_neighbour, plan.receive_neighbour.size()) {
+      const std::size_t i_owner = plan.receive_neighbour[i_neighbour];
+      FOR_EACH(i_local, plan.receive(i_neighbour)) {
+        EXPECT_NE(subgraph.vertex_level(i_local), 0);
+        EXPECT_EQ(vertex_subgraph[subgraph.local_global(i_local)], i_owner);
+      }
+
+      // The owner's send list matches entry for entry, and sends only owned vertices.
+      const Halo_Exchange_Plan& plan_owner = plan_list[i_owner];
+      const auto iter = std::find(plan_owner.send_neighbour.begin(), plan_owner.send_neighbour.end(), i_subgraph);
+      ASSERT_NE(iter, plan_owner.send_neighbour.end());
+      const auto send = plan_owner.send(std::distance(plan_owner.send_neighbour.begin(), iter));
+      const auto receive = plan.receive(i_neighbour);
+      ASSERT_EQ(send.size(), receive.size());
+      FOR(i_entry, send.size()) {
+        EXPECT_EQ(subgraph_list[i_owner].vertex_level(send[i_entry]), 0);
+        EXPECT_EQ(subgraph_list[i_owner].local_global(send[i_entry]), subgraph.local_global(receive[i_entry]));
+      }
+    }
+  }
+
+  // Without halos there is nothing to exchange.
+  const std::vector<Halo_Exchange_Plan> plan_empty =
+  create_halo_exchange_plan(graph, create_subgraph_list(graph, vertex_subgraph));
+  FOR_EACH(plan, plan_empty) {
+    EXPECT_TRUE(plan.send_index.empty());
+    EXPECT_TRUE(plan.receive_index.empty());
+  }
+
+  // Death tests.
+  EXPECT_DEATH((void)create_halo_exchange_plan(create_graph_structured<false>(3), subgraph_list), "./*");
+  EXPECT_DEATH((void)create_halo_exchange_plan(graph, {subgraph_list[0], subgraph_list[0]}), "./*");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Execution
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(test_halo_exchange, halo_exchange) {
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(16);
+  std::vector<std::size_t> vertex_subgraph(graph.size_vertex());
+  FOR(i_vertex, graph.size_vertex()) vertex_subgraph[i_vertex] = (i_vertex % 16) / 4 + (i_vertex / 64) * 4;
+  const std::vector<Adjacency_Subgraph> subgraph_list = create_subgraph_list(graph, vertex_subgraph, 0, 1);
+  const std::vector<Halo_Exchange_Plan> plan_list = create_halo_exchange_plan(graph, subgraph_list);
+
+  // Owned entries hold a function of the global index, halo entries are stale.
+  const auto value = [](const std::size_t i_global, const std::size_t i_iteration) {
+    return static_cast<Scalar>(i_global) * 1.5 + static_cast<Scalar>(i_iteration);
+  };
+  const auto fill = [&](const std::size_t i_iteration) {
+    std::vector<Vector_Dense<Scalar, 0>> vector_list(subgraph_list.size());
+    FOR(i_subgraph, subgraph_list.size()) {
+      const Adjacency_Subgraph& subgraph = subgraph_list[i_subgraph];
+      vector_list[i_subgraph].resize(subgraph.size_vertex());
+      FOR(i_local, subgraph.size_vertex())
+      vector_list[i_subgraph][i_local] =
+      subgraph.vertex_level(i_local) == 0 ? value(subgraph.local_global(i_local), i_iteration) : -1.0;
+    }
+    return vector_list;
+  };
+  const auto expect_refreshed = [&](const std::vector<Vector_Dense<Scalar, 0>>& vector_list,
+                                    const std::size_t i_iteration) {
+    FOR(i_subgraph, subgraph_list.size()) {
+      FOR(i_local, subgraph_list[i_subgraph].size_vertex())
+      EXPECT_EQ(vector_list[i_subgraph][i_local], value(subgraph_list[i_subgraph].local_global(i_local), i_iteration));
+    }
+  };
+
+  // Shared memory.
+  std::vector<Vector_Dense<Scalar, 0>> vector_list = fill(0);
+  halo_exchange(plan_list, vector_list);
+  expect_refreshed(vector_list, 0);
+
+  // Over the local transport, one thread per rank, with successive exchanges received in order.
+  Transport_Local transport(subgraph_list.size());
+  std::vector<std::vector<Vector_Dense<Scalar, 0>>> iteration_list = {fill(1), fill(2), fill(3)};
+  parallel_region(subgraph_list.size(), [&](const std::size_t i_rank, const std::size_t) {
+    Transport_Local::Endpoint endpoint = transport.endpoint(i_rank);
+    EXPECT_EQ(endpoint.rank(), i_rank);
+    halo_exchange_begin(plan_list[i_rank], iteration_list[0][i_rank], endpoint);
+    halo_exchange_begin(plan_list[i_rank], iteration_list[1][i_rank], endpoint);
+    halo_exchange_end(plan_list[i_rank], iteration_list[0][i_rank], endpoint);
+    halo_exchange_end(plan_list[i_rank], iteration_list[1][i_rank], endpoint);
+    halo_exchange(plan_list[i_rank], iteration_list[2][i_rank], endpoint);
+  });
+  FOR(i_iteration, iteration_list.size()) expect_refreshed(iteration_list[i_iteration], i_iteration + 1);
+}
+
+TEST(test_halo_exchange, transport_socket) {
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(16);
+  std::vector<std::size_t> vertex_subgraph(graph.size_vertex());
+  FOR(i_vertex, graph.size_vertex()) vertex_subgraph[i_vertex] = (i_vertex % 16) / 8 + (i_vertex / 128) * 2;
+  const std::vector<Adjacency_Subgraph> subgraph_list = create_subgraph_list(graph, vertex_subgraph, 0, 1);
+  const std::vector<Halo_Exchange_Plan> plan_list = create_halo_exchange_plan(graph, subgraph_list);
+  ASSERT_EQ(subgraph_list.size(), 4);
+
+  // Failures on forked ranks are reported by throwing, which fails run().
+  const auto check = [](const bool condition) {
+    if(!condition) throw std::runtime_error("Check failed.");
+  };
+  EXPECT_TRUE(Transport_Socket::run(subgraph_list.size(), [&](Transport_Socket& transport) {
+    const std::size_t i_rank = transport.rank();
+    check(transport.size() == subgraph_list.size());
+
+    // Successive exchanges are received in order.
+    const Adjacency_Subgraph& subgraph = subgraph_list[i_rank];
+    std::vector<Vector_Dense<Scalar, 0>> vector_list(3);
+    FOR(i_iteration, vector_list.size()) {
+      vector_list[i_iteration].resize(subgraph.size_vertex());
+      FOR(i_local, subgraph.size_vertex())
+      vector_list[i_iteration][i_local] =
+      subgraph.vertex_level(i_local) == 0 ? static_cast<Scalar>(subgraph.local_global(i_local) + i_iteration) : -1.0;
+    }
+    halo_exchange_begin(plan_list[i_rank], vector_list[0], transport);
+    halo_exchange_begin(plan_list[i_rank], vector_list[1], transport);
+    halo_exchange_end(plan_list[i_rank], vector_list[0], transport);
+    halo_exchange_end(plan_list[i_rank], vector_list[1], transport);
+    halo_exchange(plan_list[i_rank], vector_list[2], transport);
+    FOR(i_iteration, vector_list.size()) {
+      FOR(i_local, subgraph.size_vertex())
+      check(vector_list[i_iteration][i_local] == static_cast<Scalar>(subgraph.local_global(i_local) + i_iteration));
+    }
+
+    // Messages larger than the socket buffers, sent by every rank before any receives, do not deadlock.
+    const std::vector<Scalar> message(1 << 20, static_cast<Scalar>(i_rank));
+    std::vector<Scalar> received(message.size());
+    FOR(i_other, transport.size()) if(i_other != i_rank) transport.send(i_other, message);
+    FOR(i_other, transport.size()) {
+      if(i_other == i_rank) continue;
+      transport.receive(i_other, received);
+      check(std::all_of(received.begin(), received.end(), [&](Scalar entry) { return entry == i_other; }));
+    }
+
+    check(all_reduce_sum(transport, static_cast<Scalar>(i_rank + 1)) == 10.0);
+    check(all_reduce_max(transport, static_cast<Scalar>(i_rank)) == 3.0);
+  }));
+
+  EXPECT_FALSE(Transport_Socket::run(2, [&](Transport_Socket& transport) {
+    if(transport.rank() == 1) throw std::runtime_error("Rank failure.");
+  }));
+}
@@ -75,6 +75,157 @@ TEST(test_partition, multinode_level_set_expansion) {
   EXPECT_DEATH(multinode_level_set_expansion(Adjacency_Graph<false>(), 4, subgraph), "./*");
 }
 
+TEST(test_partition, multilevel_graph_partition) {
+
+  // Checks each vertex is in exactly one subgraph, and returns the part of each vertex.
+  const auto vertex_part = [](const Adjacency_Graph<false>& graph, const std::vector<Adjacency_Subgraph>& subgraph) {
+    std::vector<std::size_t> part(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+    FOR(i_part, subgraph.size()) {
+      FOR(i_local, subgraph[i_part].size_vertex()) {
+        EXPECT_EQ(part[subgraph[i_part].local_global(i_local)], std::numeric_limits<std::size_t>::max());
+        part[subgraph[i_part].local_global(i_local)] = i_part;
+      }
+    }
+    EXPECT_EQ(std::count(part.begin(), part.end(), std::numeric_limits<std::size_t>::max()), 0);
+    return part;
+  };
+  const auto edge_cut = [](const Adjacency_Graph<false>& graph, const std::vector<std::size_t>& part) {
+    std::size_t cut = 0;
+    FOR(i_vertex, graph.size_vertex()) FOR_EACH(i_adjacent, graph[i_vertex]) cut += part[i_vertex] != part[i_adjacent];
+    return cut / 2;
+  };
+
+  // Balanced within the tolerance, and a much lower cut than recursive bisection, for even and uneven part counts.
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(32);
+  for(const std::size_t number_partitions : {2, 4, 7}) {
+    const std::vector<Adjacency_Subgraph> subgraph = multilevel_graph_partition(graph, number_partitions);
+    ASSERT_EQ(subgraph.size(), number_partitions);
+    const std::size_t max_size = std::ceil(1.03 * graph.size_vertex() / number_partitions);
+    FOR_EACH(partition, subgraph) EXPECT_LE(partition.size_vertex(), max_size);
+    const std::size_t cut = edge_cut(graph, vertex_part(graph, subgraph));
+    const std::vector<Adjacency_Subgraph> bisection = recursive_graph_bisection(graph, number_partitions);
+    EXPECT_LT(cut, 3 * edge_cut(graph, vertex_part(graph, bisection)) / 4);
+  }
+  EXPECT_LE(edge_cut(graph, vertex_part(graph, multilevel_graph_partition(graph, 2))), 40);  // Optimal 32.
+
+  // Vertex weights: the bottom half of the grid is twice as heavy.
+  std::vector<std::size_t> weight(graph.size_vertex(), 1);
+  std::fill(weight.begin(), weight.begin() + weight.size() / 2, 2);
+  const std::vector<Adjacency_Subgraph> weighted = multilevel_graph_partition(graph, 4, weight, 0.05);
+  FOR_EACH(partition, weighted) {
+    std::size_t part_weight = 0;
+    FOR(i_local, partition.size_vertex()) part_weight += weight[partition.local_global(i_local)];
+    EXPECT_LE(part_weight, std::ceil(1.05 * 1536 / 4));
+  }
+
+  // Two disconnected grids are separated with no cut, and the result is deterministic.
+  std::vector<Edge> edge;
+  FOR(i_vertex, graph.size_vertex()) {
+    FOR_EACH(i_adjacent, graph[i_vertex]) {
+      edge.emplace_back(i_vertex, i_adjacent);
+      edge.emplace_back(i_vertex + graph.size_vertex(), i_adjacent + graph.size_vertex());
+    }
+  }
+  const Adjacency_Graph<false> disjoint(edge);
+  const std::vector<std::size_t> part = vertex_part(disjoint, multilevel_graph_partition(disjoint, 2));
+  EXPECT_EQ(edge_cut(disjoint, part), 0);
+  EXPECT_EQ(vertex_part(disjoint, multilevel_graph_partition(disjoint, 2)), part);
+  EXPECT_EQ(multilevel_graph_partition(graph, 1).front().size_vertex(), graph.size_vertex());
+
+  // death tests.
+  EXPECT_DEATH(multilevel_graph_partition(graph, 0), "./*");
+  EXPECT_DEATH(multilevel_graph_partition(graph, 2000), "./*");
+  EXPECT_DEATH(multilevel_graph_partition(graph, 2, {1, 2, 3}), "./*");
+  EXPECT_DEATH(multilevel_graph_partition(graph, 2, {}, -0.1), "./*");
+}
+
+TEST(test_partition, space_filling_curve_partition) {
+  const std::size_t size = 16;
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(size);
+  std::vector<Vector_Dense<Scalar, 2>> coordinate;
+  FOR(i_y, size) FOR(i_x, size) coordinate.push_back({Scalar(i_x), Scalar(i_y)});
+
+  // On a power of two grid the Hilbert chunks are the four quadrants.
+  std::vector<Adjacency_Subgraph> subgraph = space_filling_curve_partition(graph, coordinate, 4);
+  ASSERT_EQ(subgraph.size(), 4);
+  std::vector<bool> in_partition(graph.size_vertex(), false);
+  FOR_EACH(partition, subgraph) {
+    EXPECT_EQ(partition.size_vertex(), 64);
+    EXPECT_EQ(partition.size_edge(), 2 * 8 * 7);
+    FOR(i_local_vertex, partition.size_vertex()) {
+      EXPECT_FALSE(in_partition[partition.local_global(i_local_vertex)]);
+      in_partition[partition.local_global(i_local_vertex)] = true;
+    }
+  }
+  EXPECT_TRUE(std::all_of(in_partition.begin(), in_partition.end(), [](const bool is_in) { return is_in; }));
+
+  // Uneven splits differ by at most one vertex.
+  subgraph = space_filling_curve_partition(graph, coordinate, 3, Curve_Type::morton);
+  EXPECT_EQ(subgraph[0].size_vertex(), 86);
+  EXPECT_EQ(subgraph[1].size_vertex(), 85);
+  EXPECT_EQ(subgraph[2].size_vertex(), 85);
+
+  // death tests.
+  EXPECT_DEATH(space_filling_curve_partition(graph, coordinate, 0), "./*");
+  coordinate.pop_back();
+  EXPECT_DEATH(space_filling_curve_partition(graph, coordinate, 2), "./*");
+}
+
+TEST(test_partition, partition_metrics) {
+  const std::size_t size = 16;
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(size);
+
+  // Quadrants: each has a 15 vertex boundary, whose corner vertex is adjacent to two other quadrants.
+  std::vector<std::size_t> vertex_part(graph.size_vertex());
+  FOR(i_y, size) FOR(i_x, size) vertex_part[i_x + i_y * size] = (i_x >= size / 2) + 2 * (i_y >= size / 2);
+  Partition_Metrics metrics = partition_metrics(graph, vertex_part);
+  EXPECT_EQ(metrics.edge_cut, 32);
+  EXPECT_EQ(metrics.communication_volume, 64);
+  EXPECT_EQ(metrics.communication_volume_max, 16);
+  EXPECT_DOUBLE_EQ(metrics.imbalance, 0);
+  EXPECT_EQ(metrics.part_weight, std::vector<std::size_t>(4, 64));
+  EXPECT_EQ(metrics.boundary_vertex, std::vector<std::size_t>(4, 15));
+  EXPECT_EQ(metrics.neighbour_part, std::vector<std::size_t>(4, 2));
+  EXPECT_EQ(metrics.component, std::vector<std::size_t>(4, 1));
+
+  // The same quadrants as subgraphs, halo levels must be ignored.
+  std::vector<Vector_Dense<Scalar, 2>> coordinate;
+  FOR(i_y, size) FOR(i_x, size) coordinate.push_back({Scalar(i_x), Scalar(i_y)});
+  std::vector<Adjacency_Subgraph> subgraph = space_filling_curve_partition(graph, coordinate, 4);
+  FOR_EACH_REF(partition, subgraph) partition.update_levels(graph, 2);
+  const Partition_Metrics metrics_subgraph = partition_metrics(graph, subgraph);
+  EXPECT_EQ(metrics_subgraph.edge_cut, 32);
+  EXPECT_EQ(metrics_subgraph.communication_volume, 64);
+  EXPECT_EQ(metrics_subgraph.boundary_vertex, std::vector<std::size_t>(4, 15));
+
+  // Alternating rows: every vertical edge is cut, and each part is eight disconnected rows.
+  FOR(i_vertex, graph.size_vertex()) vertex_part[i_vertex] = (i_vertex / size) % 2;
+  metrics = partition_metrics(graph, vertex_part);
+  EXPECT_EQ(metrics.edge_cut, size * (size - 1));
+  EXPECT_EQ(metrics.communication_volume, graph.size_vertex());
+  EXPECT_EQ(metrics.boundary_vertex, std::vector<std::size_t>(2, 128));
+  EXPECT_EQ(metrics.neighbour_part, std::vector<std::size_t>(2, 1));
+  EXPECT_EQ(metrics.component, std::vector<std::size_t>(2, 8));
+
+  // Weighted imbalance, and an empty part.
+  std::vector<std::size_t> weight(graph.size_vertex(), 1);
+  FOR(i_vertex, size) weight[i_vertex] = 3;
+  metrics = partition_metrics(graph, vertex_part, weight);
+  EXPECT_EQ(metrics.part_weight, (std::vector<std::size_t>{160, 128}));
+  EXPECT_DOUBLE_EQ(metrics.imbalance, 2.0 * 160.0 / 288.0 - 1.0);
+  std::replace(vertex_part.begin(), vertex_part.end(), 1, 2);
+  metrics = partition_metrics(graph, vertex_part);
+  EXPECT_EQ(metrics.part_weight, (std::vector<std::size_t>{128, 0, 128}));
+  EXPECT_EQ(metrics.component, (std::vector<std::size_t>{8, 0, 8}));
+  EXPECT_DOUBLE_EQ(metrics.imbalance, 0.5);
+
+  // death tests.
+  EXPECT_DEATH(static_cast<void>(partition_metrics(graph, std::vector<std::size_t>{0, 1})), "./*");
+  EXPECT_DEATH(static_cast<void>(partition_metrics(graph, vertex_part, {1, 2})), "./*");
+  subgraph.pop_back();
+  EXPECT_DEATH(static_cast<void>(partition_metrics(graph, subgraph)), "./*");
+}
+
 TEST(LevelTraversalTest, SimpleTest) {
   std::size_t number_vertices = 40;
   auto subgraph_2 = recursive_graph_bisection(create_graph_line<false>(number_vertices), 2);
@@ -138,3 +289,28 @@ TEST(LevelTraversalTest, SimpleTest) {
   in_partition[subgraph.local_global(i_local_vertex)] = true;
   EXPECT_FALSE(std::find(in_partition.begin(), in_partition.end(), true) == in_partition.end());
 }
+
+TEST(test_partition, recursive_graph_bisection_disjoint) {
+
+  // Disjoint graphs are split along component boundaries, each vertex in exactly one non-empty subgraph.
+  const Adjacency_Graph<false> graph = create_graph_disjoint(12, 5);
+  for(const std::size_t number_partitions : {2, 3, 4}) {
+    const std::vector<Adjacency_Subgraph> subgraph = recursive_graph_bisection(graph, number_partitions);
+    ASSERT_EQ(subgraph.size(), number_partitions);
+    std::vector<std::size_t> part(graph.size_vertex(), std::numeric_limits<std::size_t>::max());
+    FOR(i_part, subgraph.size()) {
+      EXPECT_GT(subgraph[i_part].size_vertex(), 0);
+      FOR(i_local, subgraph[i_part].size_vertex()) {
+        EXPECT_EQ(part[subgraph[i_part].local_global(i_local)], std::numeric_limits<std::size_t>::max());
+        part[subgraph[i_part].local_global(i_local)] = i_part;
+      }
+    }
+    EXPECT_EQ(std::count(part.begin(), part.end(), std::numeric_limits<std::size_t>::max()), 0);
+  }
+
+  // The first split is along components, with the isolated vertices balancing the halves.
+  const std::vector<Adjacency_Subgraph> bisection = recursive_graph_bisection(graph, 2);
+  EXPECT_LE(std::max(bisection[0].size_vertex(), bisection[1].size_vertex())
+            - std::min(bisection[0].size_vertex(), bisection[1].size_vertex()), 1);
+  EXPECT_EQ(bisection[0].size_edge() + bisection[1].size_edge(), graph.size_edge());  // No edges are cut.
+}
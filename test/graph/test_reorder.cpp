@@ -20,8 +20,14 @@
 // ---------------------------------------------------------------------------------------------------------------------
 
 #include "gtest/gtest.h"
+#include "adjacency_subgraph.hpp"
+#include "generator.hpp"
+#include "graph_utilities.hpp"
+#include "parallel.hpp"
 #include "reorder.hpp"
 
+#include <set>
+
 using namespace Disa;
 
 class test_reorder : public ::testing::Test {
@@ -164,6 +170,232 @@ TEST_F(test_reorder, cuthill_mckee_reverse) {
   EXPECT_TRUE(greedy_multicolouring(Adjacency_Graph<false>()).empty());  // ensure empty graphs returns empty reorder.
 }
 
+TEST_F(test_reorder, disjoint_graph) {
+
+  // Checks the ordering is a permutation which keeps every component contiguous, and the start component first.
+  const Adjacency_Graph<false> graph = create_graph_disjoint(12, 5);
+  std::vector<std::size_t> component;
+  const std::size_t number_component = connected_components(graph, component);
+  const auto check = [&](const std::vector<std::size_t>& permutation, const std::size_t start_vertex) {
+    ASSERT_EQ(permutation.size(), graph.size_vertex());
+    std::vector<std::size_t> old_index(graph.size_vertex(), graph.size_vertex());
+    FOR(i_vertex, graph.size_vertex()) old_index[permutation[i_vertex]] = i_vertex;
+    EXPECT_EQ(std::count(old_index.begin(), old_index.end(), graph.size_vertex()), 0);
+    std::vector<bool> visited(number_component, false);
+    FOR(i_new, old_index.size()) {
+      const std::size_t i_component = component[old_index[i_new]];
+      if(i_new != 0 && component[old_index[i_new - 1]] == i_component) continue;
+      EXPECT_FALSE(visited[i_component]);
+      visited[i_component] = true;
+    }
+    if(start_vertex < graph.size_vertex()) EXPECT_EQ(component[old_index[0]], component[start_vertex]);
+  };
+
+  // The threading must not change the result.
+  const std::size_t number_thread = parallel_thread_count();
+  parallel_thread_count_set(1);
+  const std::vector<std::size_t> serial = cuthill_mckee(graph, 3);
+  for(const std::size_t thread : {1, 4}) {
+    parallel_thread_count_set(thread);
+    check(breadth_first(graph), 0);
+    check(breadth_first(graph, 7), 7);
+    EXPECT_EQ(breadth_first(graph, 7)[7], 0);
+    check(cuthill_mckee(graph), 0);
+    check(cuthill_mckee(graph, 9), 9);
+    EXPECT_EQ(cuthill_mckee(graph, 9)[9], 0);
+    check(cuthill_mckee(graph, graph.size_vertex() - 1), graph.size_vertex() - 1);
+    check(cuthill_mckee_reverse(graph), std::numeric_limits<std::size_t>::max());
+    EXPECT_EQ(cuthill_mckee(graph, 3), serial);
+  }
+  parallel_thread_count_set(number_thread);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fill Reducing Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Counts the fill edges created by (symbolically) eliminating the vertices of a graph in permuted order.
+ * @param[in] graph The graph.
+ * @param[in] permutation The elimination order, new_index = permutation[old_index].
+ * @return The number of fill edges.
+ */
+std::size_t fill_count(const Adjacency_Graph<false>& graph, const std::vector<std::size_t>& permutation) {
+  std::vector<std::set<std::size_t>> elimination(graph.size_vertex());
+  FOR(i_vertex, graph.size_vertex()) {
+    FOR_EACH(i_adjacent, graph[i_vertex]) elimination[permutation[i_vertex]].insert(permutation[i_adjacent]);
+  }
+  std::size_t fill = 0;
+  FOR(i_vertex, elimination.size()) {
+    std::vector<std::size_t> higher(elimination[i_vertex].upper_bound(i_vertex), elimination[i_vertex].end());
+    FOR(i_first, higher.size()) FOR(i_second, i_first + 1, higher.size()) {
+      if(elimination[higher[i_first]].insert(higher[i_second]).second) {
+        elimination[higher[i_second]].insert(higher[i_first]);
+        ++fill;
+      }
+    }
+  }
+  return fill;
+}
+
+TEST_F(test_reorder, approximate_minimum_degree) {
+
+  // Must be a permutation.
+  const auto is_permutation = [](std::vector<std::size_t> permutation) {
+    std::sort(permutation.begin(), permutation.end());
+    FOR(i_index, permutation.size()) if(permutation[i_index] != i_index) return false;
+    return true;
+  };
+  std::vector<std::size_t> permutation = approximate_minimum_degree(graph_saad);
+  EXPECT_EQ(permutation.size(), graph_saad.size_vertex());
+  EXPECT_TRUE(is_permutation(permutation));
+  EXPECT_TRUE(approximate_minimum_degree(Adjacency_Graph<false>()).empty());
+
+  // Star graph, the hub should be eliminated (at least almost) last creating no fill.
+  Adjacency_Graph<false> star({{0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}});
+  permutation = approximate_minimum_degree(star);
+  EXPECT_TRUE(is_permutation(permutation));
+  EXPECT_GE(permutation[0], star.size_vertex() - 2);
+  EXPECT_EQ(fill_count(star, permutation), 0);
+
+  // Disjoint graphs are supported.
+  Adjacency_Graph<false> disjoint({{0, 1}, {1, 2}, {0, 2}, {3, 4}, {4, 5}, {5, 6}});
+  EXPECT_TRUE(is_permutation(approximate_minimum_degree(disjoint)));
+  EXPECT_EQ(fill_count(disjoint, approximate_minimum_degree(disjoint)), 0);
+
+  // For a structured grid the fill should be well below that of the bandwidth reducing orderings.
+  Adjacency_Graph<false> structured = create_graph_structured<false>(20);
+  permutation = approximate_minimum_degree(structured);
+  EXPECT_TRUE(is_permutation(permutation));
+  EXPECT_LT(fill_count(structured, permutation), fill_count(structured, cuthill_mckee_reverse(structured)));
+  EXPECT_LE(fill_count(graph_saad, approximate_minimum_degree(graph_saad)),
+            fill_count(graph_saad, cuthill_mckee_reverse(graph_saad)));
+}
+
+TEST_F(test_reorder, nested_dissection) {
+
+  const auto is_permutation = [](std::vector<std::size_t> permutation) {
+    std::sort(permutation.begin(), permutation.end());
+    FOR(i_index, permutation.size()) if(permutation[i_index] != i_index) return false;
+    return true;
+  };
+
+  // Small graphs are a single leaf.
+  Separator_Tree separator_tree;
+  std::vector<std::size_t> permutation = nested_dissection(graph_saad, separator_tree);
+  EXPECT_TRUE(is_permutation(permutation));
+  ASSERT_EQ(separator_tree.node.size(), 1);
+  EXPECT_TRUE(separator_tree.is_leaf(0));
+  EXPECT_TRUE(nested_dissection(Adjacency_Graph<false>(), separator_tree).empty());
+  EXPECT_TRUE(separator_tree.node.empty());
+
+  // Structured grid, check the tree and that the halves of each separator are independent.
+  Adjacency_Graph<false> structured = create_graph_structured<false>(20);
+  permutation = nested_dissection(structured, separator_tree, 16);
+  EXPECT_TRUE(is_permutation(permutation));
+  EXPECT_GT(separator_tree.node.size(), 7);
+  EXPECT_EQ(separator_tree.node[0].begin, 0);
+  EXPECT_EQ(separator_tree.node[0].end, structured.size_vertex());
+  FOR(i_node, separator_tree.node.size()) {
+    const Separator_Tree_Node& node = separator_tree.node[i_node];
+    if(separator_tree.is_leaf(i_node)) {
+      EXPECT_EQ(node.begin, node.separator);
+      EXPECT_LE(node.end - node.begin, 16);
+      continue;
+    }
+    const Separator_Tree_Node& left = separator_tree.node[node.child_left];
+    const Separator_Tree_Node& right = separator_tree.node[node.child_right];
+    EXPECT_EQ(left.parent, i_node);
+    EXPECT_EQ(right.parent, i_node);
+    EXPECT_EQ(left.begin, node.begin);
+    EXPECT_EQ(left.end, right.begin);
+    EXPECT_EQ(right.end, node.separator);
+    FOR(i_vertex, structured.size_vertex()) {
+      if(permutation[i_vertex] < left.begin || permutation[i_vertex] >= left.end) continue;
+      FOR_EACH(i_adjacent, structured[i_vertex]) {
+        EXPECT_FALSE(permutation[i_adjacent] >= right.begin && permutation[i_adjacent] < right.end);
+      }
+    }
+  }
+  EXPECT_LT(fill_count(structured, permutation), fill_count(structured, cuthill_mckee_reverse(structured)));
+
+  // Disjoint graphs are split by component first, the threading must not change the result.
+  Adjacency_Graph<false> disjoint = create_graph_structured<false>(8);
+  disjoint.resize(80);
+  FOR(i_vertex, 64, 79) disjoint.insert({i_vertex, i_vertex + 1});
+  permutation = nested_dissection(disjoint, separator_tree, 8);
+  EXPECT_TRUE(is_permutation(permutation));
+  EXPECT_EQ(separator_tree.node[0].separator, separator_tree.node[0].end);
+  const std::size_t number_thread = parallel_thread_count();
+  parallel_thread_count_set(4);
+  EXPECT_EQ(nested_dissection(disjoint, 8), permutation);
+  parallel_thread_count_set(number_thread);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Geometric Orderings
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST_F(test_reorder, space_filling_curve) {
+  const std::size_t size = 8;
+  std::vector<Vector_Dense<Scalar, 2>> coordinate_2d;
+  FOR(i_y, size) FOR(i_x, size) coordinate_2d.push_back({Scalar(i_x), Scalar(i_y)});
+  std::vector<Vector_Dense<Scalar, 3>> coordinate_3d;
+  FOR(i_z, 4) FOR(i_y, 4) FOR(i_x, 4) coordinate_3d.push_back({Scalar(i_x), Scalar(i_y), Scalar(i_z)});
+
+  const auto is_permutation = [](std::vector<std::size_t> permutation) {
+    std::sort(permutation.begin(), permutation.end());
+    FOR(i_index, permutation.size()) if(permutation[i_index] != i_index) return false;
+    return true;
+  };
+
+  // Hilbert: consecutive vertices along the curve are always grid neighbours.
+  const auto inverse = [](const std::vector<std::size_t>& permutation) {
+    std::vector<std::size_t> order(permutation.size());
+    FOR(i_vertex, permutation.size()) order[permutation[i_vertex]] = i_vertex;
+    return order;
+  };
+  auto permutation = space_filling_curve(coordinate_2d);
+  EXPECT_TRUE(is_permutation(permutation));
+  auto order = inverse(permutation);
+  FOR(i_new, 1, order.size()) {
+    const auto& point_0 = coordinate_2d[order[i_new - 1]];
+    const auto& point_1 = coordinate_2d[order[i_new]];
+    EXPECT_DOUBLE_EQ(std::abs(point_0[0] - point_1[0]) + std::abs(point_0[1] - point_1[1]), 1.0);
+  }
+  permutation = space_filling_curve(coordinate_3d);
+  EXPECT_TRUE(is_permutation(permutation));
+  order = inverse(permutation);
+  FOR(i_new, 1, order.size()) {
+    const auto& point_0 = coordinate_3d[order[i_new - 1]];
+    const auto& point_1 = coordinate_3d[order[i_new]];
+    Scalar distance = 0;
+    FOR(i_axis, 3) distance += std::abs(point_0[i_axis] - point_1[i_axis]);
+    EXPECT_DOUBLE_EQ(distance, 1.0);
+  }
+
+  // Morton: the first four vertices form the lower left 2x2 block, in Z order.
+  permutation = space_filling_curve(coordinate_2d, Curve_Type::morton);
+  EXPECT_TRUE(is_permutation(permutation));
+  order = inverse(permutation);
+  EXPECT_EQ(std::set<std::size_t>(order.begin(), order.begin() + 4), std::set<std::size_t>({0, 1, size, size + 1}));
+  EXPECT_EQ(order.back(), size * size - 1);
+
+  // The permutation can be applied directly to the graph, and is unchanged by scaling and translating.
+  Adjacency_Graph<false> graph = create_graph_structured<false>(size);
+  permutation = space_filling_curve(coordinate_2d);
+  Adjacency_Graph<false> reordered = graph;
+  reordered.reorder(permutation);
+  FOR(i_vertex, size * size - 1) EXPECT_TRUE(reordered.contains({i_vertex, i_vertex + 1}));
+  FOR_EACH_REF(point, coordinate_2d) point = {Scalar(3) * point[0] - 5, Scalar(3) * point[1] + 2};
+  EXPECT_EQ(space_filling_curve(coordinate_2d), permutation);
+
+  // Coincident points are ordered by index.
+  std::vector<Vector_Dense<Scalar, 2>> coincident(3, {1.0, 1.0});
+  EXPECT_EQ(space_filling_curve(coincident), std::vector<std::size_t>({0, 1, 2}));
+  EXPECT_TRUE(space_filling_curve(std::vector<Vector_Dense<Scalar, 3>>()).empty());
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Multicolor Ordering
 // ---------------------------------------------------------------------------------------------------------------------
@@ -193,3 +425,199 @@ TEST_F(test_reorder, greedy_multicolouring) {
 
   EXPECT_TRUE(greedy_multicolouring(Adjacency_Graph<false>()).empty());  // ensure empty graphs returns empty reorder.
 }
+
+TEST_F(test_reorder, jones_plassmann_colouring) {
+
+  // A denser graph, each vertex of a 24 x 24 grid joined to its 8 surrounding vertices and the vertex 3 along.
+  const std::size_t size = 24;
+  std::vector<Edge> edge;
+  FOR(i_y, size) FOR(i_x, size) {
+    const std::size_t i_vertex = i_x + i_y * size;
+    if(i_x + 1 < size) edge.emplace_back(i_vertex, i_vertex + 1);
+    if(i_x + 3 < size) edge.emplace_back(i_vertex, i_vertex + 3);
+    if(i_y + 1 < size) edge.emplace_back(i_vertex, i_vertex + size);
+    if(i_x + 1 < size && i_y + 1 < size) edge.emplace_back(i_vertex, i_vertex + size + 1);
+    if(i_x > 0 && i_y + 1 < size) edge.emplace_back(i_vertex, i_vertex + size - 1);
+  }
+  const std::size_t number_thread = parallel_thread_count();
+  for(const auto& graph : {graph_saad, create_graph_structured<false>(size), Adjacency_Graph<false>(edge)}) {
+    std::size_t max_degree = 0;
+    FOR(i_vertex, graph.size_vertex()) max_degree = std::max(max_degree, graph.degree(i_vertex));
+    for(const bool is_balanced : {false, true}) {
+      parallel_thread_count_set(1);
+      const std::vector<std::size_t> colour = jones_plassmann_colouring(graph, is_balanced);
+      parallel_thread_count_set(4);
+      EXPECT_EQ(jones_plassmann_colouring(graph, is_balanced), colour);
+
+      // A valid colouring, with at most max degree + 1 colours.
+      ASSERT_EQ(colour.size(), graph.size_vertex());
+      FOR(i_vertex, graph.size_vertex()) {
+        EXPECT_LE(colour[i_vertex], max_degree);
+        FOR_EACH(i_adjacent, graph[i_vertex]) EXPECT_NE(colour[i_vertex], colour[i_adjacent]);
+      }
+
+      // Balancing keeps the number of colours, and brings the largest colour to the average (for these graphs).
+      const std::size_t number_colour = *std::max_element(colour.begin(), colour.end()) + 1;
+      std::vector<std::size_t> colour_size(number_colour, 0);
+      FOR_EACH(i_colour, colour) ++colour_size[i_colour];
+      if(is_balanced) {
+        EXPECT_EQ(*std::max_element(colour_size.begin(), colour_size.end()),
+                  (graph.size_vertex() + number_colour - 1) / number_colour);
+      }
+
+      // The permutation groups the colours.
+      const std::vector<std::size_t> permutation = jones_plassmann_multicolouring(graph, is_balanced);
+      EXPECT_EQ(permutation, colour_permutation(colour));
+      std::vector<std::size_t> new_colour(graph.size_vertex());
+      FOR(i_vertex, graph.size_vertex()) new_colour[permutation[i_vertex]] = colour[i_vertex];
+      EXPECT_TRUE(std::is_sorted(new_colour.begin(), new_colour.end()));
+    }
+  }
+  parallel_thread_count_set(number_thread);
+
+  EXPECT_EQ(colour_permutation({2, 0, 1, 0, 2}), (std::vector<std::size_t>{3, 0, 2, 1, 4}));
+  EXPECT_TRUE(jones_plassmann_colouring(Adjacency_Graph<false>()).empty());
+  EXPECT_TRUE(jones_plassmann_multicolouring(Adjacency_Graph<false>()).empty());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Ordering Metrics
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST_F(test_reorder, interior_boundary_split) {
+  const Adjacency_Graph<false> graph = create_graph_structured<false>(10);
+  std::vector<std::size_t> vertex;
+  FOR(i_vertex, graph.size_vertex()) if(i_vertex % 10 < 5 && i_vertex / 10 < 6) vertex.push_back(i_vertex);
+  Adjacency_Subgraph subgraph(graph, vertex, 2);
+
+  // A 5 x 6 block of a 10 x 10 grid, bounded on two sides, with a two level halo.
+  const std::vector<std::size_t> order = cuthill_mckee(subgraph.local_graph());
+  const Interior_Boundary_Split split = interior_boundary_split(subgraph, order);
+  EXPECT_EQ(split.size_interior, 20);
+  EXPECT_EQ(split.size_boundary, 10);
+  EXPECT_EQ(split.size_halo, subgraph.size_vertex() - 30);
+  EXPECT_EQ(split.interior(), std::make_pair(std::size_t(0), std::size_t(20)));
+  EXPECT_EQ(split.boundary(), std::make_pair(std::size_t(20), std::size_t(30)));
+  EXPECT_EQ(split.halo(), std::make_pair(std::size_t(30), subgraph.size_vertex()));
+  std::vector<std::size_t> sorted = split.permutation;
+  std::sort(sorted.begin(), sorted.end());
+  FOR(i_vertex, sorted.size()) EXPECT_EQ(sorted[i_vertex], i_vertex);
+
+  // Each class is contiguous, interior vertices have no halo neighbours, and the Cuthill-McKee order is kept.
+  FOR(i_old, subgraph.size_vertex()) {
+    const std::size_t i_new = split.permutation[i_old];
+    if(subgraph.vertex_level(i_old) != 0) EXPECT_GE(i_new, split.halo().first);
+    else if(i_new < split.interior().second) {
+      FOR_EACH(i_adjacent, subgraph[i_old]) EXPECT_EQ(subgraph.vertex_level(i_adjacent), 0);
+    } else EXPECT_LT(i_new, split.boundary().second);
+  }
+  std::vector<std::size_t> class_order(subgraph.size_vertex());
+  FOR(i_old, subgraph.size_vertex()) class_order[split.permutation[i_old]] = order[i_old];
+  for(const auto& [i_begin, i_end] : {split.interior(), split.boundary(), split.halo()})
+    EXPECT_TRUE(std::is_sorted(class_order.begin() + i_begin, class_order.begin() + i_end));
+
+  // Applied, the interior rows only reference owned vertices.
+  static_cast<void>(subgraph.reorder(split.permutation));
+  FOR(i_vertex, split.interior().first, split.interior().second)
+  FOR_EACH(i_adjacent, subgraph[i_vertex]) EXPECT_LT(i_adjacent, split.boundary().second);
+
+  // Without a halo there is no boundary, and the current order is kept.
+  const Interior_Boundary_Split split_primary = interior_boundary_split(Adjacency_Subgraph(graph, vertex));
+  EXPECT_EQ(split_primary.size_interior, vertex.size());
+  FOR(i_vertex, vertex.size()) EXPECT_EQ(split_primary.permutation[i_vertex], i_vertex);
+  EXPECT_DEATH((void)interior_boundary_split(subgraph, {0, 1}), "./*");
+}
+
+TEST_F(test_reorder, ordering_metrics) {
+
+  // Brute force bandwidth, profile and average distance in the permuted indexing.
+  const auto brute_force = [](const Adjacency_Graph<false>& graph, const std::vector<std::size_t>& permutation) {
+    Ordering_Metrics metrics;
+    std::size_t distance_sum = 0;
+    std::size_t number_edge = 0;
+    FOR(i_vertex, graph.size_vertex()) {
+      const std::size_t i_new = permutation[i_vertex];
+      std::size_t min_column = i_new;
+      FOR_EACH(i_adjacent, graph[i_vertex]) {
+        const std::size_t i_column = permutation[i_adjacent];
+        const std::size_t distance = i_column > i_new ? i_column - i_new : i_new - i_column;
+        metrics.bandwidth = std::max(metrics.bandwidth, distance);
+        distance_sum += distance;
+        ++number_edge;
+        min_column = std::min(min_column, i_column);
+      }
+      metrics.profile += i_new - min_column;
+    }
+    metrics.average_distance = Scalar(distance_sum) / Scalar(number_edge);
+    return metrics;
+  };
+
+  // Saad graph, current ordering and each of the level set orderings.
+  std::vector<std::size_t> identity(graph_saad.size_vertex());
+  std::iota(identity.begin(), identity.end(), 0);
+  FOR_EACH(permutation, std::vector<std::vector<std::size_t>>({identity, breadth_first(graph_saad, 0),
+                                                               cuthill_mckee(graph_saad, 0),
+                                                               cuthill_mckee_reverse(graph_saad, 0)})) {
+    const Ordering_Metrics expected = brute_force(graph_saad, permutation);
+    const Ordering_Metrics metrics = ordering_metrics(graph_saad, permutation);
+    EXPECT_EQ(metrics.bandwidth, expected.bandwidth);
+    EXPECT_EQ(metrics.profile, expected.profile);
+    EXPECT_DOUBLE_EQ(metrics.average_distance, expected.average_distance);
+    EXPECT_GE(metrics.cache_line_reuse, 0.0);
+    EXPECT_LT(metrics.cache_line_reuse, 1.0);
+  }
+  const Ordering_Metrics current = ordering_metrics(graph_saad);
+  EXPECT_EQ(current.bandwidth, brute_force(graph_saad, identity).bandwidth);
+  EXPECT_EQ(current.profile, brute_force(graph_saad, identity).profile);
+
+  // A line graph: unit bandwidth, and each row of three entries shares lines with itself and the previous row.
+  const Adjacency_Graph<false> line = create_graph_line<false>(16);
+  Ordering_Metrics metrics = ordering_metrics(line, {}, 8);
+  EXPECT_EQ(metrics.bandwidth, 1);
+  EXPECT_EQ(metrics.profile, 15);
+  EXPECT_DOUBLE_EQ(metrics.average_distance, 1.0);
+  EXPECT_GT(metrics.cache_line_reuse, 0.9);
+
+  // The matrix overload agrees with the graph of its sparsity pattern.
+  const std::size_t size = 8;
+  const Adjacency_Graph<false> grid = create_graph_structured<false>(size);
+  Matrix_Sparse matrix(grid.size_vertex(), grid.size_vertex());
+  FOR(i_vertex, grid.size_vertex()) {
+    matrix[i_vertex][i_vertex] = 4.0;
+    FOR_EACH(i_adjacent, grid[i_vertex]) matrix[i_vertex][i_adjacent] = -1.0;
+  }
+  const std::vector<std::size_t> permutation = cuthill_mckee_reverse(grid, 0);
+  metrics = ordering_metrics(grid, permutation);
+  const Ordering_Metrics metrics_matrix = ordering_metrics(matrix, permutation);
+  EXPECT_EQ(metrics.bandwidth, metrics_matrix.bandwidth);
+  EXPECT_EQ(metrics.profile, metrics_matrix.profile);
+  EXPECT_DOUBLE_EQ(metrics.average_distance, metrics_matrix.average_distance);
+  EXPECT_DOUBLE_EQ(metrics.cache_line_reuse, metrics_matrix.cache_line_reuse);
+
+  // A scrambled ordering has worse locality than the natural one.
+  std::vector<std::size_t> scrambled(grid.size_vertex());
+  FOR(i_vertex, scrambled.size()) scrambled[i_vertex] = (i_vertex * 37) % scrambled.size();
+  const Ordering_Metrics natural = ordering_metrics(grid);
+  EXPECT_EQ(natural.bandwidth, size);
+  EXPECT_GT(ordering_metrics(grid, scrambled).bandwidth, natural.bandwidth);
+  EXPECT_LT(ordering_metrics(grid, scrambled).cache_line_reuse, natural.cache_line_reuse);
+
+  // Thread count independence.
+  const Adjacency_Graph<false> large = create_graph_structured<false>(48);
+  const std::vector<std::size_t> large_permutation = cuthill_mckee_reverse(large, 0);
+  const std::size_t number_thread = parallel_thread_count();
+  parallel_thread_count_set(1);
+  const Ordering_Metrics serial = ordering_metrics(large, large_permutation);
+  parallel_thread_count_set(4);
+  const Ordering_Metrics parallel = ordering_metrics(large, large_permutation);
+  parallel_thread_count_set(number_thread);
+  EXPECT_EQ(serial.bandwidth, parallel.bandwidth);
+  EXPECT_EQ(serial.profile, parallel.profile);
+  EXPECT_DOUBLE_EQ(serial.average_distance, parallel.average_distance);
+  EXPECT_DOUBLE_EQ(serial.cache_line_reuse, parallel.cache_line_reuse);
+
+  // death tests.
+  EXPECT_DEATH(auto result = ordering_metrics(graph_saad, {0, 1}), "./*");
+  EXPECT_DEATH(auto result = ordering_metrics(graph_saad, {}, 0), "./*");
+  EXPECT_DEATH(auto result = ordering_metrics(Matrix_Sparse(2, 3)), "./*");
+}
@@ -23,6 +23,7 @@
 
 #include "matrix_dense.hpp"
 #include "matrix_sparse.hpp"
+#include "parallel.hpp"
 #include "solver.hpp"
 
 using namespace Disa;
@@ -133,4 +134,138 @@ TEST_F(direct_solvers, lower_upper_factorise_solve) {
   EXPECT_NEAR(solution[0], x_vector[0], default_absolute);
   EXPECT_NEAR(solution[1], x_vector[1], default_absolute);
   EXPECT_NEAR(solution[2], x_vector[2], default_absolute);
-}
\ No newline at end of file
+}
+
+TEST_F(direct_solvers, lower_upper_factorisation_mixed_precision) {
+
+  Solver_Config config;
+  config.type = Solver_Type::lower_upper_factorisation;
+  config.mixed_precision = true;
+  Solver_LUP<0> mixed_solver(config);
+  EXPECT_TRUE(mixed_solver.get_config().mixed_precision);
+
+  // Well conditioned, non-symmetric, system: single precision factors refined to double accuracy.
+  const std::size_t size = 60;
+  Matrix_Dense<Scalar, 0, 0> matrix;
+  matrix.resize(size, size);
+  Vector_Dense<Scalar, 0> b_vector;
+  Vector_Dense<Scalar, 0> x_vector;
+  Vector_Dense<Scalar, 0> x_double;
+  b_vector.resize(size);
+  FOR(i_row, size) {
+    FOR(i_column, size) matrix[i_row][i_column] = std::sin(static_cast<Scalar>(i_row * size + i_column + 1));
+    matrix[i_row][i_row] += 0.25 * static_cast<Scalar>(size);
+    b_vector[i_row] = std::cos(static_cast<Scalar>(i_row));
+  }
+  EXPECT_TRUE(lup_solver.factorise(matrix));
+  lup_solver.solve_system(x_double, b_vector);
+
+  EXPECT_TRUE(mixed_solver.factorise(matrix));
+  Convergence_Data data = mixed_solver.solve_system(x_vector, b_vector);
+  EXPECT_TRUE(data.converged);
+  EXPECT_FALSE(data.fallback);
+  EXPECT_GT(data.iteration, 1);
+  EXPECT_LE(data.iteration, config.refinement_iterations + 1);
+  EXPECT_LT(data.residual_max_normalised, 1.0e-6);
+  FOR(i_row, size) EXPECT_NEAR(x_vector[i_row], x_double[i_row], 1.0e-13);
+
+  // Hilbert matrix, too ill-conditioned for single precision, so the solver must fall back to double.
+  const std::size_t size_hilbert = 10;
+  matrix.resize(size_hilbert, size_hilbert);
+  b_vector.resize(size_hilbert);
+  FOR(i_row, size_hilbert) {
+    FOR(i_column, size_hilbert) matrix[i_row][i_column] = 1.0 / static_cast<Scalar>(i_row + i_column + 1);
+    b_vector[i_row] = 1.0;
+  }
+  config.factor_tolerance = 1.0e-14;
+  mixed_solver.initialise(config);
+  EXPECT_TRUE(mixed_solver.factorise(matrix));
+  data = mixed_solver.solve_system(x_vector, b_vector);
+  EXPECT_TRUE(data.converged);
+  EXPECT_TRUE(data.fallback);
+  Scalar residual_max = 0;
+  FOR(i_row, size_hilbert) {
+    Scalar residual = b_vector[i_row];
+    FOR(i_column, size_hilbert) residual -= matrix[i_row][i_column] * x_vector[i_column];
+    residual_max = std::max(residual_max, std::abs(residual));
+  }
+  EXPECT_LT(residual_max, 1.0e-8);
+
+  // Subsequent solves use the double factors.
+  data = mixed_solver.solve_system(x_vector, b_vector);
+  EXPECT_TRUE(data.converged);
+  EXPECT_TRUE(data.fallback);
+  EXPECT_EQ(data.iteration, 1);
+}
+
+TEST_F(direct_solvers, lower_upper_factorisation_blocked) {
+
+  // System spanning several panels, the last one partial.
+  const std::size_t size = 150;
+  Matrix_Dense<Scalar, 0, 0> matrix;
+  matrix.resize(size, size);
+  FOR(i_row, size) FOR(i_column, size) matrix[i_row][i_column] = std::sin(static_cast<Scalar>(3 * i_row + 7 * i_column));
+  FOR(i_row, size) matrix[i_row][i_row] += 2.0;
+
+  // Reference, unblocked Doolittle factorisation with partial pivoting, and substitution.
+  const auto solve_reference = [&](const Vector_Dense<Scalar, 0>& b_vector) {
+    Matrix_Dense<Scalar, 0, 0> lu = matrix;
+    std::vector<std::size_t> pivot(size);
+    std::iota(pivot.begin(), pivot.end(), 0);
+    FOR(i_row, size) {
+      Scalar max = 0.0;
+      std::size_t i_max = i_row;
+      FOR(i_sweep, i_row, size) {
+        if(is_nearly_greater(std::abs(lu[i_sweep][i_row]), max)) {
+          max = std::abs(lu[i_sweep][i_row]);
+          i_max = i_sweep;
+        }
+      }
+      std::swap(pivot[i_row], pivot[i_max]);
+      std::swap(lu[i_row], lu[i_max]);
+      FOR(i_sweep, i_row + 1, size) {
+        lu[i_sweep][i_row] /= lu[i_row][i_row];
+        FOR(i_column, i_row + 1, size) lu[i_sweep][i_column] -= lu[i_sweep][i_row] * lu[i_row][i_column];
+      }
+    }
+    Vector_Dense<Scalar, 0> x_vector;
+    x_vector.resize(size);
+    FOR(i_row, size) {
+      x_vector[i_row] = b_vector[pivot[i_row]];
+      FOR(i_column, i_row) x_vector[i_row] -= lu[i_row][i_column] * x_vector[i_column];
+    }
+    for(std::size_t i_row = size; i_row-- > 0;) {
+      FOR(i_column, i_row + 1, size) x_vector[i_row] -= lu[i_row][i_column] * x_vector[i_column];
+      x_vector[i_row] /= lu[i_row][i_row];
+    }
+    return x_vector;
+  };
+
+  // Multiple right hand sides, with several threads.
+  const std::size_t size_rhs = 40;
+  Matrix_Dense<Scalar, 0, 0> b_matrix;
+  Matrix_Dense<Scalar, 0, 0> x_matrix;
+  b_matrix.resize(size, size_rhs);
+  FOR(i_row, size) FOR(i_rhs, size_rhs) b_matrix[i_row][i_rhs] = std::cos(static_cast<Scalar>(i_row * (i_rhs + 1)));
+  parallel_thread_count_set(3);
+  EXPECT_TRUE(lup_solver.factorise(matrix));
+  const Convergence_Data data = lup_solver.solve_system(x_matrix, b_matrix);
+  parallel_thread_count_set(0);
+  EXPECT_TRUE(data.converged);
+  ASSERT_EQ(x_matrix.size_row(), size);
+  ASSERT_EQ(x_matrix.size_column(), size_rhs);
+
+  // Identical to the unblocked algorithm, and to single right hand side solves.
+  Vector_Dense<Scalar, 0> b_vector;
+  Vector_Dense<Scalar, 0> x_vector;
+  b_vector.resize(size);
+  FOR(i_rhs, size_rhs) {
+    FOR(i_row, size) b_vector[i_row] = b_matrix[i_row][i_rhs];
+    const Vector_Dense<Scalar, 0> x_reference = solve_reference(b_vector);
+    lup_solver.solve_system(x_vector, b_vector);
+    FOR(i_row, size) {
+      EXPECT_EQ(x_vector[i_row], x_reference[i_row]);
+      EXPECT_EQ(x_matrix[i_row][i_rhs], x_reference[i_row]);
+    }
+  }
+}
@@ -0,0 +1,255 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ---------------------------------------------------------------------------------------------------------------------
+// File Name: test_direct_sparse.cpp
+// Description: Unit tests for the sparse direct solvers.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "matrix_sparse.hpp"
+#include "reorder.hpp"
+#include "solver.hpp"
+
+using namespace Disa;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Testing Fixture Setup
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @class direct_sparse_solvers
+ * @brief Constructs 2D convection-diffusion systems, which reduce to the (SPD) Laplace system without convection.
+ */
+class direct_sparse_solvers : public ::testing::Test {
+ public:
+  Matrix_Sparse a_sparse;            //!< Sparse coefficient matrix of the linear system
+  Vector_Dense<Scalar, 0> x_vector;  //!< Solution vector of the linear system.
+  Vector_Dense<Scalar, 0> b_vector;  //!< Constant vector of the linear system.
+
+  /**
+   * @brief Constructs the 5-point convection-diffusion stencil, optionally with Dirichlet (identity) boundary rows.
+   * @param[in] size_x The number of nodes in each of the cardinal directions.
+   * @param[in] convection The convection strength, zero for a symmetric system.
+   * @param[in] dirichlet If true the boundary rows are replaced with identity rows, making the pattern unsymmetric.
+   */
+  void construct(const int size_x, const Scalar convection = 0.0, const bool dirichlet = false) {
+    const int size_xy = size_x * size_x;
+    a_sparse.clear();
+    a_sparse.resize(size_xy, size_xy);
+    x_vector.resize(size_xy);
+    b_vector.resize(size_xy);
+    FOR(i_node, size_xy) {
+      b_vector[i_node] = 1.0 + 0.1 * std::sin(static_cast<Scalar>(i_node));
+      if(dirichlet && (i_node % size_x == 0 || (i_node + 1) % size_x == 0 || i_node < size_x ||
+                       i_node >= size_xy - size_x)) {
+        a_sparse[i_node][i_node] = 1.0;
+        continue;
+      }
+      if((i_node + size_x) < size_xy) a_sparse[i_node][i_node + size_x] = -1.0 + convection;
+      if(i_node % size_x != 0) a_sparse[i_node][i_node - 1] = -1.0 - convection;
+      a_sparse[i_node][i_node] = 4.0;
+      if((i_node + 1) % size_x != 0) a_sparse[i_node][i_node + 1] = -1.0 + convection;
+      if((i_node - size_x) >= 0) a_sparse[i_node][i_node - size_x] = -1.0 - convection;
+    }
+  }
+
+  /**
+   * @brief Computes the maximum absolute residual of the linear system, |Ax - b|_inf.
+   * @return The maximum absolute residual.
+   */
+  Scalar residual_max() const {
+    Scalar residual = 0.0;
+    FOR(i_row, a_sparse.size_row()) {
+      Scalar value = -b_vector[i_row];
+      FOR_ITER(column_iter, a_sparse[i_row]) value += *column_iter * x_vector[column_iter.i_column()];
+      residual = std::max(residual, std::abs(value));
+    }
+    return residual;
+  }
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Symbolic Factorisation
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST_F(direct_sparse_solvers, symbolic_factorisation) {
+
+  // Tridiagonal, the elimination tree is a chain and only the last two columns share a structure.
+  const std::size_t size = 6;
+  a_sparse.resize(size, size);
+  FOR(i_row, size) {
+    if(i_row != 0) a_sparse[i_row][i_row - 1] = -1.0;
+    a_sparse[i_row][i_row] = 2.0;
+    if(i_row != size - 1) a_sparse[i_row][i_row + 1] = -1.0;
+  }
+  std::vector<std::size_t> permutation(size);
+  std::iota(permutation.begin(), permutation.end(), 0);
+  Symbolic_Factorisation symbolic = symbolic_factorisation(a_sparse, permutation);
+  EXPECT_EQ(symbolic.permutation, permutation);
+  FOR(i_column, size - 1) EXPECT_EQ(symbolic.parent[i_column], i_column + 1);
+  EXPECT_EQ(symbolic.parent.back(), std::numeric_limits<std::size_t>::max());
+  EXPECT_EQ(symbolic.size_supernode(), size - 1);
+  EXPECT_EQ(symbolic.size_non_zero(), 2 * size - 1);
+  EXPECT_EQ(symbolic.scatter.size(), a_sparse.size_non_zero());
+
+  // Arrow matrix, ordering the hub first fills the factor completely, last creates no fill.
+  a_sparse.clear();
+  a_sparse.resize(size, size);
+  FOR(i_row, size) {
+    a_sparse[i_row][i_row] = 10.0;
+    if(i_row != 0) {
+      a_sparse[0][i_row] = 1.0;
+      a_sparse[i_row][0] = 1.0;
+    }
+  }
+  symbolic = symbolic_factorisation(a_sparse, permutation);
+  EXPECT_EQ(symbolic.size_non_zero(), size * (size + 1) / 2);
+  EXPECT_EQ(symbolic.size_supernode(), 1);
+  std::reverse(permutation.begin(), permutation.end());
+  symbolic = symbolic_factorisation(a_sparse, permutation);
+  EXPECT_EQ(symbolic.size_non_zero(), 2 * size - 1);
+  EXPECT_EQ(symbolic.permutation[0], size - 1);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Cholesky Factorisation
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST_F(direct_sparse_solvers, cholesky_factorisation_sparse) {
+  Solver_Config config;
+  config.type = Solver_Type::cholesky_factorisation_sparse;
+  Solver_Cholesky_Sparse solver(config);
+  EXPECT_EQ(solver.get_config().type, Solver_Type::cholesky_factorisation_sparse);
+
+  construct(20);
+  ASSERT_TRUE(solver.factorise(a_sparse));
+  Convergence_Data convergence = solver.solve_system(x_vector, b_vector);
+  EXPECT_TRUE(convergence.converged);
+  EXPECT_LT(residual_max(), 1.0e-12);
+
+  // The fill reducing ordering should produce supernodes, and far less fill than the dense (or banded) factor.
+  const Symbolic_Factorisation symbolic = solver.symbolic();
+  EXPECT_LT(symbolic.size_supernode(), a_sparse.size_row());
+  EXPECT_LT(symbolic.size_non_zero(), a_sparse.size_row() * 21);
+
+  // New values on the same pattern reuse the analysis.
+  FOR(i_row, a_sparse.size_row()) a_sparse[i_row][i_row] = 5.0 + static_cast<Scalar>(i_row % 3);
+  ASSERT_TRUE(solver.factorise(a_sparse));
+  EXPECT_EQ(solver.symbolic().permutation, symbolic.permutation);
+  EXPECT_EQ(solver.symbolic().scatter, symbolic.scatter);
+  FOR(i_solve, 3) {
+    b_vector[i_solve] += 1.0;
+    convergence = solver.solve_system(x_vector, b_vector);
+    EXPECT_TRUE(convergence.converged);
+    EXPECT_LT(residual_max(), 1.0e-12);
+  }
+
+  // Not positive definite.
+  a_sparse[7][7] = -4.0;
+  EXPECT_FALSE(solver.factorise(a_sparse));
+  EXPECT_FALSE(solver.solve_system(x_vector, b_vector).converged);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Lower Upper Factorisation
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST_F(direct_sparse_solvers, lower_upper_factorisation_sparse) {
+  Solver_Config config;
+  config.type = Solver_Type::lower_upper_factorisation_sparse;
+  Solver_LU_Sparse solver(config);
+
+  // Unsymmetric values and pattern.
+  construct(20, 0.4, true);
+  ASSERT_TRUE(solver.factorise(a_sparse));
+  EXPECT_TRUE(solver.solve_system(x_vector, b_vector).converged);
+  EXPECT_LT(residual_max(), 1.0e-12);
+
+  // A user supplied ordering.
+  std::vector<std::size_t> permutation(a_sparse.size_row());
+  std::iota(permutation.begin(), permutation.end(), 0);
+  solver.analyse(a_sparse, permutation);
+  ASSERT_TRUE(solver.factorise(a_sparse));
+  EXPECT_TRUE(solver.solve_system(x_vector, b_vector).converged);
+  EXPECT_LT(residual_max(), 1.0e-12);
+
+  // Singular.
+  construct(5);
+  FOR_ITER_REF(column_iter, a_sparse[3]) *column_iter = 0.0;
+  EXPECT_FALSE(solver.factorise(a_sparse));
+}
+
+TEST_F(direct_sparse_solvers, ordering_fill_report) {
+  Solver_Config config;
+  config.type = Solver_Type::cholesky_factorisation_sparse;
+  Solver_Cholesky_Sparse solver(config);
+  construct(30);
+  const Adjacency_Graph<false> graph = pattern_graph(a_sparse);
+
+  // Fill and factorisation time of the bandwidth reducing, minimum degree and nested dissection orderings.
+  const auto report = [&](const std::string& name, const std::vector<std::size_t>& permutation) {
+    solver.analyse(a_sparse, permutation);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(solver.factorise(a_sparse));
+    const auto duration =
+    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    solver.solve_system(x_vector, b_vector);
+    EXPECT_LT(residual_max(), 1.0e-12);
+    std::cout << "[ Ordering ] " << name << ": nnz(L) = " << solver.symbolic().size_non_zero()
+              << ", supernodes = " << solver.symbolic().size_supernode() << ", factorisation = " << duration.count()
+              << " us\n";
+    return solver.symbolic().size_non_zero();
+  };
+  const std::size_t fill_reverse_cuthill_mckee = report("RCM", cuthill_mckee_reverse(graph));
+  const std::size_t fill_minimum_degree = report("AMD", approximate_minimum_degree(graph));
+  const std::size_t fill_nested_dissection = report("ND", nested_dissection(graph, 32));
+  EXPECT_LT(fill_minimum_degree, fill_reverse_cuthill_mckee);
+  EXPECT_LT(fill_nested_dissection, fill_reverse_cuthill_mckee);
+
+  // AMD is the default ordering.
+  solver.analyse(a_sparse);
+  EXPECT_EQ(solver.symbolic().size_non_zero(), fill_minimum_degree);
+}
+
+TEST_F(direct_sparse_solvers, solver_wrapper) {
+  Solver_Config config;
+  config.type = Solver_Type::lower_upper_factorisation_sparse;
+  Solver solver = build_solver(config);
+  construct(12, 0.2);
+  EXPECT_TRUE(solver.solve(a_sparse, x_vector, b_vector).converged);
+  EXPECT_LT(residual_max(), 1.0e-12);
+
+  // Factorise once, solve many.
+  config.type = Solver_Type::cholesky_factorisation_sparse;
+  solver = build_solver(config);
+  construct(12);
+  ASSERT_TRUE(solver.factorise(a_sparse));
+  FOR(i_solve, 3) {
+    b_vector[i_solve] -= 1.0;
+    EXPECT_TRUE(solver.solve(x_vector, b_vector).converged);
+    EXPECT_LT(residual_max(), 1.0e-12);
+  }
+}
+
+TEST_F(direct_sparse_solvers, direct_sparse_death_test) {
+  Solver_Config config;
+  config.type = Solver_Type::lower_upper_factorisation_sparse;
+  EXPECT_DEATH(Solver_Cholesky_Sparse solver(config), "./*");
+  config.type = Solver_Type::cholesky_factorisation_sparse;
+  EXPECT_DEATH(Solver_LU_Sparse solver(config), "./*");
+}
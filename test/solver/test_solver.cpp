@@ -23,6 +23,7 @@
 
 #include "matrix_dense.hpp"
 #include "matrix_sparse.hpp"
+#include "parallel.hpp"
 #include "solver.hpp"
 
 using namespace Disa;
@@ -246,3 +247,84 @@ TEST_F(Laplace2DProblem, iterative_solver_test) {
             << "us";
   std::cout << "\n";
 }
+
+TEST_F(Laplace2DProblem, level_schedule) {
+  construct_2D_laplace_source(10);
+  const Level_Schedule schedule = level_schedule(a_sparse_0);
+
+  // Every row scheduled exactly once.
+  ASSERT_EQ(schedule.row.size(), a_sparse_0.size_row());
+  std::vector<std::size_t> level(a_sparse_0.size_row(), std::numeric_limits<std::size_t>::max());
+  FOR(i_level, schedule.level_offset.size() - 1) {
+    FOR(i_row, schedule.level_offset[i_level], schedule.level_offset[i_level + 1]) {
+      EXPECT_EQ(level[schedule.row[i_row]], std::numeric_limits<std::size_t>::max());
+      level[schedule.row[i_row]] = i_level;
+    }
+  }
+
+  // Lower neighbours in earlier levels, upper neighbours in later levels.
+  FOR(i_row, a_sparse_0.size_row()) {
+    FOR_ITER(column_iter, a_sparse_0[i_row]) {
+      if(column_iter.i_column() < i_row) {
+        EXPECT_LT(level[column_iter.i_column()], level[i_row]);
+      }
+      if(column_iter.i_column() > i_row) {
+        EXPECT_GT(level[column_iter.i_column()], level[i_row]);
+      }
+    }
+  }
+}
+
+TEST_F(Laplace2DProblem, wavefront_gauss_seidel) {
+  // Non-symmetric pattern (boundary rows), large enough that several threads share each level.
+  construct_2D_laplace_source(100);
+  Solver_Config config;
+  config.maximum_iterations = 10;
+  config.convergence_tolerance = 1.0e-14;
+  parallel_thread_count_set(2);
+
+  for(const Solver_Type type : {Solver_Type::gauss_seidel, Solver_Type::successive_over_relaxation}) {
+    config.type = type;
+    config.wavefront = false;
+    Vector_Dense<Scalar, 0> x_serial = x_vector;
+    Solver solver = build_solver(config);
+    const Convergence_Data result_serial = solver.solve(a_sparse_0, x_serial, b_vector_0);
+
+    config.wavefront = true;
+    Vector_Dense<Scalar, 0> x_wavefront = x_vector;
+    solver = build_solver(config);
+    const Convergence_Data result_wavefront = solver.solve(a_sparse_0, x_wavefront, b_vector_0);
+
+    // Bitwise identical.
+    EXPECT_EQ(result_serial.iteration, result_wavefront.iteration);
+    EXPECT_EQ(result_serial.residual, result_wavefront.residual);
+    FOR(i_node, x_vector.size()) EXPECT_EQ(x_serial[i_node], x_wavefront[i_node]);
+  }
+  parallel_thread_count_set(0);
+}
+
+TEST_F(Laplace2DProblem, asynchronous_relaxation) {
+  construct_2D_laplace_source(30);
+  Solver_Config config;
+  config.maximum_iterations = 20000;
+  config.convergence_tolerance = 1.0e-7;
+
+  // Reference solution.
+  config.type = Solver_Type::gauss_seidel;
+  Vector_Dense<Scalar, 0> x_reference = x_vector;
+  Solver solver = build_solver(config);
+  solver.solve(a_sparse_0, x_reference, b_vector_0);
+
+  // Asynchronous, with several threads each owning a block of rows.
+  parallel_thread_count_set(4);
+  config.type = Solver_Type::asynchronous_relaxation;
+  Vector_Dense<Scalar, 0> x_asynchronous = x_vector;
+  solver = build_solver(config);
+  const Convergence_Data result = solver.solve(a_sparse_0, x_asynchronous, b_vector_0);
+  parallel_thread_count_set(0);
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_LT(result.iteration, config.maximum_iterations);
+  EXPECT_LE(result.residual_normalised, 1.0e-7);
+  FOR(i_node, x_vector.size()) EXPECT_NEAR(x_asynchronous[i_node], x_reference[i_node], 1.0e-6);
+}
@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------------------------------------------------
+//  MIT License
+//  Copyright (c) 2022 Bevan W.S. Jones
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+//  documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+//  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+//  Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+//  WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+//  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+//  OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ----------------------------------------------------------------------------------------------------------------------
+//  File Name: test_solver_distributed.cpp
+//  Description: Unit tests for distributed sparse matrices and the solvers operating on them.
+// ----------------------------------------------------------------------------------------------------------------------
+
+#include "parallel.hpp"
+#include "solver_distributed.hpp"
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+
+using namespace Disa;
+
+/**
+ * @brief Constructs the 5 point Laplacian of a square grid, with the Dirichlet boundary eliminated, plus a shift.
+ * @param[in] size_x The number of nodes along a side.
+ * @param[in] diagonal The diagonal value, 4 for the Laplacian, larger for diagonal dominance.
+ * @return The symmetric positive definite matrix.
+ */
+Matrix_Sparse laplacian(const std::size_t size_x, const Scalar diagonal) {
+  Matrix_Sparse matrix(size_x * size_x, size_x * size_x);
+  FOR(i_row, size_x * size_x) {
+    if(i_row >= size_x) matrix.insert(i_row, i_row - size_x, -1.0);
+    if(i_row % size_x != 0) matrix.insert(i_row, i_row - 1, -1.0);
+    matrix.insert(i_row, i_row, diagonal);
+    if((i_row + 1) % size_x != 0) matrix.insert(i_row, i_row + 1, -1.0);
+    if(i_row + size_x < size_x * size_x) matrix.insert(i_row, i_row + size_x, -1.0);
+  }
+  return matrix;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Distributed Matrix
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(test_solver_distributed, distribute_matrix) {
+  const Matrix_Sparse matrix = laplacian(20, 4.0);
+  const std::vector<Distributed_Matrix> distributed_list = distribute_matrix(matrix, 5);
+  ASSERT_EQ(distributed_list.size(), 5);
+
+  // Each row is owned once, and each local matrix is the global matrix under the local indexing.
+  std::vector<std::size_t> row_count(matrix.size_row(), 0);
+  FOR_EACH(distributed, distributed_list) {
+    EXPECT_EQ(distributed.size_global, matrix.size_row());
+    EXPECT_EQ(distributed.matrix.size_column(), distributed.size_local());
+    EXPECT_EQ(distributed.interior.first, 0);
+    EXPECT_EQ(distributed.interior.second, distributed.boundary.first);
+    EXPECT_EQ(distributed.boundary.second, distributed.size_owned());
+    EXPECT_GT(distributed.size_local(), distributed.size_owned());
+    FOR(i_row, distributed.size_owned()) {
+      const std::size_t i_global = distributed.i_local_global[i_row];
+      ++row_count[i_global];
+      EXPECT_EQ(std::distance(distributed.matrix[i_row].begin(), distributed.matrix[i_row].end()),
+                std::distance(matrix[i_global].begin(), matrix[i_global].end()));
+      FOR_ITER(iter, distributed.matrix[i_row]) {
+        EXPECT_EQ(*iter, matrix[i_global][distributed.i_local_global[iter.i_column()]]);
+        if(i_row < distributed.interior.second) EXPECT_LT(iter.i_column(), distributed.size_owned());
+      }
+    }
+  }
+  FOR_EACH(count, row_count) EXPECT_EQ(count, 1);
+
+  // A distributed multiply matches the global one.
+  Vector_Dense<Scalar, 0> x_vector(
+  [](const std::size_t i_row) { return std::sin(static_cast<Scalar>(i_row)); }, matrix.size_row());
+  const Vector_Dense<Scalar, 0> y_vector = matrix * x_vector;
+  Vector_Dense<Scalar, 0> y_distributed;
+  y_distributed.resize(matrix.size_row(), 0.0);
+  Transport_Local transport(distributed_list.size());
+  parallel_region(distributed_list.size(), [&](const std::size_t i_rank, const std::size_t) {
+    Transport_Local::Endpoint endpoint = transport.endpoint(i_rank);
+    Vector_Dense<Scalar, 0> x_local = distribute_vector(distributed_list[i_rank], x_vector);
+    FOR(i_local, distributed_list[i_rank].size_owned(), distributed_list[i_rank].size_local()) x_local[i_local] = 0.0;
+    Vector_Dense<Scalar, 0> y_local;
+    y_local.resize(distributed_list[i_rank].size_owned());
+    distributed_multiply(distributed_list[i_rank], x_local, y_local, endpoint);
+    collect_vector(distributed_list[i_rank], y_local, y_distributed);
+  });
+  FOR(i_row, matrix.size_row()) EXPECT_NEAR(y_distributed[i_row], y_vector[i_row], 1.0e-12);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Distributed Solvers
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(test_solver_distributed, distributed_solve_local) {
+  const std::size_t number_rank = 4;
+  const Convergence_Criteria criteria{0, 10000, 1.0e-10};
+  Vector_Dense<Scalar, 0> solution(
+  [](const std::size_t i_row) { return std::cos(0.1 * static_cast<Scalar>(i_row)); }, 24 * 24);
+
+  FOR_EACH(diagonal, std::vector<Scalar>({4.0, 5.0})) {
+    const Matrix_Sparse matrix = laplacian(24, diagonal);
+    const Vector_Dense<Scalar, 0> b_vector = matrix * solution;
+    const std::vector<Distributed_Matrix> distributed_list = distribute_matrix(matrix, number_rank);
+    std::vector<Convergence_Data> data_list(number_rank);
+    Vector_Dense<Scalar, 0> x_vector;
+    x_vector.resize(matrix.size_row(), 0.0);
+
+    Transport_Local transport(number_rank);
+    parallel_region(number_rank, [&](const std::size_t i_rank, const std::size_t) {
+      Transport_Local::Endpoint endpoint = transport.endpoint(i_rank);
+      const Distributed_Matrix& distributed = distributed_list[i_rank];
+      Vector_Dense<Scalar, 0> x_local;
+      x_local.resize(distributed.size_local(), 0.0);
+      const Vector_Dense<Scalar, 0> b_local = distribute_vector(distributed, b_vector);
+      data_list[i_rank] = diagonal == 4.0 ?
+                          distributed_conjugate_gradient(distributed, x_local, b_local, criteria, endpoint) :
+                          distributed_jacobi(distributed, x_local, b_local, criteria, endpoint);
+      collect_vector(distributed, x_local, x_vector);
+    });
+
+    FOR_EACH(data, data_list) {
+      EXPECT_TRUE(data.converged);
+      EXPECT_EQ(data.iteration, data_list.front().iteration);
+      EXPECT_EQ(data.residual, data_list.front().residual);
+      EXPECT_LE(data.residual_normalised, criteria.tolerance);
+    }
+    FOR(i_row, matrix.size_row()) EXPECT_NEAR(x_vector[i_row], solution[i_row], 1.0e-7);
+  }
+}
+
+TEST(test_solver_distributed, distributed_solve_socket) {
+  const Matrix_Sparse matrix = laplacian(32, 4.0);
+  const Vector_Dense<Scalar, 0> solution(
+  [](const std::size_t i_row) { return std::cos(0.1 * static_cast<Scalar>(i_row)); }, matrix.size_row());
+  const Vector_Dense<Scalar, 0> b_vector = matrix * solution;
+  const Convergence_Criteria criteria{0, 10000, 1.0e-10};
+
+  // Failures on forked ranks are reported by throwing, which fails run().
+  const auto check = [](const bool condition) {
+    if(!condition) throw std::runtime_error("Check failed.");
+  };
+  FOR_EACH(number_rank, std::vector<std::size_t>({1, 2, 4})) {
+    const std::vector<Distributed_Matrix> distributed_list = distribute_matrix(matrix, number_rank);
+    EXPECT_TRUE(Transport_Socket::run(number_rank, [&](Transport_Socket& transport) {
+      const Distributed_Matrix& distributed = distributed_list[transport.rank()];
+      Vector_Dense<Scalar, 0> x_local;
+      x_local.resize(distributed.size_local(), 0.0);
+      const Convergence_Data data = distributed_conjugate_gradient(
+      distributed, x_local, distribute_vector(distributed, b_vector), criteria, transport);
+      check(data.converged);
+      FOR(i_local, distributed.size_local())
+      check(std::abs(x_local[i_local] - solution[distributed.i_local_global[i_local]]) < 1.0e-7);
+    }));
+  }
+}
@@ -0,0 +1,131 @@
+// ---------------------------------------------------------------------------------------------------------------------
+// MIT License
+// Copyright (c) 2022 Bevan W.S. Jones
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// File Name: test_solver_krylov.cpp
+// Description: Unit tests for the Krylov subspace solvers.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "matrix_sparse.hpp"
+#include "solver.hpp"
+
+using namespace Disa;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Testing Fixture Setup
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @class Laplace2DSequence
+ * @brief Constructs a sequence of slowly varying 2D Laplace (SPD) systems, e.g. as arise from implicit time stepping.
+ */
+class Laplace2DSequence : public ::testing::Test {
+ public:
+  Matrix_Sparse a_sparse;            //!< Sparse coefficient matrix of the linear system
+  Vector_Dense<Scalar, 0> x_vector;  //!< Solution vector of the linear system.
+  Vector_Dense<Scalar, 0> b_vector;  //!< Constant vector of the linear system.
+
+  /**
+   * @brief Constructs system i_step of the sequence, the 5-point Laplace stencil with a slowly varying diagonal shift.
+   * @param[in] size_x The number of nodes in each of the cardinal directions.
+   * @param[in] i_step The index of the system in the sequence.
+   */
+  void construct(const int size_x, const std::size_t i_step) {
+    const int size_xy = size_x * size_x;
+    a_sparse.clear();
+    a_sparse.resize(size_xy, size_xy);
+    x_vector.resize(size_xy);
+    b_vector.resize(size_xy);
+    const Scalar shift = 1.0e-3 * static_cast<Scalar>(i_step);
+    FOR(i_node, size_xy) {
+      if((i_node + size_x) < size_xy) a_sparse[i_node][i_node + size_x] = -1.0;
+      if(i_node % size_x != 0) a_sparse[i_node][i_node - 1] = -1.0;
+      a_sparse[i_node][i_node] = 4.0 + shift * (1.0 + static_cast<Scalar>(i_node % 7) / 7.0);
+      if((i_node + 1) % size_x != 0) a_sparse[i_node][i_node + 1] = -1.0;
+      if((i_node - size_x) >= 0) a_sparse[i_node][i_node - size_x] = -1.0;
+      b_vector[i_node] = 1.0 + 0.1 * std::sin(static_cast<Scalar>(i_node + i_step));
+      x_vector[i_node] = 0.0;
+    }
+  }
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Conjugate Gradient
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST_F(Laplace2DSequence, conjugate_gradient) {
+  Solver_Config config;
+  config.type = Solver_Type::conjugate_gradient;
+  config.maximum_iterations = 1000;
+  config.convergence_tolerance = 1.0e-10;
+  Solver solver = build_solver(config);
+
+  construct(20, 0);
+  const Convergence_Data convergence = solver.solve(a_sparse, x_vector, b_vector);
+  EXPECT_LT(convergence.iteration, 1000);
+  EXPECT_LT(convergence.residual_normalised, 1.0e-10);
+
+  // The result should agree with a tightly converged Gauss Seidel solve.
+  Vector_Dense<Scalar, 0> x_reference;
+  x_reference.resize(x_vector.size(), 0.0);
+  config.type = Solver_Type::gauss_seidel;
+  config.maximum_iterations = 10000;
+  Solver solver_reference = build_solver(config);
+  solver_reference.solve(a_sparse, x_reference, b_vector);
+  FOR(i_node, x_vector.size()) EXPECT_NEAR(x_vector[i_node], x_reference[i_node], 1.0e-6);
+}
+
+TEST_F(Laplace2DSequence, conjugate_gradient_recycle) {
+  const int size_x = 30;
+  const std::size_t number_steps = 10;
+  Solver_Config config;
+  config.type = Solver_Type::conjugate_gradient;
+  config.maximum_iterations = 2000;
+  config.convergence_tolerance = 1.0e-10;
+
+  // Solve the sequence with and without recycling.
+  std::vector<std::size_t> iteration;
+  std::vector<Vector_Dense<Scalar, 0>> solution;
+  for(const std::size_t recycle_size : {std::size_t(0), std::size_t(8)}) {
+    config.recycle_size = recycle_size;
+    Solver solver = build_solver(config);
+    iteration.push_back(0);
+    FOR(i_step, number_steps) {
+      construct(size_x, i_step);
+      const Convergence_Data convergence = solver.solve(a_sparse, x_vector, b_vector);
+      EXPECT_LT(convergence.residual_normalised, 1.0e-10);
+      iteration.back() += convergence.iteration;
+    }
+    solution.push_back(x_vector);
+  }
+
+  // Same solution, fewer iterations.
+  FOR(i_node, solution[0].size()) EXPECT_NEAR(solution[0][i_node], solution[1][i_node], 1.0e-8);
+  EXPECT_LT(iteration[1], iteration[0]);
+  std::cout << "\nConjugate gradient, total iterations over " << number_steps << " systems: " << iteration[0]
+            << " (no recycling), " << iteration[1] << " (recycled, 8 vectors).\n";
+
+  // A pattern change invalidates the recycled space, the solve must still be correct.
+  config.recycle_size = 8;
+  Solver solver = build_solver(config);
+  construct(size_x, 0);
+  solver.solve(a_sparse, x_vector, b_vector);
+  construct(size_x - 5, 0);
+  const Convergence_Data convergence = solver.solve(a_sparse, x_vector, b_vector);
+  EXPECT_LT(convergence.residual_normalised, 1.0e-10);
+  EXPECT_LT(convergence.iteration, config.maximum_iterations);
+}